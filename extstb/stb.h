@@ -43,5 +43,14 @@ namespace stb
 #include "stb_image.h"
 #include "stb_image_write.h"
 
+//! Deflate (zlib format) compression - defined (only) in stb_image_write
+unsigned char *
+stbi_zlib_compress
+	( unsigned char * data
+	, int data_len
+	, int * out_len
+	, int quality
+	);
+
 #endif // stb_stb_INCL_
 
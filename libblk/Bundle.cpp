@@ -0,0 +1,713 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Definitions for blk::Bundle
+*/
+
+
+#include "libblk/Bundle.h"
+
+#include "libdat/info.h"
+#include "libdat/validity.h"
+#include "libio/sprintf.h"
+#include "libla/eigen.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+
+
+namespace blk
+{
+
+std::string
+Bundle::Iteration :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << " ";
+	}
+	oss
+		<< "rmsPrev: " << io::sprintf("%12.5e", theRmsPrev)
+		<< " " << "rmsNext: " << io::sprintf("%12.5e", theRmsNext)
+		<< " " << "damping: " << io::sprintf("%9.2e", theDamping)
+		<< " " << "accepted: " << dat::infoString(theAccepted)
+		;
+	return oss.str();
+}
+
+namespace
+{
+	// NOTE: DontAlign allows use in std::vector without aligned_allocator
+	using Vec2 = Eigen::Matrix<double, 2, 1, Eigen::DontAlign>;
+	using Vec3 = Eigen::Matrix<double, 3, 1, Eigen::DontAlign>;
+	using Vec6 = Eigen::Matrix<double, 6, 1, Eigen::DontAlign>;
+	using Mat23 = Eigen::Matrix<double, 2, 3, Eigen::DontAlign>;
+	using Mat26 = Eigen::Matrix<double, 2, 6, Eigen::DontAlign>;
+	using Mat33 = Eigen::Matrix<double, 3, 3, Eigen::DontAlign>;
+	using Mat63 = Eigen::Matrix<double, 6, 3, Eigen::DontAlign>;
+	using Mat66 = Eigen::Matrix<double, 6, 6, Eigen::DontAlign>;
+
+	using SpMat = Eigen::SparseMatrix<double>;
+	using Triplet = Eigen::Triplet<double>;
+
+	//! Rotation matrix (columns are images of basis vectors)
+	Mat33
+	matrixFor
+		( ga::Pose const & pose
+		)
+	{
+		Mat33 mat;
+		std::array<ga::Vector, 3u> const cols
+			{{ pose(ga::e1), pose(ga::e2), pose(ga::e3) }};
+		for (size_t col{0u} ; col < 3u ; ++col)
+		{
+			for (size_t row{0u} ; row < 3u ; ++row)
+			{
+				mat(row, col) = cols[col][row];
+			}
+		}
+		return mat;
+	}
+
+	//! Linearized observation: residual and Jacobians
+	struct ObsLin
+	{
+		Vec2 theRes{ Vec2::Zero() };
+		Mat26 theJacOri{ Mat26::Zero() };
+		Mat23 theJacPnt{ Mat23::Zero() };
+		bool theIsValid{ false };
+	};
+
+	/*! Residual (mea - fit) with Jacobians w.r.t. orientation and point.
+	 *
+	 * Orientation parameters are (dSta, dAng) for which
+	 * pCam = Pose(dAng)(rot * (pnt - (sta + dSta))), such that
+	 * d(pCam)/d(dSta) = -rot and d(pCam)/d(dAng) = [pCam]x
+	 */
+	ObsLin
+	linearized
+		( dat::Spot const & meaSpot
+		, ga::Rigid const & ori
+		, Mat33 const & rot
+		, ga::Vector const & pnt
+		, cam::Camera const & camera
+		)
+	{
+		ObsLin lin;
+		ga::Vector const pCam{ ori(pnt) };
+		dat::Spot const fitSpot{ camera.imageSpotFor(pCam) };
+		if (dat::isValid(fitSpot))
+		{
+			lin.theRes(0) = meaSpot[0] - fitSpot[0];
+			lin.theRes(1) = meaSpot[1] - fitSpot[1];
+
+			// spot = -pd * (px/pz, py/pz)
+			double const & pd = camera.theOptics.thePD;
+			double const invZ{ 1. / pCam[2] };
+			double const pdInvZ{ pd * invZ };
+			Mat23 dSdP;
+			dSdP
+				<< -pdInvZ, 0., pdInvZ * invZ * pCam[0]
+				, 0., -pdInvZ, pdInvZ * invZ * pCam[1]
+				;
+			Mat33 skew;
+			skew
+				<< 0., -pCam[2], pCam[1]
+				, pCam[2], 0., -pCam[0]
+				, -pCam[1], pCam[0], 0.
+				;
+
+			lin.theJacPnt = dSdP * rot;
+			lin.theJacOri.leftCols<3>() = -lin.theJacPnt;
+			lin.theJacOri.rightCols<3>() = dSdP * skew;
+			lin.theIsValid = true;
+		}
+		return lin;
+	}
+
+	//! Orientation with correction applied
+	ga::Rigid
+	updated
+		( ga::Rigid const & ori
+		, Vec6 const & dOri
+		)
+	{
+		ga::Vector const dSta(dOri(0), dOri(1), dOri(2));
+		ga::BiVector const dAng(dOri(3), dOri(4), dOri(5));
+		return ga::Rigid
+			(ori.location() + dSta, ga::Pose(dAng) * ori.pose());
+	}
+
+	//! Point with correction applied
+	ga::Vector
+	updated
+		( ga::Vector const & pnt
+		, Vec3 const & dPnt
+		)
+	{
+		return (pnt + ga::Vector(dPnt(0), dPnt(1), dPnt(2)));
+	}
+
+	//! Rms value associated with sum of squares over spots
+	double
+	rmsFor
+		( double const & sumSq
+		, size_t const & numObs
+		)
+	{
+		double rms{ dat::nullValue<double>() };
+		if ((0u < numObs) && std::isfinite(sumSq))
+		{
+			rms = std::sqrt(sumSq / (2. * double(numObs)));
+		}
+		return rms;
+	}
+
+	//! Per point quantities for Schur complement and back substitution
+	struct PntBlock
+	{
+		Mat33 theInvV{ Mat33::Zero() };
+		Vec3 theGrad{ Vec3::Zero() };
+		bool theIsValid{ false };
+	};
+
+	//! Reduced system contributions from a contiguous range of points
+	struct PartSystem
+	{
+		std::vector<Triplet> theTrips;
+		Eigen::VectorXd theRhs;
+		Eigen::VectorXd theDiag; // undamped orientation diagonal
+	};
+
+	//! Solution of reduced system
+	bool
+	solveReduced
+		( SpMat const & normMat
+		, Eigen::VectorXd const & rhs
+		, Bundle::SolveMethod const & method
+		, Eigen::VectorXd * const & ptSoln
+		)
+	{
+		bool okay{ false };
+		if (Bundle::Cholesky == method)
+		{
+			Eigen::SimplicialLDLT<SpMat> const ldlt(normMat);
+			if (Eigen::Success == ldlt.info())
+			{
+				*ptSoln = ldlt.solve(rhs);
+				okay = (Eigen::Success == ldlt.info());
+			}
+		}
+		if (! okay) // ConjGrad or fallback
+		{
+			Eigen::ConjugateGradient<SpMat, Eigen::Lower|Eigen::Upper> cg;
+			cg.setMaxIterations
+				(std::max(size_t{ 100u }, size_t(4u * normMat.rows())));
+			cg.setTolerance(1.e-12);
+			cg.compute(normMat);
+			*ptSoln = cg.solve(rhs);
+			okay = (Eigen::Success == cg.info());
+		}
+		return okay;
+	}
+}
+
+// explicit
+Bundle :: Bundle
+	( cam::XRefSpots const & spotTab
+	, cam::Camera const & camera
+	, std::vector<ga::Rigid> const & oriAcqWrtRefs
+	, std::vector<ga::Vector> const & pntInRefs
+	)
+	: theCamera{ camera }
+	, theOris{ oriAcqWrtRefs }
+	, thePnts{ pntInRefs }
+{
+	size_t const numPnts{ std::min(spotTab.pntCapacity(), thePnts.size()) };
+	size_t const numAcqs{ std::min(spotTab.acqCapacity(), theOris.size()) };
+
+	// gather observations of adequately observed points
+	std::vector<bool> isActive(numAcqs, false);
+	std::vector<Obs> pntObs;
+	for (cam::PntNdx pntNdx{0u} ; pntNdx < numPnts ; ++pntNdx)
+	{
+		if (! dat::isValid(thePnts[pntNdx]))
+		{
+			continue;
+		}
+		pntObs.clear();
+		for (cam::AcqNdx acqNdx{0u} ; acqNdx < numAcqs ; ++acqNdx)
+		{
+			dat::Spot const & spot = spotTab(pntNdx, acqNdx);
+			if (dat::isValid(spot) && dat::isValid(theOris[acqNdx]))
+			{
+				pntObs.emplace_back(Obs{ pntNdx, acqNdx, spot });
+			}
+		}
+		if (1u < pntObs.size())
+		{
+			thePntBegs.emplace_back(theObs.size());
+			theObs.insert(theObs.end(), pntObs.begin(), pntObs.end());
+			for (Obs const & obs : pntObs)
+			{
+				isActive[obs.theAcqNdx] = true;
+			}
+		}
+	}
+	thePntBegs.emplace_back(theObs.size());
+
+	// datum: first active acquisition - and one station component of the
+	// active acquisition farthest from it
+	constexpr size_t nullNdx{ dat::nullValue<size_t>() };
+	std::vector<bool>::const_iterator const itFirst
+		{ std::find(isActive.begin(), isActive.end(), true) };
+	size_t const acqFix{ size_t(std::distance(isActive.cbegin(), itFirst)) };
+	size_t acqScale{ nullNdx };
+	size_t compScale{ nullNdx };
+	if (acqFix < numAcqs)
+	{
+		double maxMag{ 0. };
+		ga::Vector const & staFix = theOris[acqFix].location();
+		for (size_t acqNdx{acqFix + 1u} ; acqNdx < numAcqs ; ++acqNdx)
+		{
+			if (isActive[acqNdx])
+			{
+				ga::Vector const delta
+					{ theOris[acqNdx].location() - staFix };
+				double const mag{ ga::magnitude(delta) };
+				if (maxMag < mag)
+				{
+					maxMag = mag;
+					acqScale = acqNdx;
+					compScale = 0u;
+					for (size_t comp{1u} ; comp < 3u ; ++comp)
+					{
+						if (std::abs(delta[compScale]) < std::abs(delta[comp]))
+						{
+							compScale = comp;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// assign reduced system columns to free orientation parameters
+	ColNdxs nullCols;
+	nullCols.fill(nullNdx);
+	theColNdxs.assign(numAcqs, nullCols);
+	for (size_t acqNdx{0u} ; acqNdx < numAcqs ; ++acqNdx)
+	{
+		if (isActive[acqNdx] && (acqFix != acqNdx))
+		{
+			for (size_t prm{0u} ; prm < 6u ; ++prm)
+			{
+				if (! ((acqScale == acqNdx) && (compScale == prm)))
+				{
+					theColNdxs[acqNdx][prm] = theNumCols++;
+				}
+			}
+		}
+	}
+}
+
+bool
+Bundle :: isValid
+	() const
+{
+	return
+		(  theCamera.isValid()
+		&& (! theObs.empty())
+		);
+}
+
+namespace
+{
+	//! Sum of squared spot residuals (infinite if any projection fails)
+	template <typename ObsType>
+	double
+	sumSquaresFor
+		( std::vector<ObsType> const & obsList
+		, std::vector<ga::Rigid> const & oris
+		, std::vector<ga::Vector> const & pnts
+		, cam::Camera const & camera
+		, size_t const & numJobs
+		)
+	{
+		double const inf{ std::numeric_limits<double>::infinity() };
+		std::vector<double> sumSqs(obsList.size(), inf);
+		sys::job::processRanges
+			( obsList.size()
+			, [&] (size_t const & ndxBeg, size_t const & ndxEnd)
+				{
+					for (size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+					{
+						ObsType const & obs = obsList[ndx];
+						ga::Rigid const & ori = oris[obs.theAcqNdx];
+						ga::Vector const pCam{ ori(pnts[obs.thePntNdx]) };
+						dat::Spot const fit{ camera.imageSpotFor(pCam) };
+						if (dat::isValid(fit))
+						{
+							double const d0{ obs.theSpot[0] - fit[0] };
+							double const d1{ obs.theSpot[1] - fit[1] };
+							sumSqs[ndx] = d0*d0 + d1*d1;
+						}
+					}
+				}
+			, numJobs
+			);
+		// serial summation keeps result independent of numJobs
+		return std::accumulate(sumSqs.begin(), sumSqs.end(), 0.);
+	}
+}
+
+double
+Bundle :: rmsResidual
+	( size_t const & numJobs
+	) const
+{
+	double const sumSq
+		{ sumSquaresFor(theObs, theOris, thePnts, theCamera, numJobs) };
+	return rmsFor(sumSq, theObs.size());
+}
+
+std::vector<Bundle::Iteration>
+Bundle :: adjust
+	( size_t const & maxIterations
+	, double const & relTol
+	, SolveMethod const & method
+	, size_t const & numJobs
+	)
+{
+	std::vector<Iteration> iters;
+	if (! isValid())
+	{
+		return iters;
+	}
+
+	size_t const numObs{ theObs.size() };
+	size_t const numPnts{ thePntBegs.size() - 1u };
+	size_t const numAcqs{ theColNdxs.size() };
+
+	std::vector<ObsLin> lins(numObs);
+	std::vector<Mat63> wMats(numObs);
+	std::vector<PntBlock> pntBlocks(numPnts);
+	std::vector<Vec6> dOris(numAcqs);
+
+	double lambda{ 1.e-3 };
+	double sumPrev
+		{ sumSquaresFor(theObs, theOris, thePnts, theCamera, numJobs) };
+	bool needLin{ true };
+	for (size_t nIter{0u} ; nIter < maxIterations ; ++nIter)
+	{
+		// (re)linearize all observations about current estimates
+		if (needLin)
+		{
+			std::vector<Mat33> rots(numAcqs, Mat33::Zero());
+			for (size_t acqNdx{0u} ; acqNdx < numAcqs ; ++acqNdx)
+			{
+				if (dat::isValid(theOris[acqNdx]))
+				{
+					rots[acqNdx] = matrixFor(theOris[acqNdx].pose());
+				}
+			}
+			sys::job::processRanges
+				( numObs
+				, [&] (size_t const & ndxBeg, size_t const & ndxEnd)
+					{
+						for (size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+						{
+							Obs const & obs = theObs[ndx];
+							lins[ndx] = linearized
+								( obs.theSpot
+								, theOris[obs.theAcqNdx]
+								, rots[obs.theAcqNdx]
+								, thePnts[obs.thePntNdx]
+								, theCamera
+								);
+							wMats[ndx] = lins[ndx].theJacOri.transpose()
+								* lins[ndx].theJacPnt;
+						}
+					}
+				, numJobs
+				);
+			needLin = false;
+		}
+
+		// form reduced (orientation) system - point blocks eliminated
+		std::function<void(size_t const &, PartSystem * const &)> const
+			addPoint{ [&] (size_t const & pNdx, PartSystem * const & ptPart)
+			{
+				size_t const obsBeg{ thePntBegs[pNdx] };
+				size_t const obsEnd{ thePntBegs[pNdx + 1u] };
+
+				// point block (damped) and gradient
+				PntBlock & pBlock = pntBlocks[pNdx];
+				Mat33 vMat{ Mat33::Zero() };
+				pBlock.theGrad = Vec3::Zero();
+				for (size_t ndx{obsBeg} ; ndx < obsEnd ; ++ndx)
+				{
+					Mat23 const & jPnt = lins[ndx].theJacPnt;
+					vMat += jPnt.transpose() * jPnt;
+					pBlock.theGrad += jPnt.transpose() * lins[ndx].theRes;
+				}
+				vMat.diagonal() *= (1. + lambda);
+				double const det{ vMat.determinant() };
+				pBlock.theIsValid = (std::numeric_limits<double>::min() < det);
+				pBlock.theInvV = Mat33::Zero();
+				if (pBlock.theIsValid)
+				{
+					pBlock.theInvV = vMat.inverse();
+				}
+
+				// orientation blocks less point coupling: U - W*inv(V)*W^T
+				for (size_t ndxK{obsBeg} ; ndxK < obsEnd ; ++ndxK)
+				{
+					Mat26 const & jOri = lins[ndxK].theJacOri;
+					ColNdxs const & colsK = theColNdxs[theObs[ndxK].theAcqNdx];
+					Mat66 const uMat{ jOri.transpose() * jOri };
+					Mat63 const wvInv{ wMats[ndxK] * pBlock.theInvV };
+					Vec6 const rhsK
+						{ jOri.transpose() * lins[ndxK].theRes
+						- wvInv * pBlock.theGrad
+						};
+					for (size_t ndxL{obsBeg} ; ndxL < obsEnd ; ++ndxL)
+					{
+						ColNdxs const & colsL
+							= theColNdxs[theObs[ndxL].theAcqNdx];
+						Mat66 sMat{ -wvInv * wMats[ndxL].transpose() };
+						if (ndxK == ndxL)
+						{
+							sMat += uMat;
+						}
+						for (size_t rr{0u} ; rr < 6u ; ++rr)
+						{
+							for (size_t cc{0u} ; cc < 6u ; ++cc)
+							{
+								if ( dat::isValid(colsK[rr])
+								  && dat::isValid(colsL[cc]))
+								{
+									ptPart->theTrips.emplace_back
+										(colsK[rr], colsL[cc], sMat(rr, cc));
+								}
+							}
+						}
+					}
+					for (size_t rr{0u} ; rr < 6u ; ++rr)
+					{
+						if (dat::isValid(colsK[rr]))
+						{
+							ptPart->theRhs(colsK[rr]) += rhsK(rr);
+							ptPart->theDiag(colsK[rr]) += uMat(rr, rr);
+						}
+					}
+				}
+			}
+			};
+		std::map<size_t, PartSystem> parts;
+		std::mutex partMutex;
+		sys::job::processRanges
+			( numPnts
+			, [&] (size_t const & pntBeg, size_t const & pntEnd)
+				{
+					PartSystem part;
+					part.theRhs = Eigen::VectorXd::Zero(theNumCols);
+					part.theDiag = Eigen::VectorXd::Zero(theNumCols);
+					for (size_t pNdx{pntBeg} ; pNdx < pntEnd ; ++pNdx)
+					{
+						addPoint(pNdx, &part);
+					}
+					std::lock_guard<std::mutex> const lock(partMutex);
+					parts[pntBeg] = std::move(part);
+				}
+			, numJobs
+			);
+
+		// merge parts in point order (independent of thread timing)
+		std::vector<Triplet> trips;
+		Eigen::VectorXd rhs{ Eigen::VectorXd::Zero(theNumCols) };
+		Eigen::VectorXd diag{ Eigen::VectorXd::Zero(theNumCols) };
+		for (std::pair<size_t const, PartSystem> const & part : parts)
+		{
+			std::vector<Triplet> const & partTrips = part.second.theTrips;
+			trips.insert(trips.end(), partTrips.begin(), partTrips.end());
+			rhs += part.second.theRhs;
+			diag += part.second.theDiag;
+		}
+		parts.clear();
+		for (size_t col{0u} ; col < theNumCols ; ++col)
+		{
+			trips.emplace_back(col, col, lambda * diag(col));
+		}
+
+		// solve for orientation corrections
+		Eigen::VectorXd dCols{ Eigen::VectorXd::Zero(theNumCols) };
+		bool okay{ true };
+		if (0u < theNumCols)
+		{
+			SpMat normMat(theNumCols, theNumCols);
+			normMat.setFromTriplets(trips.begin(), trips.end());
+			trips.clear();
+			okay = solveReduced(normMat, rhs, method, &dCols);
+		}
+
+		double sumNext{ std::numeric_limits<double>::infinity() };
+		std::vector<ga::Rigid> nextOris(theOris);
+		std::vector<ga::Vector> nextPnts(thePnts);
+		if (okay)
+		{
+			for (size_t acqNdx{0u} ; acqNdx < numAcqs ; ++acqNdx)
+			{
+				Vec6 & dOri = dOris[acqNdx];
+				dOri = Vec6::Zero();
+				ColNdxs const & cols = theColNdxs[acqNdx];
+				bool anyFree{ false };
+				for (size_t prm{0u} ; prm < 6u ; ++prm)
+				{
+					if (dat::isValid(cols[prm]))
+					{
+						dOri(prm) = dCols(cols[prm]);
+						anyFree = true;
+					}
+				}
+				if (anyFree)
+				{
+					nextOris[acqNdx] = updated(theOris[acqNdx], dOri);
+				}
+			}
+
+			// back substitute for point corrections
+			sys::job::processRanges
+				( numPnts
+				, [&] (size_t const & pntBeg, size_t const & pntEnd)
+					{
+						for (size_t pNdx{pntBeg} ; pNdx < pntEnd ; ++pNdx)
+						{
+							PntBlock const & pBlock = pntBlocks[pNdx];
+							if (! pBlock.theIsValid)
+							{
+								continue;
+							}
+							size_t const obsBeg{ thePntBegs[pNdx] };
+							size_t const obsEnd{ thePntBegs[pNdx + 1u] };
+							Vec3 gPnt{ pBlock.theGrad };
+							for (size_t ndx{obsBeg} ; ndx < obsEnd ; ++ndx)
+							{
+								Vec6 const & dOri
+									= dOris[theObs[ndx].theAcqNdx];
+								gPnt -= wMats[ndx].transpose() * dOri;
+							}
+							Vec3 const dPnt{ pBlock.theInvV * gPnt };
+							cam::PntNdx const & pntNdx
+								= theObs[obsBeg].thePntNdx;
+							nextPnts[pntNdx] = updated(thePnts[pntNdx], dPnt);
+						}
+					}
+				, numJobs
+				);
+
+			sumNext = sumSquaresFor
+				(theObs, nextOris, nextPnts, theCamera, numJobs);
+		}
+
+		// accept or reject trial step
+		Iteration iter;
+		iter.theRmsPrev = rmsFor(sumPrev, numObs);
+		iter.theRmsNext = rmsFor(sumNext, numObs);
+		iter.theDamping = lambda;
+		iter.theAccepted = (sumNext < sumPrev);
+		iters.emplace_back(iter);
+		if (iter.theAccepted)
+		{
+			theOris.swap(nextOris);
+			thePnts.swap(nextPnts);
+			needLin = true;
+			lambda = std::max(.1 * lambda, 1.e-12);
+			bool const isConverged
+				{ (iter.theRmsPrev - iter.theRmsNext)
+					<= (relTol * iter.theRmsPrev)
+				};
+			sumPrev = sumNext;
+			if (isConverged)
+			{
+				break;
+			}
+		}
+		else
+		{
+			lambda *= 10.;
+			if (1.e12 < lambda)
+			{
+				break;
+			}
+		}
+	}
+
+	return iters;
+}
+
+std::string
+Bundle :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << std::endl;
+	}
+	if (isValid())
+	{
+		oss << dat::infoString(theObs.size(), "numObservations");
+		oss << std::endl;
+		oss << dat::infoString(thePntBegs.size() - 1u, "numPoints");
+		oss << std::endl;
+		oss << dat::infoString(theNumCols, "numOriParameters");
+		oss << std::endl;
+		oss << theCamera.infoString("camera");
+	}
+	else
+	{
+		oss << " <null>";
+	}
+	return oss.str();
+}
+
+} // blk
+
@@ -0,0 +1,210 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef blk_Bundle_INCL_
+#define blk_Bundle_INCL_
+
+/*! \file
+\brief Declarations for blk::Bundle
+*/
+
+
+#include "libcam/Camera.h"
+#include "libcam/XRefSpots.h"
+#include "libga/Rigid.h"
+#include "libsys/job.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+
+namespace blk
+{
+
+/*! \brief Simultaneous adjustment of exterior orientations and object points.
+
+Observations are the (image frame) spots of a cam::XRefSpots table.
+Each is modeled as camera.imageSpotFor(oriAcqWrtRef(pntInRef)) and all
+orientations and points are refined together (Levenberg-Marquardt).
+
+Normal equations are formed block-wise: each observation contributes a
+2x6 orientation Jacobian and a 2x3 point Jacobian, evaluated in parallel.
+Point blocks are eliminated by Schur complement so that only the sparse
+reduced orientation system is solved - via sparse Cholesky (LDLT) or via
+diagonally preconditioned conjugate gradient. Point corrections are then
+recovered by back substitution (again in parallel).
+
+Orientation corrections are (station offset, physical angle) with the
+angle applied on the "into" side (i.e. newPose = Pose(dAng) * oldPose).
+
+Datum: orientation of the first active acquisition is held fixed, and
+scale is fixed by holding the largest station component (relative to
+the first) of the active acquisition farthest from it.
+
+Only points with valid starting values and at least two observations
+from acquisitions with valid starting orientations are adjusted. Other
+points (and orientations not involved) are passed through unchanged.
+
+\par Example
+\dontinclude testblk/uBundle.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+class Bundle
+{
+
+public: // types
+
+	//! Method for solving the reduced (orientation) normal system
+	enum SolveMethod
+	{
+		  Cholesky //!< Sparse LDLT (falls back to ConjGrad if not PD)
+		, ConjGrad //!< Diagonal preconditioned conjugate gradient
+	};
+
+	//! Summary of one adjustment iteration
+	struct Iteration
+	{
+		double theRmsPrev{ dat::nullValue<double>() };
+		double theRmsNext{ dat::nullValue<double>() };
+		double theDamping{ dat::nullValue<double>() };
+		bool theAccepted{ false };
+
+		//! Descriptive information about this instance.
+		std::string
+		infoString
+			( std::string const & title = std::string()
+			) const;
+	};
+
+private:
+
+	//! Spot measurement of a point within an acquisition
+	struct Obs
+	{
+		cam::PntNdx thePntNdx;
+		cam::AcqNdx theAcqNdx;
+		dat::Spot theSpot;
+	};
+
+	//! Column indices (into reduced system) for orientation parameters
+	using ColNdxs = std::array<size_t, 6u>;
+
+	cam::Camera const theCamera{};
+	std::vector<ga::Rigid> theOris{};
+	std::vector<ga::Vector> thePnts{};
+
+	//! All adjustable observations - grouped (contiguously) by point
+	std::vector<Obs> theObs{};
+	//! Begin of each point group in theObs (plus final end)
+	std::vector<size_t> thePntBegs{};
+	//! Reduced system column for each acquisition parameter (null if fixed)
+	std::vector<ColNdxs> theColNdxs{};
+	size_t theNumCols{ 0u };
+
+public: // methods
+
+	//! default null constructor
+	Bundle
+		() = default;
+
+	//! Construct problem with starting values
+	explicit
+	Bundle
+		( cam::XRefSpots const & spotTab //!< image spots (not detector)
+		, cam::Camera const & camera
+		, std::vector<ga::Rigid> const & oriAcqWrtRefs
+			//!< one per acqNdx column in spotTab (null if unknown)
+		, std::vector<ga::Vector> const & pntInRefs
+			//!< one per pntNdx row in spotTab (null if unknown)
+		);
+
+	//! True if instance is valid (has something to adjust)
+	bool
+	isValid
+		() const;
+
+	//! Number of observations participating in adjustment
+	inline
+	size_t
+	numObservations
+		() const;
+
+	//! Number of (free) orientation parameters in reduced system
+	inline
+	size_t
+	numOriParameters
+		() const;
+
+	//! Current orientation estimates (1:1 with spotTab acqNdx)
+	inline
+	std::vector<ga::Rigid> const &
+	oriAcqWrtRefs
+		() const;
+
+	//! Current point estimates (1:1 with spotTab pntNdx)
+	inline
+	std::vector<ga::Vector> const &
+	pntInRefs
+		() const;
+
+	//! Root mean square (per coordinate) of current spot residuals
+	double
+	rmsResidual
+		( size_t const & numJobs = sys::job::defaultNumJobs()
+		) const;
+
+	/*! Refine orientations and points (updates internal estimates).
+	 *
+	 * Iterates until the relative decrease in rms residual is less than
+	 * relTol, or until maxIterations. Returns a record of each iteration.
+	 */
+	std::vector<Iteration>
+	adjust
+		( size_t const & maxIterations = 25u
+		, double const & relTol = 1.e-9
+		, SolveMethod const & method = Cholesky
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! Descriptive information about this instance.
+	std::string
+	infoString
+		( std::string const & title = std::string()
+		) const;
+
+}; // Bundle
+
+} // blk
+
+// Inline definitions
+#include "libblk/Bundle.inl"
+
+#endif // blk_Bundle_INCL_
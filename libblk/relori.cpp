@@ -0,0 +1,312 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Definitions for blk::relori
+*/
+
+
+#include "libblk/relori.h"
+
+#include "libdat/info.h"
+#include "libmath/math.h"
+#include "libro/sampcon.h"
+#include "libsys/time.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+
+namespace blk
+{
+namespace relori
+{
+
+bool
+PairStats :: isValid
+	() const
+{
+	return
+		(  dat::isValid(theEdgeKey.first)
+		&& dat::isValid(theEdgeKey.second)
+		);
+}
+
+bool
+PairStats :: isSolved
+	() const
+{
+	return (isValid() && (0u < theNumInliers));
+}
+
+std::string
+PairStats :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << " ";
+	}
+	if (isValid())
+	{
+		oss
+			<< dat::infoString(theEdgeKey.first, "acq1")
+			<< " " << dat::infoString(theEdgeKey.second, "acq2")
+			<< " " << dat::infoString(theNumCommon, "numCommon")
+			<< " " << dat::infoString(theNumInliers, "numInliers")
+			<< " " << dat::infoString(theRmsGap, "rmsGap")
+			<< " " << dat::infoString(theRunTime, "runTime")
+			;
+	}
+	else
+	{
+		oss << " <null>";
+	}
+	return oss.str();
+}
+
+namespace
+{
+	using AcqOverlap = cam::XRefSpots::AcqOverlap;
+
+	//! Random generator seed for pair - distinct and repeatable
+	inline
+	std::mt19937_64::result_type
+	randSeedFor
+		( size_t const & pairNdx
+		)
+	{
+		constexpr std::mt19937_64::result_type baseSeed{ 357u };
+		return (baseSeed + pairNdx);
+	}
+
+	//! Order in which to process overlaps: largest first (for balance)
+	std::vector<size_t>
+	largestFirst
+		( std::vector<AcqOverlap> const & overlaps
+		)
+	{
+		std::vector<size_t> order(overlaps.size());
+		std::iota(order.begin(), order.end(), 0u);
+		std::stable_sort
+			( order.begin(), order.end()
+			, [&overlaps]
+				( size_t const & ndxA
+				, size_t const & ndxB
+				)
+				{
+					return
+						( overlaps[ndxB].thePntNdxs.size()
+						< overlaps[ndxA].thePntNdxs.size()
+						);
+				}
+			);
+		return order;
+	}
+
+	//! Fill (reused) uvPairs with directions to common points
+	void
+	setDirections
+		( std::vector<ro::PairUV> * const & ptUVs
+		, AcqOverlap const & overlap
+		, cam::XRefSpots const & spots
+		, cam::Camera const & camera
+		)
+	{
+		ptUVs->clear();
+		for (cam::PntNdx const & pntNdx : overlap.thePntNdxs)
+		{
+			dat::Spot const & spot1 = spots(pntNdx, overlap.theAcqNdx1);
+			dat::Spot const & spot2 = spots(pntNdx, overlap.theAcqNdx2);
+			ptUVs->emplace_back
+				( camera.directionOf(spot1)
+				, camera.directionOf(spot2)
+				);
+		}
+	}
+}
+
+RelOriPool
+poolFor
+	( cam::XRefSpots const & spots
+	, cam::Camera const & camera
+	, ro::OriPair const & roPairNom
+	, size_t const & minCommonPoints
+	, double const & inlierGap
+	, std::vector<PairStats> * const & ptStats
+	, size_t const & numDraws
+	, size_t const & numJobs
+	)
+{
+	RelOriPool pool;
+
+	// sampcon requires at least one redundant measurement
+	constexpr size_t minNumForRO{ 6u };
+	std::vector<AcqOverlap> const overlaps
+		{ spots.acqPairsWithOverlap(std::max(minCommonPoints, minNumForRO)) };
+	size_t const numPairs{ overlaps.size() };
+	std::vector<PairStats> stats(numPairs);
+
+	if ((0u < numPairs) && (0u < numJobs))
+	{
+		std::vector<size_t> const order{ largestFirst(overlaps) };
+		std::atomic<size_t> nextNdx{ 0u };
+		std::mutex poolMutex;
+
+		// each job pulls pairs (largest remaining first) until none left
+		size_t const useJobs{ std::min(numJobs, numPairs) };
+		sys::job::processRanges
+			( useJobs
+			, [&]
+				( size_t const & // jobBeg
+				, size_t const & // jobEnd
+				)
+				{
+					// per-job scratch - capacity reused across pairs
+					std::vector<ro::PairUV> uvPairs;
+					size_t nn{ nextNdx++ };
+					while (nn < numPairs)
+					{
+						size_t const & pairNdx = order[nn];
+						AcqOverlap const & overlap = overlaps[pairNdx];
+						double const timeBeg{ sys::time::now() };
+
+						setDirections(&uvPairs, overlap, spots, camera);
+
+						// own generator - result independent of scheduling
+						std::mt19937_64 randGen(randSeedFor(pairNdx));
+						ro::QuintSoln const quintSoln
+							{ ro::sampcon::bySample
+								(&randGen, uvPairs, roPairNom, numDraws)
+							};
+
+						PairStats & stat = stats[pairNdx];
+						stat.theEdgeKey = EdgeKey
+							{ overlap.theAcqNdx1, overlap.theAcqNdx2 };
+						stat.theNumCommon = uvPairs.size();
+						if (quintSoln.isValid())
+						{
+							// evaluate fit to all common measurements
+							ro::Pair const & roPair
+								= *(quintSoln.theSoln.theRoPair);
+							double sumSq{ 0. };
+							for (ro::PairUV const & uvPair : uvPairs)
+							{
+								double const gap
+									{ roPair.tripleProductGap(uvPair) };
+								if (std::abs(gap) < inlierGap)
+								{
+									++stat.theNumInliers;
+									sumSq += math::sq(gap);
+								}
+							}
+							if (0u < stat.theNumInliers)
+							{
+								stat.theRmsGap = std::sqrt
+									(sumSq / double(stat.theNumInliers));
+
+								// stream result into pool
+								ga::Rigid const ori2w1{ roPair.rigid2w1() };
+								std::lock_guard<std::mutex> lock(poolMutex);
+								pool.theRelOriMap[stat.theEdgeKey] = ori2w1;
+							}
+						}
+						stat.theRunTime = sys::time::now() - timeBeg;
+
+						nn = nextNdx++;
+					}
+				}
+			, useJobs
+			);
+	}
+
+	if (ptStats)
+	{
+		*ptStats = stats;
+	}
+
+	return pool;
+}
+
+std::string
+infoString
+	( std::vector<PairStats> const & pairStats
+	, std::string const & title
+	)
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << std::endl;
+	}
+	size_t numSolved{ 0u };
+	size_t numCommon{ 0u };
+	size_t numInliers{ 0u };
+	double sumTime{ 0. };
+	double maxTime{ 0. };
+	for (PairStats const & stat : pairStats)
+	{
+		if (stat.isSolved())
+		{
+			++numSolved;
+		}
+		numCommon += stat.theNumCommon;
+		numInliers += stat.theNumInliers;
+		if (dat::isValid(stat.theRunTime))
+		{
+			sumTime += stat.theRunTime;
+			maxTime = std::max(maxTime, stat.theRunTime);
+		}
+	}
+	oss
+		<< dat::infoString(pairStats.size(), "numPairs")
+		<< std::endl
+		<< dat::infoString(numSolved, "numSolved")
+		<< std::endl
+		<< dat::infoString(numCommon, "numCommon")
+		<< std::endl
+		<< dat::infoString(numInliers, "numInliers")
+		<< std::endl
+		<< dat::infoString(sumTime, "sumTime")
+		<< std::endl
+		<< dat::infoString(maxTime, "maxTime")
+		;
+	return oss.str();
+}
+
+} // relori
+
+} // blk
+
@@ -0,0 +1,133 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef blk_relori_INCL_
+#define blk_relori_INCL_
+
+/*! \file
+\brief Declarations for blk::relori
+*/
+
+
+#include "libblk/blk.h"
+#include "libblk/RelOriPool.h"
+#include "libcam/Camera.h"
+#include "libcam/XRefSpots.h"
+#include "libro/ro.h"
+#include "libsys/job.h"
+
+#include <string>
+#include <vector>
+
+
+namespace blk
+{
+
+/*! \brief Relative orientation of all overlapping acquisition pairs.
+
+\par Example
+\dontinclude testblk/urelori.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+namespace relori
+{
+	//! Timing and fit statistics for RO of one acquisition pair
+	struct PairStats
+	{
+		//! Acquisition (node) indices (first < second)
+		EdgeKey theEdgeKey{ NullKey, NullKey };
+		//! Number of points measured in both acquisitions
+		size_t theNumCommon{ 0u };
+		//! Number of common points with tripleProductGap within tolerance
+		size_t theNumInliers{ 0u };
+		//! Root-mean-square gap over inliers
+		double theRmsGap{ dat::nullValue<double>() };
+		//! [sec] Elapsed time for solution of this pair
+		double theRunTime{ dat::nullValue<double>() };
+
+		//! True if instance is valid
+		bool
+		isValid
+			() const;
+
+		//! True if a relative orientation was determined for this pair
+		bool
+		isSolved
+			() const;
+
+		//! Descriptive information about this instance.
+		std::string
+		infoString
+			( std::string const & title = std::string()
+			) const;
+
+	}; // PairStats
+
+	/*! Relative orientations for acquisition pairs with enough overlap.
+	 *
+	 * Each pair with at least minCommonPoints (and not less than 6)
+	 * spot measurements in common is solved with ro::sampcon::bySample
+	 * using directions from camera. Pairs are processed concurrently
+	 * (largest number of common points first) and each successful
+	 * solution (rigid2w1 - with unit base) is added to the return pool.
+	 * Each pair draws from its own generator (seeded from the pair
+	 * index) so that results do not depend on numJobs.
+	 *
+	 * If ptStats is provided, it is set with an element for each pair
+	 * (in order of increasing EdgeKey) - including unsolved pairs.
+	 */
+	RelOriPool
+	poolFor
+		( cam::XRefSpots const & spots
+		, cam::Camera const & camera
+		, ro::OriPair const & roPairNom
+		, size_t const & minCommonPoints = { 8u }
+		, double const & inlierGap = { 1./1000. }
+		, std::vector<PairStats> * const & ptStats = nullptr
+		, size_t const & numDraws = { 640u }
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! Summary statistics (e.g. totals) for collection of pair stats
+	std::string
+	infoString
+		( std::vector<PairStats> const & pairStats
+		, std::string const & title = std::string()
+		);
+
+} // relori
+
+} // blk
+
+// Inline definitions
+// #include "libblk/relori.inl"
+
+#endif // blk_relori_INCL_
+
@@ -35,6 +35,7 @@
 #include "libcam/xref.h"
 
 #include "libga/ga.h"
+#include "libgeo/PointBatch.h"
 #include "libgeo/ProbRay.h"
 #include "libgeo/Ray.h"
 #include "libgeo/stats.h"
@@ -346,6 +347,42 @@ averagePoints
 	return avePnts;
 }
 
+std::vector<geo::si::PointSoln>
+pointSolutions
+	( XRefRays const & rayTab
+	, size_t const & minNumRays
+	, size_t const & numJobs
+	)
+{
+	size_t const numPnts{ rayTab.pntCapacity() };
+	size_t const numAcqs{ rayTab.acqCapacity() };
+	geo::si::PointBatch batch(numPnts);
+
+	// each point (row) accumulates into its own system
+	constexpr double rayWeight{ 1. };
+	sys::job::processRanges
+		( numPnts
+		, [&] (size_t const & ndxBeg, size_t const & ndxEnd)
+			{
+				for (cam::PntNdx pntNdx{ndxBeg} ; pntNdx < ndxEnd ; ++pntNdx)
+				{
+					for (cam::AcqNdx acqNdx{0u} ; acqNdx < numAcqs ; ++acqNdx)
+					{
+						geo::Ray const & ray = rayTab(pntNdx, acqNdx);
+						if (dat::isValid(ray))
+						{
+							batch.addWeightedRay
+								(pntNdx, geo::si::WRay{ rayWeight, ray });
+						}
+					}
+				}
+			}
+		, numJobs
+		);
+
+	return batch.pointSolutions(minNumRays, numJobs);
+}
+
 } // xref
 } // cam
 
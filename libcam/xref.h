@@ -36,6 +36,8 @@
 
 #include "libcam/XRefRays.h"
 #include "libcam/XRefDists.h"
+#include "libgeo/si.h"
+#include "libsys/job.h"
 
 #include <limits>
 
@@ -89,6 +91,19 @@ namespace xref
 			//!< Require at least this many valid rays per point
 		);
 
+	/*! Space intersection of (equally weighted) rays for all points.
+	 *
+	 * Normal systems are accumulated and solved concurrently via
+	 * geo::si::PointBatch. Points with fewer than minNumRays valid
+	 * rays have null solutions.
+	 */
+	std::vector<geo::si::PointSoln> // corresponds 1:1 with pntNdx rows
+	pointSolutions
+		( XRefRays const & rayTab
+		, size_t const & minNumRays = 2u
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
 } // xref
 
 } // cam
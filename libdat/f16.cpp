@@ -0,0 +1,215 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Definitions for dat::f16
+*/
+
+
+#include "libdat/f16.h"
+
+#if defined(__F16C__)
+#	include <immintrin.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+
+namespace
+{
+#	if defined(__F16C__)
+
+	static_assert
+		( sizeof(dat::f16_t) == sizeof(uint16_t)
+		, "f16_t must be stored as 16 bits"
+		);
+
+	//! Number of values converted per instruction
+	constexpr size_t sNumLane{ 8u };
+
+	//! Convert up to sNumLane values (via temporary buffers)
+	inline
+	void
+	halfsFromFloatsPartial
+		( float const * const & beg
+		, size_t const & num
+		, dat::f16_t * const & out
+		)
+	{
+		float tmpIn[sNumLane]{};
+		uint16_t tmpOut[sNumLane]{};
+		std::memcpy(tmpIn, beg, num * sizeof(float));
+		__m128i const halfs
+			{ _mm256_cvtps_ph
+				(_mm256_loadu_ps(tmpIn), _MM_FROUND_TO_NEAREST_INT)
+			};
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(tmpOut), halfs);
+		std::memcpy(out, tmpOut, num * sizeof(uint16_t));
+	}
+
+	//! Convert up to sNumLane values (via temporary buffers)
+	inline
+	void
+	floatsFromHalfsPartial
+		( dat::f16_t const * const & beg
+		, size_t const & num
+		, float * const & out
+		)
+	{
+		uint16_t tmpIn[sNumLane]{};
+		float tmpOut[sNumLane]{};
+		std::memcpy(tmpIn, beg, num * sizeof(uint16_t));
+		__m128i const halfs
+			{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(tmpIn)) };
+		_mm256_storeu_ps(tmpOut, _mm256_cvtph_ps(halfs));
+		std::memcpy(out, tmpOut, num * sizeof(float));
+	}
+
+#	endif
+}
+
+
+namespace dat
+{
+namespace f16
+{
+
+bool
+isAccelerated
+	()
+{
+#	if defined(__F16C__)
+	return true;
+#	else
+	return false;
+#	endif
+}
+
+void
+halfsFromFloats
+	( float const * const & beg
+	, float const * const & end
+	, f16_t * const & out
+	)
+{
+	if (beg && end && out && (beg < end))
+	{
+		size_t const numValues{ static_cast<size_t>(end - beg) };
+#		if defined(__F16C__)
+		size_t const numFull{ numValues - (numValues % sNumLane) };
+		for (size_t nn{0u} ; nn < numFull ; nn += sNumLane)
+		{
+			__m128i const halfs
+				{ _mm256_cvtps_ph
+					(_mm256_loadu_ps(beg + nn), _MM_FROUND_TO_NEAREST_INT)
+				};
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out + nn), halfs);
+		}
+		if (numFull < numValues)
+		{
+			halfsFromFloatsPartial
+				(beg + numFull, numValues - numFull, out + numFull);
+		}
+#		else
+		for (size_t nn{0u} ; nn < numValues ; ++nn)
+		{
+			out[nn] = half_float::half_cast<f16_t, std::round_to_nearest>
+				(beg[nn]);
+		}
+#		endif
+	}
+}
+
+void
+floatsFromHalfs
+	( f16_t const * const & beg
+	, f16_t const * const & end
+	, float * const & out
+	)
+{
+	if (beg && end && out && (beg < end))
+	{
+		size_t const numValues{ static_cast<size_t>(end - beg) };
+#		if defined(__F16C__)
+		size_t const numFull{ numValues - (numValues % sNumLane) };
+		for (size_t nn{0u} ; nn < numFull ; nn += sNumLane)
+		{
+			__m128i const halfs
+				{ _mm_loadu_si128
+					(reinterpret_cast<__m128i const *>(beg + nn))
+				};
+			_mm256_storeu_ps(out + nn, _mm256_cvtph_ps(halfs));
+		}
+		if (numFull < numValues)
+		{
+			floatsFromHalfsPartial
+				(beg + numFull, numValues - numFull, out + numFull);
+		}
+#		else
+		for (size_t nn{0u} ; nn < numValues ; ++nn)
+		{
+			out[nn] = static_cast<float>(beg[nn]);
+		}
+#		endif
+	}
+}
+
+dat::grid<f16_t>
+halfGridFor
+	( dat::grid<float> const & floatGrid
+	)
+{
+	dat::grid<f16_t> halfGrid;
+	if (floatGrid.isValid())
+	{
+		halfGrid = dat::grid<f16_t>(floatGrid.hwSize());
+		halfsFromFloats(floatGrid.begin(), floatGrid.end(), halfGrid.begin());
+	}
+	return halfGrid;
+}
+
+dat::grid<float>
+floatGridFor
+	( dat::grid<f16_t> const & halfGrid
+	)
+{
+	dat::grid<float> floatGrid;
+	if (halfGrid.isValid())
+	{
+		floatGrid = dat::grid<float>(halfGrid.hwSize());
+		floatsFromHalfs(halfGrid.begin(), halfGrid.end(), floatGrid.begin());
+	}
+	return floatGrid;
+}
+
+} // f16
+} // dat
+
@@ -0,0 +1,100 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef dat_f16_INCL_
+#define dat_f16_INCL_
+
+/*! \file
+\brief Declarations for dat::f16
+*/
+
+
+#include "libdat/grid.h"
+#include "libdat/types.h"
+
+
+namespace dat
+{
+
+/*! \brief Batch conversions between float and half (dat::f16_t) values.
+
+Conversions round to nearest. When compiled with F16C support
+(e.g. -mf16c) conversion uses hardware instructions (eight values
+at a time), else the exthalf library functions are used (which
+round exact ties away from zero rather than to even). Null (NaN)
+values remain null in both directions.
+
+\par Example
+\dontinclude testdat/uf16.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+namespace f16
+{
+	//! True if hardware (F16C) conversion is used
+	bool
+	isAccelerated
+		();
+
+	//! Half precision values for [beg,end) put into out[0,...)
+	void
+	halfsFromFloats
+		( float const * const & beg
+		, float const * const & end
+		, f16_t * const & out
+		);
+
+	//! Float values for [beg,end) put into out[0,...)
+	void
+	floatsFromHalfs
+		( f16_t const * const & beg
+		, f16_t const * const & end
+		, float * const & out
+		);
+
+	//! Half precision grid (null if floatGrid is null)
+	dat::grid<f16_t>
+	halfGridFor
+		( dat::grid<float> const & floatGrid
+		);
+
+	//! Float grid (null if halfGrid is null)
+	dat::grid<float>
+	floatGridFor
+		( dat::grid<f16_t> const & halfGrid
+		);
+}
+
+}
+
+// Inline definitions
+// #include "libdat/f16.inl"
+
+#endif // dat_f16_INCL_
+
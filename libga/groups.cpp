@@ -95,20 +95,27 @@ octaSpinors
 	return spins;
 }
 
-std::vector<ga::Spinor>
-spreadOfSpinors
-	()
+namespace
 {
-	static std::vector<ga::Spinor> spins;
-	if (spins.empty())
+	//! Identity followed by cube, tetrahedron and octahedron spinors
+	std::vector<ga::Spinor>
+	combinedSpinors
+		()
 	{
+		std::vector<ga::Spinor> spins;
+
 		static std::vector<ga::Spinor> const identity
 			{ ga::Spinor(1., ga::BiVector(0., 0., 0.))
 			};
 
-		static std::vector<ga::Spinor> const cube{ cubeSpinors() };
-		static std::vector<ga::Spinor> const tetrahedron{ tetraSpinors() };
-		static std::vector<ga::Spinor> const octahedron{ octaSpinors() };
+		std::vector<ga::Spinor> const cube{ cubeSpinors() };
+		std::vector<ga::Spinor> const tetrahedron{ tetraSpinors() };
+		std::vector<ga::Spinor> const octahedron{ octaSpinors() };
+
+		spins.reserve
+			( identity.size()
+			+ cube.size() + tetrahedron.size() + octahedron.size()
+			);
 
 		// 1 value
 		spins.insert(spins.end(), identity.begin(), identity.end());
@@ -118,8 +125,17 @@ spreadOfSpinors
 		spins.insert(spins.end(), tetrahedron.begin(), tetrahedron.end());
 		// 24 values
 		spins.insert(spins.end(), octahedron.begin(), octahedron.end());
+
+		return spins;
 	}
+}
 
+std::vector<ga::Spinor>
+spreadOfSpinors
+	()
+{
+	// initialized once - function-local statics are thread-safe (c++11)
+	static std::vector<ga::Spinor> const spins{ combinedSpinors() };
 	return spins;
 }
 
@@ -0,0 +1,234 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Definitions for geo::si::PointBatch
+*/
+
+
+#include "libgeo/PointBatch.h"
+
+#include "libdat/info.h"
+#include "libla/eigen.h"
+#include "libmath/math.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <sstream>
+
+
+namespace geo
+{
+namespace si
+{
+
+// explicit
+PointBatch :: PointBatch
+	( size_t const & numPoints
+	)
+	: theNormCos{}
+	, theNormRhss{}
+	, theNumObs(numPoints, 0u)
+{
+	for (std::vector<double> & normCo : theNormCos)
+	{
+		normCo.assign(numPoints, 0.);
+	}
+	for (std::vector<double> & normRhs : theNormRhss)
+	{
+		normRhs.assign(numPoints, 0.);
+	}
+}
+
+namespace
+{
+	//! Solution and (inverse weight) semi axes via 3x3 symmetric eigen
+	void
+	solveSystem
+		( Eigen::Matrix3d const & coMat
+		, Eigen::Vector3d const & rhs
+		, ga::Vector * const & ptLoc
+		, std::array<SemiAxis, 3u> * const & ptAxes
+		)
+	{
+		// closed form decomposition - eigenvalues in increasing order
+		Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eig;
+		eig.computeDirect(coMat);
+		Eigen::Vector3d const & eVals = eig.eigenvalues();
+		Eigen::Matrix3d const & eVecs = eig.eigenvectors();
+
+		// pseudo inverse solution (rank threshold as for Eigen SVD)
+		double const maxVal{ std::max(eVals(2), 0.) };
+		double const tol
+			{ 3. * std::numeric_limits<double>::epsilon() * maxVal };
+		Eigen::Vector3d soln{ Eigen::Vector3d::Zero() };
+		for (int kk{0} ; kk < 3 ; ++kk)
+		{
+			if (tol < eVals(kk))
+			{
+				soln += (eVecs.col(kk).dot(rhs) / eVals(kk)) * eVecs.col(kk);
+			}
+		}
+		*ptLoc = ga::Vector(soln(0), soln(1), soln(2));
+
+		// standard ellipsoid axes - largest weight (smallest axis) first
+		for (int kk{0} ; kk < 3 ; ++kk)
+		{
+			int const eNdx{ 2 - kk };
+			double const wMag{ std::sqrt(std::max(eVals(eNdx), 0.)) };
+			double invMag{ dat::nullValue<double>() };
+			if (math::eps < wMag)
+			{
+				invMag = 1. / wMag;
+			}
+			ga::Vector const dir
+				(eVecs(0, eNdx), eVecs(1, eNdx), eVecs(2, eNdx));
+			(*ptAxes)[size_t(kk)] = SemiAxis{ invMag, dir };
+		}
+	}
+
+	//! Solve the ndx-th system from structure of array storage
+	void
+	solveSystemAt
+		( std::array<std::vector<double>, 6u> const & normCos
+		, std::array<std::vector<double>, 3u> const & normRhss
+		, size_t const & ndx
+		, ga::Vector * const & ptLoc
+		, std::array<SemiAxis, 3u> * const & ptAxes
+		)
+	{
+		double const & xx = normCos[0][ndx];
+		double const & xy = normCos[1][ndx];
+		double const & xz = normCos[2][ndx];
+		double const & yy = normCos[3][ndx];
+		double const & yz = normCos[4][ndx];
+		double const & zz = normCos[5][ndx];
+		Eigen::Matrix3d coMat;
+		coMat
+			<< xx, xy, xz
+			,  xy, yy, yz
+			,  xz, yz, zz
+			;
+		Eigen::Vector3d const rhs
+			(normRhss[0][ndx], normRhss[1][ndx], normRhss[2][ndx]);
+		solveSystem(coMat, rhs, ptLoc, ptAxes);
+	}
+
+	//! Solution with null values
+	PointSoln
+	nullPointSoln
+		()
+	{
+		SemiAxis const nullAxis{ dat::nullValue<double>(), ga::Vector{} };
+		return PointSoln{ ga::Vector{}, {{ nullAxis, nullAxis, nullAxis }} };
+	}
+}
+
+PointSoln
+PointBatch :: pointSolution
+	( size_t const & pntNdx
+	) const
+{
+	ga::Vector loc;
+	std::array<SemiAxis, 3u> axes;
+	solveSystemAt(theNormCos, theNormRhss, pntNdx, &loc, &axes);
+	return PointSoln{ loc, axes };
+}
+
+std::vector<PointSoln>
+PointBatch :: pointSolutions
+	( size_t const & minNumObs
+	, size_t const & numJobs
+	) const
+{
+	std::vector<PointSoln> solns;
+	size_t const numPnts{ size() };
+
+	// solve concurrently into assignable (SoA) storage
+	std::vector<ga::Vector> locs(numPnts);
+	std::vector<std::array<SemiAxis, 3u> > axes(numPnts);
+	sys::job::processRanges
+		( numPnts
+		, [&] (size_t const & ndxBeg, size_t const & ndxEnd)
+			{
+				for (size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+				{
+					if (minNumObs <= theNumObs[ndx])
+					{
+						solveSystemAt
+							( theNormCos, theNormRhss, ndx
+							, &(locs[ndx]), &(axes[ndx])
+							);
+					}
+				}
+			}
+		, numJobs
+		);
+
+	// package results
+	solns.reserve(numPnts);
+	PointSoln const nullSoln{ nullPointSoln() };
+	for (size_t ndx{0u} ; ndx < numPnts ; ++ndx)
+	{
+		if (minNumObs <= theNumObs[ndx])
+		{
+			solns.emplace_back(PointSoln{ locs[ndx], axes[ndx] });
+		}
+		else
+		{
+			solns.emplace_back(nullSoln);
+		}
+	}
+	return solns;
+}
+
+std::string
+PointBatch :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << " ";
+	}
+	oss << dat::infoString(size(), "numPoints");
+	if (! theNumObs.empty())
+	{
+		size_t const numObs
+			{ std::accumulate(theNumObs.begin(), theNumObs.end(), size_t{0u}) };
+		oss << " " << dat::infoString(numObs, "numObs");
+	}
+	return oss.str();
+}
+
+} // si
+} // geo
+
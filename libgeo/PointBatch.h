@@ -0,0 +1,153 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef geo_PointBatch_INCL_
+#define geo_PointBatch_INCL_
+
+/*! \file
+\brief Declarations for geo::si::PointBatch
+*/
+
+
+#include "libgeo/si.h"
+#include "libsys/job.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+
+namespace geo
+{
+namespace si
+{
+
+/*! \brief Normal equation systems for many points (structure of arrays).
+
+Equivalent to a collection of PointSystem instances, but with the
+(symmetric) normal coefficients and right hand sides for all points
+stored in separate contiguous arrays. Each point system is solved with
+a closed form 3x3 symmetric eigen decomposition (instead of general SVD)
+and the collection is solved concurrently.
+
+\par Example
+\dontinclude testgeo/uPointBatch.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+class PointBatch
+{
+	//! Upper triangle of normal matrices: (xx, xy, xz, yy, yz, zz)
+	std::array<std::vector<double>, 6u> theNormCos{};
+	//! Normal system right hand sides: (x, y, z)
+	std::array<std::vector<double>, 3u> theNormRhss{};
+	//! Number of observations (rays plus planes) for each point
+	std::vector<size_t> theNumObs{};
+
+private: // methods
+
+	//! Incorporate weighted dyadic into pntNdx-th system
+	inline
+	void
+	addWeightedDyadic
+		( size_t const & pntNdx
+		, double const & weightSq
+		, Dyadic const & obsDyadic
+		, ga::Vector const & vec
+		);
+
+public: // methods
+
+	//! Empty batch
+	PointBatch
+		() = default;
+
+	//! Batch of numPoints systems - all zeroed
+	explicit
+	PointBatch
+		( size_t const & numPoints
+		);
+
+	//! Number of point systems in batch
+	inline
+	size_t
+	size
+		() const;
+
+	//! Number of observations incorporated into pntNdx-th system
+	inline
+	size_t
+	numObservations
+		( size_t const & pntNdx
+		) const;
+
+	//! Incorporate weighted ray observation into pntNdx-th system
+	inline
+	void
+	addWeightedRay
+		( size_t const & pntNdx
+		, WRay const & wray
+		);
+
+	//! Incorporate weighted plane observation into pntNdx-th system
+	inline
+	void
+	addWeightedPlane
+		( size_t const & pntNdx
+		, WPlane const & wplane
+		);
+
+	//! Least squares solution for pntNdx-th system (same as PointSystem)
+	PointSoln
+	pointSolution
+		( size_t const & pntNdx
+		) const;
+
+	//! Solutions for all systems (null for those with < minNumObs)
+	std::vector<PointSoln>
+	pointSolutions
+		( size_t const & minNumObs = 2u
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		) const;
+
+	//! Descriptive information about this instance
+	std::string
+	infoString
+		( std::string const & title = {}
+		) const;
+
+}; // PointBatch
+
+} // si
+} // geo
+
+// Inline definitions
+#include "libgeo/PointBatch.inl"
+
+#endif // geo_PointBatch_INCL_
@@ -0,0 +1,117 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Inline definitions for geo::si::PointBatch
+*/
+
+
+namespace geo
+{
+namespace si
+{
+
+inline
+void
+PointBatch :: addWeightedDyadic
+	( size_t const & pntNdx
+	, double const & weightSq
+	, Dyadic const & obsDyadic
+	, ga::Vector const & vec
+	)
+{
+	// symmetric: accumulate upper triangle only
+	theNormCos[0][pntNdx] += weightSq * obsDyadic[0];
+	theNormCos[1][pntNdx] += weightSq * obsDyadic[1];
+	theNormCos[2][pntNdx] += weightSq * obsDyadic[2];
+	theNormCos[3][pntNdx] += weightSq * obsDyadic[4];
+	theNormCos[4][pntNdx] += weightSq * obsDyadic[5];
+	theNormCos[5][pntNdx] += weightSq * obsDyadic[8];
+
+	double const & v0 = vec[0];
+	double const & v1 = vec[1];
+	double const & v2 = vec[2];
+	theNormRhss[0][pntNdx]
+		+= (weightSq * (obsDyadic[0]*v0 + obsDyadic[1]*v1 + obsDyadic[2]*v2));
+	theNormRhss[1][pntNdx]
+		+= (weightSq * (obsDyadic[3]*v0 + obsDyadic[4]*v1 + obsDyadic[5]*v2));
+	theNormRhss[2][pntNdx]
+		+= (weightSq * (obsDyadic[6]*v0 + obsDyadic[7]*v1 + obsDyadic[8]*v2));
+
+	++theNumObs[pntNdx];
+}
+
+inline
+size_t
+PointBatch :: size
+	() const
+{
+	return theNumObs.size();
+}
+
+inline
+size_t
+PointBatch :: numObservations
+	( size_t const & pntNdx
+	) const
+{
+	return theNumObs[pntNdx];
+}
+
+inline
+void
+PointBatch :: addWeightedRay
+	( size_t const & pntNdx
+	, WRay const & wray
+	)
+{
+	geo::Ray const & ray = wray.second;
+	addWeightedDyadic
+		(pntNdx, math::sq(wray.first), rayDyadicFor(ray.theDir), ray.theStart);
+}
+
+inline
+void
+PointBatch :: addWeightedPlane
+	( size_t const & pntNdx
+	, WPlane const & wplane
+	)
+{
+	geo::Plane const & plane = wplane.second;
+	addWeightedDyadic
+		( pntNdx
+		, math::sq(wplane.first)
+		, planeDyadicFor(plane.unitNormal())
+		, plane.origin()
+		);
+}
+
+} // si
+} // geo
+
@@ -0,0 +1,350 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Definitions for img::io::AsyncWriter
+*/
+
+
+#include "libimg/AsyncWriter.h"
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <utility>
+
+
+namespace img
+{
+namespace io
+{
+
+namespace
+{
+	//! Task that applies saveFunc to an (owned) grid
+	template <typename PixType, typename SaveFunc>
+	inline
+	AsyncWriter::Task
+	gridTask
+		( dat::grid<PixType> && grid
+		, SaveFunc const & saveFunc
+		)
+	{
+		// std::function requires copyable, so share (not copy) the grid
+		std::shared_ptr<dat::grid<PixType> > const ptGrid
+			{ std::make_shared<dat::grid<PixType> >(std::move(grid)) };
+		return [ptGrid, saveFunc] () { return saveFunc(*ptGrid); };
+	}
+}
+
+constexpr size_t AsyncWriter::sDefaultMaxBytes;
+
+// explicit
+AsyncWriter :: AsyncWriter
+	( size_t const & numThreads
+	, size_t const & maxBytesPending
+	)
+	: theMaxBytes{ maxBytesPending }
+	, theMutex{}
+	, theWorkCV{}
+	, theDoneCV{}
+	, theRequests{}
+	, theBytesPending{ 0u }
+	, theNumActive{ 0u }
+	, theNumWritten{ 0u }
+	, theNumFailed{ 0u }
+	, theIsStopping{ false }
+	, theThreads{}
+{
+	size_t const useThreads{ std::max(numThreads, size_t{ 1u }) };
+	theThreads.reserve(useThreads);
+	for (size_t nn{0u} ; nn < useThreads ; ++nn)
+	{
+		theThreads.emplace_back(&AsyncWriter::runLoop, this);
+	}
+}
+
+AsyncWriter :: ~AsyncWriter
+	()
+{
+	{
+		std::lock_guard<std::mutex> lock(theMutex);
+		theIsStopping = true;
+	}
+	theWorkCV.notify_all();
+	theDoneCV.notify_all();
+	for (std::thread & thread : theThreads)
+	{
+		thread.join();
+	}
+}
+
+bool
+AsyncWriter :: enqueue
+	( Task const & task
+	, size_t const & numBytes
+	)
+{
+	bool added{ false };
+	if (task)
+	{
+		std::unique_lock<std::mutex> lock(theMutex);
+		// backpressure: wait for room (always room if nothing pending)
+		theDoneCV.wait
+			( lock
+			, [this, &numBytes] ()
+				{
+					return
+						(  theIsStopping
+						|| (0u == theBytesPending)
+						|| ((theBytesPending + numBytes) <= theMaxBytes)
+						);
+				}
+			);
+		if (! theIsStopping)
+		{
+			theRequests.emplace_back(Request{ task, numBytes });
+			theBytesPending += numBytes;
+			added = true;
+		}
+	}
+	if (added)
+	{
+		theWorkCV.notify_one();
+	}
+	return added;
+}
+
+bool
+AsyncWriter :: saveJpg
+	( dat::grid<std::array<uint8_t, 3u> > && rgbGrid
+	, std::string const & fpath
+	, size_t const & qualPercent
+	)
+{
+	size_t const numBytes{ rgbGrid.byteSize() };
+	return enqueue
+		( gridTask
+			( std::move(rgbGrid)
+			, [fpath, qualPercent]
+				(dat::grid<std::array<uint8_t, 3u> > const & grid)
+				{ return img::io::saveJpg(grid, fpath, qualPercent); }
+			)
+		, numBytes
+		);
+}
+
+bool
+AsyncWriter :: savePng
+	( dat::grid<uint8_t> && ugrid
+	, std::string const & fpath
+	)
+{
+	size_t const numBytes{ ugrid.byteSize() };
+	return enqueue
+		( gridTask
+			( std::move(ugrid)
+			, [fpath] (dat::grid<uint8_t> const & grid)
+				{ return img::io::savePng(grid, fpath); }
+			)
+		, numBytes
+		);
+}
+
+bool
+AsyncWriter :: savePng
+	( dat::grid<std::array<uint8_t, 3u> > && rgbGrid
+	, std::string const & fpath
+	)
+{
+	size_t const numBytes{ rgbGrid.byteSize() };
+	return enqueue
+		( gridTask
+			( std::move(rgbGrid)
+			, [fpath] (dat::grid<std::array<uint8_t, 3u> > const & grid)
+				{ return img::io::savePng(grid, fpath); }
+			)
+		, numBytes
+		);
+}
+
+bool
+AsyncWriter :: savePgmAutoScale
+	( dat::grid<float> && fgrid
+	, std::string const & fpath
+	)
+{
+	size_t const numBytes{ fgrid.byteSize() };
+	return enqueue
+		( gridTask
+			( std::move(fgrid)
+			, [fpath] (dat::grid<float> const & grid)
+				{ return img::io::savePgmAutoScale(grid, fpath); }
+			)
+		, numBytes
+		);
+}
+
+bool
+AsyncWriter :: saveToFloat
+	( dat::grid<float> && fgrid
+	, std::string const & fpath
+	)
+{
+	size_t const numBytes{ fgrid.byteSize() };
+	return enqueue
+		( gridTask
+			( std::move(fgrid)
+			, [fpath] (dat::grid<float> const & grid)
+				{ return img::io::saveToFloat(grid, fpath); }
+			)
+		, numBytes
+		);
+}
+
+bool
+AsyncWriter :: saveText
+	( std::string && text
+	, std::string const & fpath
+	)
+{
+	size_t const numBytes{ text.size() };
+	std::shared_ptr<std::string> const ptText
+		{ std::make_shared<std::string>(std::move(text)) };
+	return enqueue
+		( [ptText, fpath] ()
+			{
+				std::ofstream ofs(fpath, std::ios::binary);
+				ofs.write
+					( ptText->data()
+					, static_cast<std::streamsize>(ptText->size())
+					);
+				return (! ofs.fail());
+			}
+		, numBytes
+		);
+}
+
+void
+AsyncWriter :: flush
+	()
+{
+	std::unique_lock<std::mutex> lock(theMutex);
+	theDoneCV.wait
+		( lock
+		, [this] ()
+			{ return (theRequests.empty() && (0u == theNumActive)); }
+		);
+}
+
+size_t
+AsyncWriter :: numWritten
+	() const
+{
+	std::lock_guard<std::mutex> lock(theMutex);
+	return theNumWritten;
+}
+
+size_t
+AsyncWriter :: numFailed
+	() const
+{
+	std::lock_guard<std::mutex> lock(theMutex);
+	return theNumFailed;
+}
+
+std::string
+AsyncWriter :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << " ";
+	}
+	std::lock_guard<std::mutex> lock(theMutex);
+	oss << "numThreads: " << theThreads.size()
+		<< " numQueued: " << theRequests.size()
+		<< " numActive: " << theNumActive
+		<< " bytesPending: " << theBytesPending
+		<< " numWritten: " << theNumWritten
+		<< " numFailed: " << theNumFailed
+		;
+	return oss.str();
+}
+
+void
+AsyncWriter :: runLoop
+	()
+{
+	for (;;)
+	{
+		Request request;
+		{
+			std::unique_lock<std::mutex> lock(theMutex);
+			theWorkCV.wait
+				( lock
+				, [this] ()
+					{ return (theIsStopping || (! theRequests.empty())); }
+				);
+			if (theRequests.empty())
+			{
+				break; // stopping and nothing left to do
+			}
+			request = std::move(theRequests.front());
+			theRequests.pop_front();
+			++theNumActive;
+		}
+
+		// encode and write outside of lock
+		bool const okay{ request.theTask() };
+		request.theTask = nullptr; // release data before accounting
+
+		{
+			std::lock_guard<std::mutex> lock(theMutex);
+			--theNumActive;
+			theBytesPending -= request.theNumBytes;
+			if (okay)
+			{
+				++theNumWritten;
+			}
+			else
+			{
+				++theNumFailed;
+			}
+		}
+		theDoneCV.notify_all();
+	}
+}
+
+} // io
+} // img
+
@@ -0,0 +1,222 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef img_AsyncWriter_INCL_
+#define img_AsyncWriter_INCL_
+
+/*! \file
+\brief Declarations for img::io::AsyncWriter
+*/
+
+
+#include "libdat/grid.h"
+#include "libimg/io.h"
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace img
+{
+namespace io
+{
+
+/*! \brief Background encoding and writing of image (and other) files.
+
+Save requests take ownership of their data (by move) and return
+immediately. Encoding and file output run on a small dedicated pool
+of threads. The bytes held by pending requests are limited: a
+request blocks (its caller waits) while the limit is exceeded. The
+flush() method waits until all prior requests are complete.
+
+Requests are independent: with more than one thread, files may be
+completed in an order other than submission.
+
+\par Example
+\dontinclude testimg/uAsyncWriter.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+class AsyncWriter
+{
+
+public: // types
+
+	//! Operation that writes (owned) data - returns true on success
+	using Task = std::function<bool()>;
+
+private: // types
+
+	//! Queued operation and memory accounted to it
+	struct Request
+	{
+		Task theTask;
+		size_t theNumBytes;
+	};
+
+private: // data
+
+	size_t const theMaxBytes;
+
+	mutable std::mutex theMutex;
+	std::condition_variable theWorkCV; //!< request queued (or stopping)
+	std::condition_variable theDoneCV; //!< request finished
+	std::deque<Request> theRequests;
+	size_t theBytesPending; //!< queued or in progress
+	size_t theNumActive; //!< requests in progress
+	size_t theNumWritten;
+	size_t theNumFailed;
+	bool theIsStopping;
+
+	std::vector<std::thread> theThreads;
+
+public: // static methods
+
+	//! Default limit on bytes held by pending requests
+	static constexpr size_t sDefaultMaxBytes{ 256u * 1024u * 1024u };
+
+private: // disable
+
+	//! Disable implicit copy and assignment
+	AsyncWriter(AsyncWriter const &) = delete;
+	AsyncWriter & operator=(AsyncWriter const &) = delete;
+
+public: // methods
+
+	//! Start numThreads writer threads
+	explicit
+	AsyncWriter
+		( size_t const & numThreads = { 1u }
+		, size_t const & maxBytesPending = sDefaultMaxBytes
+		);
+
+	//! Complete all pending requests and stop threads
+	~AsyncWriter
+		();
+
+	/*! Queue a general task (which should own its data).
+	 *
+	 * The numBytes value is used for the pending bytes limit. A
+	 * request larger than the limit is allowed when nothing else
+	 * is pending. Returns false if writer is stopping.
+	 */
+	bool
+	enqueue
+		( Task const & task
+		, size_t const & numBytes
+		);
+
+	//! Queue io::saveJpg() for grid
+	bool
+	saveJpg
+		( dat::grid<std::array<uint8_t, 3u> > && rgbGrid
+		, std::string const & fpath
+		, size_t const & qualPercent = { 80u }
+		);
+
+	//! Queue io::savePng() for grid
+	bool
+	savePng
+		( dat::grid<uint8_t> && ugrid
+		, std::string const & fpath
+		);
+
+	//! Queue io::savePng() for grid
+	bool
+	savePng
+		( dat::grid<std::array<uint8_t, 3u> > && rgbGrid
+		, std::string const & fpath
+		);
+
+	//! Queue io::savePgmAutoScale() for grid
+	bool
+	savePgmAutoScale
+		( dat::grid<float> && fgrid
+		, std::string const & fpath
+		);
+
+	//! Queue io::saveToFloat() for grid
+	bool
+	saveToFloat
+		( dat::grid<float> && fgrid
+		, std::string const & fpath
+		);
+
+	//! Queue write of text content (e.g. formatted scores) to fpath
+	bool
+	saveText
+		( std::string && text
+		, std::string const & fpath
+		);
+
+	//! Wait until all requests made before this call are complete
+	void
+	flush
+		();
+
+	//! Number of completed requests that succeeded
+	size_t
+	numWritten
+		() const;
+
+	//! Number of completed requests that failed
+	size_t
+	numFailed
+		() const;
+
+	//! Descriptive information about this instance.
+	std::string
+	infoString
+		( std::string const & title = std::string()
+		) const;
+
+private:
+
+	//! Thread operation: run requests until stopping (and queue empty)
+	void
+	runLoop
+		();
+
+}; // AsyncWriter
+
+} // io
+} // img
+
+// Inline definitions
+// #include "libimg/AsyncWriter.inl"
+
+#endif // img_AsyncWriter_INCL_
+
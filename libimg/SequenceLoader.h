@@ -0,0 +1,193 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef img_SequenceLoader_INCL_
+#define img_SequenceLoader_INCL_
+
+/*! \file
+\brief Declarations for img::io::SequenceLoader
+*/
+
+
+#include "libdat/grid.h"
+#include "libimg/io.h"
+#include "libmem/BoundedQueue.h"
+
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace img
+{
+namespace io
+{
+
+/*! \brief Background (prefetching) loader for a sequence of image files.
+
+Images are decoded ahead of use by background threads and are provided
+by nextGrid() in the same order as the construction paths. Decoding
+is limited by both the number of images held ahead (queue capacity)
+and by (approximately - to within one image per thread) the number
+of bytes held ahead.
+
+The decoder is any function (e.g. img::io::loadFromJpgRgb8) that
+returns a grid for a path - and must be safe to call concurrently
+if more than one thread is used.
+
+\par Example
+\dontinclude testimg/uSequenceLoader.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+template <typename PixType>
+class SequenceLoader
+{
+
+public: // types
+
+	using Grid = dat::grid<PixType>;
+	using Decoder = std::function<Grid(std::string const & fpath)>;
+
+private: // types
+
+	//! Decoded image and its position in sequence
+	struct Item
+	{
+		size_t theNdx;
+		Grid theGrid;
+	};
+
+private: // data
+
+	std::vector<std::string> const thePaths;
+	Decoder const theDecoder;
+	size_t const theMaxBytes;
+	mem::BoundedQueue<Item> theQueue;
+
+	std::mutex theMutex;
+	std::condition_variable theStateCV;
+	size_t theNextDecode; //!< Next index to be claimed by a decoder
+	size_t theNextQueue; //!< Next index allowed into queue (in order)
+	size_t theBytesAhead; //!< Decoded but not yet consumed
+	bool theIsStopping;
+
+	size_t theNextOut; //!< Next index to provide to consumer
+	std::vector<std::thread> theThreads;
+
+private: // disable
+
+	//! Disable implicit copy and assignment
+	SequenceLoader(SequenceLoader const &) = delete;
+	SequenceLoader & operator=(SequenceLoader const &) = delete;
+
+public: // methods
+
+	//! Start background decoding of fpaths (in order)
+	inline
+	explicit
+	SequenceLoader
+		( std::vector<std::string> const & fpaths
+		, Decoder const & decoder
+		, size_t const & maxAhead = { 4u } //!< Max images in queue
+		, size_t const & maxBytesAhead = std::numeric_limits<size_t>::max()
+		, size_t const & numThreads = { 2u }
+		);
+
+	//! Stop background decoding (without consuming remaining images)
+	inline
+	~SequenceLoader
+		();
+
+	//! True if instance is valid
+	inline
+	bool
+	isValid
+		() const;
+
+	//! Number of paths in sequence
+	inline
+	size_t
+	size
+		() const;
+
+	/*! Next image in sequence (blocks until available) - false at end.
+	 *
+	 * The grid is null if the decoder failed for that path.
+	 */
+	inline
+	bool
+	nextGrid
+		( Grid * const & ptGrid
+		, size_t * const & ptNdx = nullptr //!< Index into construction paths
+		);
+
+	//! Stop background decoding (e.g. before end of sequence)
+	inline
+	void
+	stop
+		();
+
+	//! Descriptive information about this instance.
+	inline
+	std::string
+	infoString
+		( std::string const & title = std::string()
+		) const;
+
+private:
+
+	//! Background thread operations: decode and queue (in order)
+	inline
+	void
+	decodeLoop
+		();
+
+	//! Memory accounted for grid
+	inline
+	static
+	size_t
+	byteSizeOf
+		( Grid const & grid
+		);
+
+}; // SequenceLoader
+
+} // io
+} // img
+
+// Inline definitions
+#include "libimg/SequenceLoader.inl"
+
+#endif // img_SequenceLoader_INCL_
+
@@ -0,0 +1,258 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Inline definitions for img::io::SequenceLoader
+*/
+
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+
+namespace img
+{
+namespace io
+{
+
+template <typename PixType>
+inline
+// explicit
+SequenceLoader<PixType> :: SequenceLoader
+	( std::vector<std::string> const & fpaths
+	, Decoder const & decoder
+	, size_t const & maxAhead
+	, size_t const & maxBytesAhead
+	, size_t const & numThreads
+	)
+	: thePaths(fpaths)
+	, theDecoder(decoder)
+	, theMaxBytes(maxBytesAhead)
+	, theQueue(maxAhead)
+	, theMutex()
+	, theStateCV()
+	, theNextDecode(0u)
+	, theNextQueue(0u)
+	, theBytesAhead(0u)
+	, theIsStopping(false)
+	, theNextOut(0u)
+	, theThreads()
+{
+	if (theDecoder)
+	{
+		size_t const useThreads
+			{ std::min(std::max(numThreads, size_t(1u)), thePaths.size()) };
+		theThreads.reserve(useThreads);
+		for (size_t nn{0u} ; nn < useThreads ; ++nn)
+		{
+			theThreads.emplace_back(&SequenceLoader::decodeLoop, this);
+		}
+	}
+}
+
+template <typename PixType>
+inline
+SequenceLoader<PixType> :: ~SequenceLoader
+	()
+{
+	stop();
+}
+
+template <typename PixType>
+inline
+bool
+SequenceLoader<PixType> :: isValid
+	() const
+{
+	return static_cast<bool>(theDecoder);
+}
+
+template <typename PixType>
+inline
+size_t
+SequenceLoader<PixType> :: size
+	() const
+{
+	return thePaths.size();
+}
+
+template <typename PixType>
+inline
+bool
+SequenceLoader<PixType> :: nextGrid
+	( Grid * const & ptGrid
+	, size_t * const & ptNdx
+	)
+{
+	bool got{ false };
+	if (isValid() && ptGrid && (theNextOut < thePaths.size()))
+	{
+		Item item;
+		if (theQueue.pop(&item))
+		{
+			// release memory budget for decoders
+			{
+				std::lock_guard<std::mutex> lock(theMutex);
+				theBytesAhead -= byteSizeOf(item.theGrid);
+			}
+			theStateCV.notify_all();
+
+			*ptGrid = std::move(item.theGrid);
+			if (ptNdx)
+			{
+				*ptNdx = item.theNdx;
+			}
+			++theNextOut;
+			got = true;
+		}
+	}
+	return got;
+}
+
+template <typename PixType>
+inline
+void
+SequenceLoader<PixType> :: stop
+	()
+{
+	{
+		std::lock_guard<std::mutex> lock(theMutex);
+		theIsStopping = true;
+	}
+	theStateCV.notify_all();
+	theQueue.close();
+	for (std::thread & thread : theThreads)
+	{
+		if (thread.joinable())
+		{
+			thread.join();
+		}
+	}
+}
+
+template <typename PixType>
+inline
+std::string
+SequenceLoader<PixType> :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << std::endl;
+	}
+	if (isValid())
+	{
+		oss << "numPaths: " << thePaths.size();
+		oss << " numThreads: " << theThreads.size();
+		oss << " numProvided: " << theNextOut;
+		oss << std::endl;
+		oss << theQueue.infoString("queue");
+	}
+	else
+	{
+		oss << " <null>";
+	}
+	return oss.str();
+}
+
+template <typename PixType>
+inline
+void
+SequenceLoader<PixType> :: decodeLoop
+	()
+{
+	size_t const numPaths{ thePaths.size() };
+	for (;;)
+	{
+		// claim next image (if memory budget allows)
+		size_t ndx{ numPaths };
+		{
+			std::unique_lock<std::mutex> lock(theMutex);
+			theStateCV.wait
+				( lock
+				, [this] ()
+					{ return (theIsStopping || (theBytesAhead < theMaxBytes)); }
+				);
+			if (theIsStopping || (! (theNextDecode < numPaths)))
+			{
+				break;
+			}
+			ndx = theNextDecode++;
+		}
+
+		// decode (concurrently with other threads and consumer)
+		Grid grid{ theDecoder(thePaths[ndx]) };
+		size_t const numBytes{ byteSizeOf(grid) };
+
+		// wait for turn such that images are queued in sequence order
+		{
+			std::unique_lock<std::mutex> lock(theMutex);
+			theStateCV.wait
+				( lock
+				, [this, &ndx] ()
+					{ return (theIsStopping || (ndx == theNextQueue)); }
+				);
+			if (theIsStopping)
+			{
+				break;
+			}
+			theBytesAhead += numBytes;
+		}
+
+		// add to queue (blocks while queue is full) and pass turn along
+		bool const added{ theQueue.push(Item{ ndx, std::move(grid) }) };
+		{
+			std::lock_guard<std::mutex> lock(theMutex);
+			++theNextQueue;
+		}
+		theStateCV.notify_all();
+		if (! added)
+		{
+			break;
+		}
+	}
+}
+
+template <typename PixType>
+inline
+// static
+size_t
+SequenceLoader<PixType> :: byteSizeOf
+	( Grid const & grid
+	)
+{
+	return (grid.size() * sizeof(PixType));
+}
+
+} // io
+} // img
+
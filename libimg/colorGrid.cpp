@@ -0,0 +1,356 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Definitions for img::color batch (grid) conversions
+*/
+
+
+#include "libimg/colorGrid.h"
+
+#include "libdat/validity.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+
+namespace img
+{
+namespace color
+{
+
+namespace
+{
+	//! Convenience
+	using Pix3 = std::array<float, 3u>;
+
+	//! True if all channels are not null
+	inline
+	bool
+	isValid3
+		( Pix3 const & pix
+		)
+	{
+		return
+			(  dat::isValid(pix[0])
+			&& dat::isValid(pix[1])
+			&& dat::isValid(pix[2])
+			);
+	}
+
+	//! Null pixel value
+	constexpr Pix3 sBadPix3{{ fpixBad, fpixBad, fpixBad }};
+
+	//! Cube root for (positive normal) arg to within a few epsilon
+	inline
+	float
+	cbrtApprox
+		( float const & arg
+		)
+	{
+		// initial estimate (~5%) by dividing exponent bits by three
+		uint32_t bits{ 0u };
+		std::memcpy(&bits, &arg, sizeof(bits));
+		bits = (bits / 3u) + 709921077u;
+		float root{ 0.f };
+		std::memcpy(&root, &bits, sizeof(root));
+
+		// Halley iterations (cubic convergence)
+		for (size_t nn{0u} ; nn < 2u ; ++nn)
+		{
+			float const cube{ root * root * root };
+			root = root * (cube + 2.f * arg) / (2.f * cube + arg);
+		}
+		return root;
+	}
+
+	//! As color::fwdLab() but via cbrtApprox() and without branching
+	inline
+	float
+	fwdLabApprox
+		( float const & arg
+		)
+	{
+		static float const n6d29(6.f / 29.f);
+		static float const n6d29Cb(n6d29 * n6d29 * n6d29);
+		static float const n29d6(29.f / 6.f);
+		static float const slope((n29d6 * n29d6) / 3.f);
+		float const valueLin{ slope*arg + (4.f/29.f) };
+		float const valueCbrt{ cbrtApprox(std::max(arg, n6d29Cb)) };
+		return (n6d29Cb < arg) ? valueCbrt : valueLin;
+	}
+
+	//! Pixel kernel: same as color::toXYZfromYxy()
+	inline
+	Pix3
+	xyzFromYxy
+		( Pix3 const & yxy
+		)
+	{
+		Pix3 xyz(sBadPix3);
+		float const & iY = yxy[0];
+		if (0. < iY)
+		{
+			float const & cx = yxy[1];
+			float const & cy = yxy[2];
+			if (std::numeric_limits<fpix_t>::epsilon() < cy)
+			{
+				float const cz(1.f - cx - cy);
+				float const scale(iY / cy);
+				xyz = Pix3{{ scale * cx, iY, scale * cz }};
+			}
+		}
+		else
+		{
+			xyz = Pix3{{ 0.f, 0.f, 0.f }};
+		}
+		return xyz;
+	}
+
+	//! Pixel kernel: same as color::toXYZfromLab()
+	inline
+	Pix3
+	xyzFromLab
+		( Pix3 const & lab
+		)
+	{
+		Pix3 xyz(sBadPix3);
+		if (isValid3(lab))
+		{
+			float const arg1((1.f/1.16f) * (lab[0] + .16f));
+			xyz[0] = sLabXn * invLab(arg1 + (1.f/5.00f)*lab[1]);
+			xyz[1] = sLabYn * invLab(arg1);
+			xyz[2] = sLabZn * invLab(arg1 - (1.f/2.00)*lab[2]);
+		}
+		return xyz;
+	}
+
+	//! Pixel kernel: same as color::toYxyFromXYZ()
+	inline
+	Pix3
+	yxyFromXYZ
+		( Pix3 const & xyz
+		)
+	{
+		Pix3 yxy{{ 0.f, 0.f, 0.f }};
+		float const sum{ xyz[0] + xyz[1] + xyz[2] };
+		if (0. < sum)
+		{
+			yxy = Pix3{{ xyz[1], xyz[0] / sum, xyz[1] / sum }};
+		}
+		return yxy;
+	}
+
+	//! Pixel kernel: as color::toLabFromXYZ() but via fwdLabApprox()
+	inline
+	Pix3
+	labFromXYZ
+		( Pix3 const & xyz
+		)
+	{
+		Pix3 lab(sBadPix3);
+		if (isValid3(xyz))
+		{
+			float const fXX(fwdLabApprox(xyz[0]/sLabXn));
+			float const fYY(fwdLabApprox(xyz[1]/sLabYn));
+			float const fZZ(fwdLabApprox(xyz[2]/sLabZn));
+			lab[0] = 1.16f * fYY - .16f;
+			lab[1] = 5.00f * (fXX - fYY);
+			lab[2] = 2.00f * (fYY - fZZ);
+		}
+		return lab;
+	}
+
+	//! Deep grid with kernel applied to each pixel (rows concurrently)
+	template <typename Kernel>
+	dat::grid<Pix3>
+	deepConverted
+		( dat::grid<Pix3> const & inGrid
+		, Kernel const & kernel
+		, size_t const & numJobs
+		)
+	{
+		dat::grid<Pix3> outGrid;
+		if (inGrid.isValid())
+		{
+			outGrid = dat::grid<Pix3>(inGrid.hwSize());
+			size_t const wide{ inGrid.wide() };
+			sys::job::processRanges
+				( inGrid.high()
+				, [&] (size_t const & rowBeg, size_t const & rowEnd)
+					{
+						for (size_t row{rowBeg} ; row < rowEnd ; ++row)
+						{
+							Pix3 const * const ptIn{ inGrid.beginRow(row) };
+							Pix3 * const ptOut{ outGrid.beginRow(row) };
+							for (size_t col{0u} ; col < wide ; ++col)
+							{
+								ptOut[col] = kernel(ptIn[col]);
+							}
+						}
+					}
+				, numJobs
+				);
+		}
+		return outGrid;
+	}
+
+	//! Planar grids with kernel applied to each pixel (rows concurrently)
+	template <typename Kernel>
+	std::array<dat::grid<float>, 3u>
+	planarConverted
+		( std::array<dat::grid<float>, 3u> const & inChans
+		, Kernel const & kernel
+		, size_t const & numJobs
+		)
+	{
+		std::array<dat::grid<float>, 3u> outChans;
+		dat::Extents const hwSize(inChans[0].hwSize());
+		if ( inChans[0].isValid()
+		  && (inChans[1].hwSize() == hwSize)
+		  && (inChans[2].hwSize() == hwSize)
+		   )
+		{
+			for (dat::grid<float> & outChan : outChans)
+			{
+				outChan = dat::grid<float>(hwSize);
+			}
+			size_t const wide{ hwSize.wide() };
+			sys::job::processRanges
+				( hwSize.high()
+				, [&] (size_t const & rowBeg, size_t const & rowEnd)
+					{
+						for (size_t row{rowBeg} ; row < rowEnd ; ++row)
+						{
+							using FPtr = float const *;
+							FPtr const ptIn0{ inChans[0].beginRow(row) };
+							FPtr const ptIn1{ inChans[1].beginRow(row) };
+							FPtr const ptIn2{ inChans[2].beginRow(row) };
+							float * const ptOut0{ outChans[0].beginRow(row) };
+							float * const ptOut1{ outChans[1].beginRow(row) };
+							float * const ptOut2{ outChans[2].beginRow(row) };
+							for (size_t col{0u} ; col < wide ; ++col)
+							{
+								Pix3 const inPix
+									{{ ptIn0[col], ptIn1[col], ptIn2[col] }};
+								Pix3 const outPix(kernel(inPix));
+								ptOut0[col] = outPix[0];
+								ptOut1[col] = outPix[1];
+								ptOut2[col] = outPix[2];
+							}
+						}
+					}
+				, numJobs
+				);
+		}
+		return outChans;
+	}
+
+} // [anon]
+
+//======================================================================
+
+dat::grid<std::array<float, 3u> >
+toXYZfromYxy
+	( dat::grid<std::array<float, 3u> > const & yxyGrid
+	, size_t const & numJobs
+	)
+{
+	return deepConverted(yxyGrid, xyzFromYxy, numJobs);
+}
+
+std::array<dat::grid<float>, 3u>
+toXYZfromYxy
+	( std::array<dat::grid<float>, 3u> const & yxyChans
+	, size_t const & numJobs
+	)
+{
+	return planarConverted(yxyChans, xyzFromYxy, numJobs);
+}
+
+dat::grid<std::array<float, 3u> >
+toXYZfromLab
+	( dat::grid<std::array<float, 3u> > const & labGrid
+	, size_t const & numJobs
+	)
+{
+	return deepConverted(labGrid, xyzFromLab, numJobs);
+}
+
+std::array<dat::grid<float>, 3u>
+toXYZfromLab
+	( std::array<dat::grid<float>, 3u> const & labChans
+	, size_t const & numJobs
+	)
+{
+	return planarConverted(labChans, xyzFromLab, numJobs);
+}
+
+dat::grid<std::array<float, 3u> >
+toYxyFromXYZ
+	( dat::grid<std::array<float, 3u> > const & xyzGrid
+	, size_t const & numJobs
+	)
+{
+	return deepConverted(xyzGrid, yxyFromXYZ, numJobs);
+}
+
+std::array<dat::grid<float>, 3u>
+toYxyFromXYZ
+	( std::array<dat::grid<float>, 3u> const & xyzChans
+	, size_t const & numJobs
+	)
+{
+	return planarConverted(xyzChans, yxyFromXYZ, numJobs);
+}
+
+dat::grid<std::array<float, 3u> >
+toLabFromXYZ
+	( dat::grid<std::array<float, 3u> > const & xyzGrid
+	, size_t const & numJobs
+	)
+{
+	return deepConverted(xyzGrid, labFromXYZ, numJobs);
+}
+
+std::array<dat::grid<float>, 3u>
+toLabFromXYZ
+	( std::array<dat::grid<float>, 3u> const & xyzChans
+	, size_t const & numJobs
+	)
+{
+	return planarConverted(xyzChans, labFromXYZ, numJobs);
+}
+
+//======================================================================
+}
+}
+
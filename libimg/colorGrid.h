@@ -0,0 +1,134 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef img_colorGrid_INCL_
+#define img_colorGrid_INCL_
+
+/*! \file
+\brief Declarations for img::color batch (grid) conversions
+*/
+
+
+#include "libdat/grid.h"
+#include "libimg/color.h"
+#include "libsys/job.h"
+
+#include <array>
+
+
+namespace img
+{
+namespace color
+{
+
+/*! \brief Batch color space conversion of entire grids.
+ *
+ * These functions produce (per pixel) the same results as the
+ * single FPix conversions in libimg/color.h, but process the grid
+ * rows concurrently (over numJobs) with inline per-pixel kernels.
+ *
+ * Grids are either "deep" (three channels in each pixel) or
+ * "planar" (one grid per channel, all the same size).
+ *
+ * The nonlinear L*a*b* transfer function uses an approximate cube
+ * root (bit level estimate refined by two Halley iterations) with
+ * relative error within a few float epsilon (vs std::cbrt). All other
+ * conversions are computed with the same arithmetic as the FPix
+ * functions - including for null input channels. For L*a*b* (either
+ * direction) a pixel with any null channel produces null output. The
+ * Yxy conversions do not test for nulls: as for FPix, a null Y (in
+ * Yxy) or null channel sum (in XYZ) produces zeros, and other null
+ * channels propagate through the arithmetic.
+
+\par Example
+\dontinclude testimg/ucolorGrid.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+	//! CIE XYZ from CIE Yxy: deep grid
+	dat::grid<std::array<float, 3u> >
+	toXYZfromYxy
+		( dat::grid<std::array<float, 3u> > const & yxyGrid
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! CIE XYZ from CIE Yxy: planar channels
+	std::array<dat::grid<float>, 3u>
+	toXYZfromYxy
+		( std::array<dat::grid<float>, 3u> const & yxyChans
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! CIE XYZ from CIE L*a*b*: deep grid
+	dat::grid<std::array<float, 3u> >
+	toXYZfromLab
+		( dat::grid<std::array<float, 3u> > const & labGrid
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! CIE XYZ from CIE L*a*b*: planar channels
+	std::array<dat::grid<float>, 3u>
+	toXYZfromLab
+		( std::array<dat::grid<float>, 3u> const & labChans
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! CIE Yxy from CIE XYZ: deep grid
+	dat::grid<std::array<float, 3u> >
+	toYxyFromXYZ
+		( dat::grid<std::array<float, 3u> > const & xyzGrid
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! CIE Yxy from CIE XYZ: planar channels
+	std::array<dat::grid<float>, 3u>
+	toYxyFromXYZ
+		( std::array<dat::grid<float>, 3u> const & xyzChans
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! CIE L*a*b* from CIE XYZ: deep grid
+	dat::grid<std::array<float, 3u> >
+	toLabFromXYZ
+		( dat::grid<std::array<float, 3u> > const & xyzGrid
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! CIE L*a*b* from CIE XYZ: planar channels
+	std::array<dat::grid<float>, 3u>
+	toLabFromXYZ
+		( std::array<dat::grid<float>, 3u> const & xyzChans
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+}
+
+}
+
+#endif // img_colorGrid_INCL_
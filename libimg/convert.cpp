@@ -34,17 +34,20 @@
 
 #include "libimg/convert.h"
 
+#include "libdat/f16.h"
 #include "libimg/cfa.h"
 #include "libimg/color.h"
 #include "libimg/geo.h"
 #include "libimg/img.h"
 #include "libimg/pixel.h"
-#include "libimg/stats.h"
 #include "libmath/interp.h"
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
+#include <mutex>
 #include <sstream>
+#include <vector>
 
 
 namespace img
@@ -69,6 +72,214 @@ namespace
 		return (std::numeric_limits<float>::min() < span);
 	}
 
+	//! Call func for each value of gray pixel (if active)
+	template <typename Func>
+	inline
+	void
+	forActive
+		( float const & pix
+		, Func const & func
+		)
+	{
+		if (img::isActive(pix))
+		{
+			func(pix);
+		}
+	}
+
+	//! Call func for each channel of deep pixel (if all are active)
+	template <typename Func>
+	inline
+	void
+	forActive
+		( std::array<float, 3u> const & pix
+		, Func const & func
+		)
+	{
+		if (img::isActive(pix))
+		{
+			func(pix[0]);
+			func(pix[1]);
+			func(pix[2]);
+		}
+	}
+
+	//! Active min/max (and number of active values) via concurrent parts
+	template <typename PixType>
+	std::pair<dat::MinMax<float>, size_t>
+	activeMinMaxCount
+		( dat::grid<PixType> const & grid
+		, size_t const & numJobs
+		)
+	{
+		dat::MinMax<float> minmax;
+		size_t count{ 0u };
+		std::mutex partMutex;
+		sys::job::processRanges
+			( grid.size()
+			, [&] (size_t const & ndxBeg, size_t const & ndxEnd)
+				{
+					float partMin{ std::numeric_limits<float>::max() };
+					float partMax{ std::numeric_limits<float>::lowest() };
+					size_t partCount{ 0u };
+					typename dat::grid<PixType>::const_iterator const itBeg
+						{ grid.begin() };
+					for (size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+					{
+						forActive
+							( itBeg[ndx]
+							, [&] (float const & value)
+								{
+									partMin = std::min(partMin, value);
+									partMax = std::max(partMax, value);
+									++partCount;
+								}
+							);
+					}
+					if (0u < partCount)
+					{
+						dat::MinMax<float> const partMinMax(partMin, partMax);
+						std::lock_guard<std::mutex> const lock(partMutex);
+						minmax = minmax.expandedWith(partMinMax);
+						count += partCount;
+					}
+				}
+			, numJobs
+			);
+		return { minmax, count };
+	}
+
+	//! Number of bins used for percentile estimation
+	constexpr size_t sNumToneBins{ 4u * 1024u };
+
+	//! Histogram (sNumToneBins over range) of active values
+	template <typename PixType>
+	std::vector<size_t>
+	activeHistogram
+		( dat::grid<PixType> const & grid
+		, dat::MinMax<float> const & range
+		, size_t const & numJobs
+		)
+	{
+		std::vector<size_t> counts(sNumToneBins, 0u);
+		double const minValue{ range.min() };
+		double const span{ double(range.max()) - minValue };
+		double const binPerValue
+			{ validRange(range.pair()) ? (double(sNumToneBins) / span) : 0. };
+		std::mutex partMutex;
+		sys::job::processRanges
+			( grid.size()
+			, [&] (size_t const & ndxBeg, size_t const & ndxEnd)
+				{
+					std::vector<size_t> partCounts(sNumToneBins, 0u);
+					typename dat::grid<PixType>::const_iterator const itBeg
+						{ grid.begin() };
+					for (size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+					{
+						forActive
+							( itBeg[ndx]
+							, [&] (float const & value)
+								{
+									size_t const bin
+										{ static_cast<size_t>
+											((value - minValue) * binPerValue)
+										};
+									size_t const lastBin{ sNumToneBins - 1u };
+									++partCounts[std::min(bin, lastBin)];
+								}
+							);
+					}
+					std::lock_guard<std::mutex> const lock(partMutex);
+					for (size_t bin{0u} ; bin < sNumToneBins ; ++bin)
+					{
+						counts[bin] += partCounts[bin];
+					}
+				}
+			, numJobs
+			);
+		return counts;
+	}
+
+	//! Value below which frac of histogram counts occur (linear in bin)
+	float
+	valueAtFraction
+		( std::vector<size_t> const & counts
+		, dat::MinMax<float> const & range
+		, double const & frac
+		)
+	{
+		size_t total{ 0u };
+		for (size_t const & count : counts)
+		{
+			total += count;
+		}
+		double const target{ frac * double(total) };
+
+		// find bin containing target and interpolate within it
+		double binValue{ double(counts.size()) };
+		double cumPrev{ 0. };
+		for (size_t bin{0u} ; bin < counts.size() ; ++bin)
+		{
+			double const cumNext{ cumPrev + double(counts[bin]) };
+			if ((0u < counts[bin]) && (target <= cumNext))
+			{
+				double const binFrac
+					{ (target - cumPrev) / double(counts[bin]) };
+				binValue = double(bin) + std::max(0., binFrac);
+				break;
+			}
+			cumPrev = cumNext;
+		}
+
+		double const span{ double(range.max()) - double(range.min()) };
+		double const value
+			{ range.min() + (binValue / double(counts.size())) * span };
+		double const atLeast{ std::max(double(range.min()), value) };
+		return static_cast<float>(std::min(double(range.max()), atLeast));
+	}
+
+	//! Tone range for active values of grid
+	template <typename PixType>
+	ToneRange
+	toneRangeOf
+		( dat::grid<PixType> const & grid
+		, double const & fracLo
+		, double const & fracHi
+		, size_t const & numJobs
+		)
+	{
+		ToneRange tone;
+		if (grid.isValid())
+		{
+			std::pair<dat::MinMax<float>, size_t> const mmCount
+				(activeMinMaxCount(grid, numJobs));
+			tone.theMinMax = mmCount.first;
+			tone.theNumActive = mmCount.second;
+			tone.theClipMinMax = tone.theMinMax;
+
+			// percentile values only if requested
+			bool const needLo{ 0. < fracLo };
+			bool const needHi{ fracHi < 1. };
+			if (tone.theMinMax.isValid() && (needLo || needHi))
+			{
+				std::vector<size_t> const counts
+					(activeHistogram(grid, tone.theMinMax, numJobs));
+				float clipLo{ tone.theMinMax.min() };
+				if (needLo)
+				{
+					clipLo = valueAtFraction(counts, tone.theMinMax, fracLo);
+				}
+				float clipHi{ tone.theMinMax.max() };
+				if (needHi)
+				{
+					clipHi = valueAtFraction(counts, tone.theMinMax, fracHi);
+				}
+				tone.theClipMinMax = dat::MinMax<float>(clipLo, clipHi);
+			}
+		}
+		return tone;
+	}
+
 	//! Input output value ranges
 	struct OutPerIn
 	{
@@ -83,10 +294,10 @@ namespace
 		dat::MinMax<float>
 		gridMinMax
 			( dat::grid<float> const & fromGrid
+			, size_t const & numJobs
 			)
 		{
-			return img::stats::activeMinMax<float>
-				(fromGrid.begin(), fromGrid.end());
+			return activeMinMaxCount(fromGrid, numJobs).first;
 		}
 
 		//! Min/Max from data values
@@ -95,9 +306,10 @@ namespace
 		dat::MinMax<float>
 		gridMinMax
 			( dat::grid<std::array<float, 3u>> const & fromDeep
+			, size_t const & numJobs
 			)
 		{
-			return img::stats::pixelMinMax<float>(fromDeep);
+			return activeMinMaxCount(fromDeep, numJobs).first;
 		}
 
 		//! Min/Max from data values
@@ -106,9 +318,15 @@ namespace
 		dat::MinMax<float>
 		gridMinMax
 			( std::array<dat::grid<float>, 3u> const & fromChans
+			, size_t const & numJobs
 			)
 		{
-			return img::stats::pixelMinMax<float>(fromChans);
+			dat::MinMax<float> minmax;
+			for (dat::grid<float> const & fromChan : fromChans)
+			{
+				minmax = minmax.expandedWith(gridMinMax(fromChan, numJobs));
+			}
+			return minmax;
 		}
 
 		//! input range from arg or (if null arg, then) data
@@ -118,13 +336,14 @@ namespace
 		fromRange
 			( dat::MinMax<float> const & fromMinMax
 			, GridType const & fromGrid
+			, size_t const & numJobs
 			)
 		{
 			dat::MinMax<float> minmax(fromMinMax);
 			if (! minmax.isValid())
 			{
 				// if no explicit input range, compute one from data
-				minmax = gridMinMax(fromGrid);
+				minmax = gridMinMax(fromGrid, numJobs);
 			}
 			return minmax;
 		}
@@ -154,9 +373,10 @@ namespace
 			( dat::MinMax<float> const & fromMinMax
 			, dat::MinMax<float> const & intoMinMax
 			, GridType const & grid
+			, size_t const & numJobs
 			)
 			: OutPerIn
-				(fromRange(fromMinMax, grid), intoMinMax)
+				(fromRange(fromMinMax, grid, numJobs), intoMinMax)
 		{ }
 
 		//! True if any of pixel values are less then input min
@@ -226,6 +446,69 @@ namespace
 			return outVal;
 		}
 
+		//! 8-bit value for gray input pixel (useForNull if not active)
+		inline
+		uint8_t
+		gray8
+			( float const & inPix
+			, uint8_t const & useForNull
+			) const
+		{
+			uint8_t oPix{ useForNull };
+			// prefer saturated values vs under
+			if (over(inPix))
+			{
+				oPix = static_cast<uint8_t>(theOut.second);
+			}
+			else
+			if (under(inPix))
+			{
+				oPix = static_cast<uint8_t>(theOut.first);
+			}
+			else
+			if (img::isActive(inPix))
+			{
+				oPix = static_cast<uint8_t>(std::floor((*this)(inPix)));
+			}
+			return oPix;
+		}
+
+		//! 8-bit values for color input pixel (useForNull if any inactive)
+		inline
+		std::array<uint8_t, 3u>
+		color8
+			( float const & inPix0
+			, float const & inPix1
+			, float const & inPix2
+			, std::array<uint8_t, 3u> const & useForNull
+			) const
+		{
+			std::array<uint8_t, 3u> oPix(useForNull);
+			// prefer saturated values vs under
+			if (over(inPix0, inPix1, inPix2))
+			{
+				uint8_t const maxOut{ static_cast<uint8_t>(theOut.second) };
+				oPix = {{ maxOut, maxOut, maxOut }};
+			}
+			else
+			if (under(inPix0, inPix1, inPix2))
+			{
+				uint8_t const minOut{ static_cast<uint8_t>(theOut.first) };
+				oPix = {{ minOut, minOut, minOut }};
+			}
+			else
+			if ( img::isActive(inPix0)
+			  && img::isActive(inPix1)
+			  && img::isActive(inPix2)
+			   )
+			{
+				oPix[0] = static_cast<uint8_t>(std::floor((*this)(inPix0)));
+				oPix[1] = static_cast<uint8_t>(std::floor((*this)(inPix1)));
+				oPix[2] = static_cast<uint8_t>(std::floor((*this)(inPix2)));
+			}
+			return oPix;
+		}
+
 		//! Descriptive information about this instance
 		std::string
 		infoString
@@ -288,12 +571,13 @@ sRgbFromLRgb
 	( std::array<dat::grid<float>, 3u> const & lrgbs
 	, dat::MinMax<float> const & lMinMax
 	, dat::MinMax<float> const & sMinMax
+	, size_t const & numJobs
 	)
 {
 	std::array<dat::grid<float>, 3u> srgbs;
 	if (lrgbs[0].isValid() && lrgbs[1].isValid() && lrgbs[2].isValid())
 	{
-		OutPerIn const xform(lMinMax, sMinMax, lrgbs);
+		OutPerIn const xform(lMinMax, sMinMax, lrgbs, numJobs);
 		
 		// allocate output space
 		dat::Extents const inSize(lrgbs[0].hwSize());
@@ -303,31 +587,36 @@ sRgbFromLRgb
 		srgbs[1] = dat::grid<float>(inSize);
 		srgbs[2] = dat::grid<float>(inSize);
 
-		// process each pixel in turn
-		dat::grid<float>::const_iterator itIn_R(lrgbs[0].begin());
-		dat::grid<float>::const_iterator itIn_G(lrgbs[1].begin());
-		dat::grid<float>::const_iterator itIn_B(lrgbs[2].begin());
-		dat::grid<float>::iterator itOut_R(srgbs[0].begin());
-		dat::grid<float>::iterator itOut_G(srgbs[1].begin());
-		dat::grid<float>::iterator itOut_B(srgbs[2].begin());
-
-		// process each pixel
-		while (lrgbs[0].end() != itIn_R)
-		{
-			// read input and remap to range which is valid for xform
-			double const lred(xform(*itIn_R++));
-			double const lgrn(xform(*itIn_G++));
-			double const lblu(xform(*itIn_B++));
-
-			// convert from linear to standard RGB
-			std::array<float, 3u> const srgb
-				(img::color::toSRGB8fromLRGB(lred, lgrn, lblu, xform.theOut));
-
-			// cast and return
-			*itOut_R++ = srgb[0];
-			*itOut_G++ = srgb[1];
-			*itOut_B++ = srgb[2];
-		}
+		// process pixels in concurrent parts
+		dat::grid<float>::const_iterator const itIn_R(lrgbs[0].begin());
+		dat::grid<float>::const_iterator const itIn_G(lrgbs[1].begin());
+		dat::grid<float>::const_iterator const itIn_B(lrgbs[2].begin());
+		dat::grid<float>::iterator const itOut_R(srgbs[0].begin());
+		dat::grid<float>::iterator const itOut_G(srgbs[1].begin());
+		dat::grid<float>::iterator const itOut_B(srgbs[2].begin());
+		sys::job::processRanges
+			( lrgbs[0].size()
+			, [&] (size_t const & ndxBeg, size_t const & ndxEnd)
+				{
+					for (size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+					{
+						// read input and remap to range valid for xform
+						double const lred(xform(itIn_R[ndx]));
+						double const lgrn(xform(itIn_G[ndx]));
+						double const lblu(xform(itIn_B[ndx]));
+
+						// convert from linear to standard RGB (via LUT)
+						std::array<float, 3u> const srgb
+							(img::color::toSRGB8fromLRGB
+								(lred, lgrn, lblu, xform.theOut));
+
+						itOut_R[ndx] = srgb[0];
+						itOut_G[ndx] = srgb[1];
+						itOut_B[ndx] = srgb[2];
+					}
+				}
+			, numJobs
+			);
 	}
 	return srgbs;
 }
@@ -337,40 +626,42 @@ sRgbFromLRgb
 	( dat::grid<std::array<float, 3u> > const & lrgbGrid
 	, dat::MinMax<float> const & lMinMax
 	, dat::MinMax<float> const & sMinMax
+	, size_t const & numJobs
 	)
 {
 	dat::grid<std::array<float, 3u> > srgbGrid;
 	if (lrgbGrid.isValid())
 	{
-		OutPerIn const xform(lMinMax, sMinMax, lrgbGrid);
+		OutPerIn const xform(lMinMax, sMinMax, lrgbGrid, numJobs);
 		
 		// allocate output space
 		dat::Extents const inSize(lrgbGrid.hwSize());
 		srgbGrid = dat::grid<std::array<float, 3u> >(inSize);
 
-		// setup input and output iterators
-		dat::grid<std::array<float, 3u> >::const_iterator itInRgb
+		// process pixels in concurrent parts
+		dat::grid<std::array<float, 3u> >::const_iterator const itInRgb
 			(lrgbGrid.begin());
-		dat::grid<std::array<float, 3u> >::iterator itOutRgb
+		dat::grid<std::array<float, 3u> >::iterator const itOutRgb
 			(srgbGrid.begin());
-
-		// process each pixel in turn
-		while (lrgbGrid.end() != itInRgb)
-		{
-			// read input and remap to range which is valid for xform
-			std::array<float, 3u> const & lrgb = *itInRgb;
-			double const lred(xform(lrgb[0]));
-			double const lgrn(xform(lrgb[1]));
-			double const lblu(xform(lrgb[2]));
-
-			// convert from linear to standard RGB
-			std::array<float, 3u> const srgb
-				(img::color::toSRGB8fromLRGB(lred, lgrn, lblu, xform.theOut));
-
-			// return output and update iterators
-			*itOutRgb++ = srgb;
-			++itInRgb;
-		}
+		sys::job::processRanges
+			( lrgbGrid.size()
+			, [&] (size_t const & ndxBeg, size_t const & ndxEnd)
+				{
+					for (size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+					{
+						// read input and remap to range valid for xform
+						std::array<float, 3u> const & lrgb = itInRgb[ndx];
+						double const lred(xform(lrgb[0]));
+						double const lgrn(xform(lrgb[1]));
+						double const lblu(xform(lrgb[2]));
+
+						// convert from linear to standard RGB (via LUT)
+						itOutRgb[ndx] = img::color::toSRGB8fromLRGB
+							(lred, lgrn, lblu, xform.theOut);
+					}
+				}
+			, numJobs
+			);
 	}
 	return srgbGrid;
 }
@@ -388,256 +679,267 @@ grayGridFrom
 	return img::cfa::grayFastFrom2x2(cfaGrid, rgbGains, setEdgeToNull);
 }
 
-dat::grid<uint8_t>
-downMappedLinear
-	( dat::grid<float> const & inGrid
-	, dat::MinMax<float> const & inMinMax
-	, uint8_t const & useForNull
+dat::grid<fpix_t>
+grayGridFrom
+	( dat::grid<dat::f16_t> const & fullGrid
+	, dat::SubExtents const & crop
+	, std::array<fpix_t, 3u> const & rgbGains
 	)
 {
-	dat::grid<uint8_t> outGrid;
-	if (inGrid.isValid())
+	dat::grid<fpix_t> cfaGrid(crop.theSize);
+	if (fullGrid.isValid() && crop.isValid())
 	{
-		// input and output data ranges
-		OutPerIn const xform(inMinMax, sOutMinMax8, inGrid);
-
-		// allocate output space
-		outGrid = dat::grid<uint8_t>(inGrid.hwSize());
-		std::fill(outGrid.begin(), outGrid.end(), useForNull);
-
-		uint8_t const & minOut = xform.theOut.first;
-		uint8_t const & maxOut = xform.theOut.second;
+		// expand crop rows to float with batch conversion
+		for (size_t row{0u} ; row < crop.high() ; ++row)
+		{
+			dat::f16_t const * const rowBeg
+				{ fullGrid.iterAt(crop.theUL[0] + row, crop.theUL[1]) };
+			dat::f16::floatsFromHalfs
+				(rowBeg, rowBeg + crop.wide(), cfaGrid.beginRow(row));
+		}
+	}
+	constexpr bool setEdgeToNull{ true };
+	return img::cfa::grayFastFrom2x2(cfaGrid, rgbGains, setEdgeToNull);
+}
 
-		// transform input values via linear
-		dat::grid<float>::const_iterator itIn(inGrid.begin());
-		dat::grid<uint8_t>::iterator itOut(outGrid.begin());
+bool
+ToneRange :: isValid
+	() const
+{
+	return theMinMax.isValid();
+}
 
-		uint8_t oPix(127u); // always overwritten
+std::string
+ToneRange :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << std::endl;
+	}
+	if (isValid())
+	{
+		oss << dat::infoString(theMinMax, "theMinMax");
+		oss << std::endl;
+		oss << dat::infoString(theClipMinMax, "theClipMinMax");
+		oss << std::endl;
+		oss << dat::infoString(theNumActive, "theNumActive");
+	}
+	else
+	{
+		oss << " <null>";
+	}
+	return oss.str();
+}
 
-		while (inGrid.end() != itIn)
-		{
-			// get current input pixel value
-			float const inPix(*itIn++);
+ToneRange
+toneRangeFor
+	( dat::grid<float> const & inGrid
+	, double const & fracLo
+	, double const & fracHi
+	, size_t const & numJobs
+	)
+{
+	return toneRangeOf(inGrid, fracLo, fracHi, numJobs);
+}
 
-			// select output pixel values based on state of input
+ToneRange
+toneRangeFor
+	( dat::grid<std::array<float, 3u> > const & inGrid
+	, double const & fracLo
+	, double const & fracHi
+	, size_t const & numJobs
+	)
+{
+	return toneRangeOf(inGrid, fracLo, fracHi, numJobs);
+}
 
-			// prefer saturated values vs under
-			if (xform.over(inPix))
-			{
-				// input overflow
-				oPix = maxOut;
-			}
-			else
-			if (xform.under(inPix))
-			{
-				// input underflow
-				oPix = minOut;
-			}
-			else
-			if (img::isActive(inPix))
-			{
-				oPix = static_cast<uint8_t>(std::floor(xform(inPix)));
-			}
-			else
-			{
-				// use last pixel?
-				oPix = useForNull;
-			}
+bool
+downMappedLinearInto
+	( dat::grid<uint8_t> * const & ptOutGrid
+	, dat::grid<float> const & inGrid
+	, dat::MinMax<float> const & inMinMax
+	, uint8_t const & useForNull
+	, size_t const & numJobs
+	)
+{
+	bool okay{ false };
+	if (ptOutGrid && inGrid.isValid())
+	{
+		// input and output data ranges
+		OutPerIn const xform(inMinMax, sOutMinMax8, inGrid, numJobs);
 
-			// set output to pixel value
-			*itOut++ = oPix;
+		// (re)use output space
+		if (! (ptOutGrid->hwSize() == inGrid.hwSize()))
+		{
+			*ptOutGrid = dat::grid<uint8_t>(inGrid.hwSize());
 		}
+
+		// transform input values via linear
+		dat::grid<float>::const_iterator const itIn(inGrid.begin());
+		dat::grid<uint8_t>::iterator const itOut(ptOutGrid->begin());
+		sys::job::processRanges
+			( inGrid.size()
+			, [&] (size_t const & ndxBeg, size_t const & ndxEnd)
+				{
+					for (size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+					{
+						itOut[ndx] = xform.gray8(itIn[ndx], useForNull);
+					}
+				}
+			, numJobs
+			);
+		okay = true;
 	}
-	return outGrid;
+	return okay;
 }
 
-dat::grid<std::array<uint8_t, 3u> >
-downMappedLinear
-	( dat::grid<std::array<float, 3u> > const & inGrid
+bool
+downMappedLinearInto
+	( dat::grid<std::array<uint8_t, 3u> > * const & ptOutGrid
+	, dat::grid<std::array<float, 3u> > const & inGrid
 	, dat::MinMax<float> const & inMinMax
 	, std::array<uint8_t, 3u> const useForNull
+	, size_t const & numJobs
 	)
 {
-	dat::grid<std::array<uint8_t, 3u> > outGrid;
-
-	if (inGrid.isValid())
+	bool okay{ false };
+	if (ptOutGrid && inGrid.isValid())
 	{
 		// input and output data ranges
-		OutPerIn const xform(inMinMax, sOutMinMax8, inGrid);
-
-		// allocate output space
-		outGrid = dat::grid<std::array<uint8_t, 3u> >(inGrid.hwSize());
+		OutPerIn const xform(inMinMax, sOutMinMax8, inGrid, numJobs);
 
-		// fill with default background value
-		std::fill(outGrid.begin(), outGrid.end(), useForNull);
-
-		uint8_t const & minOut = xform.theOut.first;
-		uint8_t const & maxOut = xform.theOut.second;
+		// (re)use output space
+		if (! (ptOutGrid->hwSize() == inGrid.hwSize()))
+		{
+			*ptOutGrid = dat::grid<std::array<uint8_t, 3u> >(inGrid.hwSize());
+		}
 
 		// transform input values via linear
-		dat::grid<std::array<float, 3u> >::const_iterator itIn
+		dat::grid<std::array<float, 3u> >::const_iterator const itIn
 			(inGrid.begin());
-		dat::grid<std::array<uint8_t, 3u> >::iterator itOut
-			(outGrid.begin());
-
-		std::array<uint8_t, 3u> oPix{{}}; // always overwritten
-		uint8_t & oPix0 = oPix[0];
-		uint8_t & oPix1 = oPix[1];
-		uint8_t & oPix2 = oPix[2];
-		while (inGrid.end() != itIn)
-		{
-			// get current input pixel value
-			std::array<float, 3u> const inPix(*itIn++);
-			float const & inPix0 = inPix[0];
-			float const & inPix1 = inPix[1];
-			float const & inPix2 = inPix[2];
-
-			// prefer saturated values vs under
-			if (xform.over(inPix0, inPix1, inPix2))
-			{
-				// input overflow
-				oPix0 = maxOut;
-				oPix1 = maxOut;
-				oPix2 = maxOut;
-			}
-			else
-			if (xform.under(inPix0, inPix1, inPix2))
-			{
-				// input underflow
-				oPix0 = minOut;
-				oPix1 = minOut;
-				oPix2 = minOut;
-			}
-			else
-			if ( img::isActive(inPix0)
-			  && img::isActive(inPix1)
-			  && img::isActive(inPix2)
-			   )
-			{
-				// valid input
-				oPix0 = static_cast<uint8_t>(std::floor(xform(inPix0)));
-				oPix1 = static_cast<uint8_t>(std::floor(xform(inPix1)));
-				oPix2 = static_cast<uint8_t>(std::floor(xform(inPix2)));
-			}
-			else
-			{
-				// use last pixel?
-				oPix0 = useForNull[0];
-				oPix1 = useForNull[1];
-				oPix2 = useForNull[2];
-			}
-
-
-			// set output to pixel value
-			*itOut++ = { oPix0, oPix1, oPix2 };
-		}
+		dat::grid<std::array<uint8_t, 3u> >::iterator const itOut
+			(ptOutGrid->begin());
+		sys::job::processRanges
+			( inGrid.size()
+			, [&] (size_t const & ndxBeg, size_t const & ndxEnd)
+				{
+					for (size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+					{
+						std::array<float, 3u> const & inPix = itIn[ndx];
+						itOut[ndx] = xform.color8
+							(inPix[0], inPix[1], inPix[2], useForNull);
+					}
+				}
+			, numJobs
+			);
+		okay = true;
 	}
-	return outGrid;
+	return okay;
 }
 
-std::array<dat::grid<uint8_t>, 3u>
-downMappedLinear
-	( std::array<dat::grid<float>, 3u> const & inGrids
+bool
+downMappedLinearInto
+	( std::array<dat::grid<uint8_t>, 3u> * const & ptOutGrids
+	, std::array<dat::grid<float>, 3u> const & inGrids
 	, dat::MinMax<float> const & inMinMax
 	, uint8_t const & useForNull
+	, size_t const & numJobs
 	)
 {
-	std::array<dat::grid<uint8_t>, 3u> outGrids;
-	if (inGrids[0].isValid() && inGrids[1].isValid() && inGrids[2].isValid())
+	bool okay{ false };
+	if ( ptOutGrids
+	  && inGrids[0].isValid() && inGrids[1].isValid() && inGrids[2].isValid()
+	   )
 	{
-		// shorthand
-		dat::grid<float> const & inGrid0 = inGrids[0];
-		dat::grid<float> const & inGrid1 = inGrids[1];
-		dat::grid<float> const & inGrid2 = inGrids[2];
-
-		dat::grid<uint8_t> & outGrid0 = outGrids[0];
-		dat::grid<uint8_t> & outGrid1 = outGrids[1];
-		dat::grid<uint8_t> & outGrid2 = outGrids[2];
-
 		// check sizes
-		dat::Extents const inSize(inGrid0.hwSize());
-		assert(inSize == inGrid1.hwSize());
-		assert(inSize == inGrid2.hwSize());
+		dat::Extents const inSize(inGrids[0].hwSize());
+		assert(inSize == inGrids[1].hwSize());
+		assert(inSize == inGrids[2].hwSize());
 
 		// input and output data ranges
-		OutPerIn const xform(inMinMax, sOutMinMax8, inGrids);
-
-		// allocate output space
-		outGrid0 = dat::grid<uint8_t>(inSize);
-		outGrid1 = dat::grid<uint8_t>(inSize);
-		outGrid2 = dat::grid<uint8_t>(inSize);
-		std::fill(outGrid0.begin(), outGrid0.end(), useForNull);
-		std::fill(outGrid1.begin(), outGrid1.end(), useForNull);
-		std::fill(outGrid2.begin(), outGrid2.end(), useForNull);
+		OutPerIn const xform(inMinMax, sOutMinMax8, inGrids, numJobs);
 
-		// output data ranges
-		uint8_t const & minOut = xform.theOut.first;
-		uint8_t const & maxOut = xform.theOut.second;
+		// (re)use output space
+		for (dat::grid<uint8_t> & outGrid : *ptOutGrids)
+		{
+			if (! (outGrid.hwSize() == inSize))
+			{
+				outGrid = dat::grid<uint8_t>(inSize);
+			}
+		}
 
 		// configure iterator to input and output structures
-		dat::grid<float>::const_iterator itIn0(inGrid0.begin());
-		dat::grid<float>::const_iterator itIn1(inGrid1.begin());
-		dat::grid<float>::const_iterator itIn2(inGrid2.begin());
-		dat::grid<uint8_t>::iterator itOut0(outGrid0.begin());
-		dat::grid<uint8_t>::iterator itOut1(outGrid1.begin());
-		dat::grid<uint8_t>::iterator itOut2(outGrid2.begin());
-
-		// working space
-		uint8_t oPix0(127u); // always overwritten
-		uint8_t oPix1(127u); // always overwritten
-		uint8_t oPix2(127u); // always overwritten
+		dat::grid<float>::const_iterator const itIn0(inGrids[0].begin());
+		dat::grid<float>::const_iterator const itIn1(inGrids[1].begin());
+		dat::grid<float>::const_iterator const itIn2(inGrids[2].begin());
+		dat::grid<uint8_t>::iterator const itOut0((*ptOutGrids)[0].begin());
+		dat::grid<uint8_t>::iterator const itOut1((*ptOutGrids)[1].begin());
+		dat::grid<uint8_t>::iterator const itOut2((*ptOutGrids)[2].begin());
+		std::array<uint8_t, 3u> const nullPix
+			{{ useForNull, useForNull, useForNull }};
 
 		// transform input values via linear
-		while (inGrid0.end() != itIn0)
-		{
-			// get current input pixel value
-			float const inPix0(*itIn0++);
-			float const inPix1(*itIn1++);
-			float const inPix2(*itIn2++);
+		sys::job::processRanges
+			( inGrids[0].size()
+			, [&] (size_t const & ndxBeg, size_t const & ndxEnd)
+				{
+					for (size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+					{
+						std::array<uint8_t, 3u> const oPix
+							(xform.color8
+								(itIn0[ndx], itIn1[ndx], itIn2[ndx], nullPix)
+							);
+						itOut0[ndx] = oPix[0];
+						itOut1[ndx] = oPix[1];
+						itOut2[ndx] = oPix[2];
+					}
+				}
+			, numJobs
+			);
+		okay = true;
+	}
+	return okay;
+}
 
-			// catch extreme values
+dat::grid<uint8_t>
+downMappedLinear
+	( dat::grid<float> const & inGrid
+	, dat::MinMax<float> const & inMinMax
+	, uint8_t const & useForNull
+	, size_t const & numJobs
+	)
+{
+	dat::grid<uint8_t> outGrid;
+	downMappedLinearInto(&outGrid, inGrid, inMinMax, useForNull, numJobs);
+	return outGrid;
+}
 
-			// prefer saturated values vs under
-			if (xform.over(inPix0, inPix1, inPix2))
-			{
-				// input overflow
-				oPix0 = maxOut;
-				oPix1 = maxOut;
-				oPix2 = maxOut;
-			}
-			else
-			if (xform.under(inPix0, inPix1, inPix2))
-			{
-				// input underflow
-				oPix0 = minOut;
-				oPix1 = minOut;
-				oPix2 = minOut;
-			}
-			else
-			if ( img::isActive(inPix0)
-			  && img::isActive(inPix1)
-			  && img::isActive(inPix2)
-			   )
-			{
-				// valid input
-				oPix0 = static_cast<uint8_t>(std::floor(xform(inPix0)));
-				oPix1 = static_cast<uint8_t>(std::floor(xform(inPix1)));
-				oPix2 = static_cast<uint8_t>(std::floor(xform(inPix2)));
-			}
-			else
-			{
-				// use last pixel?
-				oPix0 = useForNull;
-				oPix1 = useForNull;
-				oPix2 = useForNull;
-			}
+dat::grid<std::array<uint8_t, 3u> >
+downMappedLinear
+	( dat::grid<std::array<float, 3u> > const & inGrid
+	, dat::MinMax<float> const & inMinMax
+	, std::array<uint8_t, 3u> const useForNull
+	, size_t const & numJobs
+	)
+{
+	dat::grid<std::array<uint8_t, 3u> > outGrid;
+	downMappedLinearInto(&outGrid, inGrid, inMinMax, useForNull, numJobs);
+	return outGrid;
+}
 
-			// set output to pixel value
-			*itOut0++ = oPix0;
-			*itOut1++ = oPix1;
-			*itOut2++ = oPix2;
-		}
-	}
+std::array<dat::grid<uint8_t>, 3u>
+downMappedLinear
+	( std::array<dat::grid<float>, 3u> const & inGrids
+	, dat::MinMax<float> const & inMinMax
+	, uint8_t const & useForNull
+	, size_t const & numJobs
+	)
+{
+	std::array<dat::grid<uint8_t>, 3u> outGrids;
+	downMappedLinearInto(&outGrids, inGrids, inMinMax, useForNull, numJobs);
 	return outGrids;
 }
 
@@ -37,10 +37,13 @@
 #include "libdat/grid.h"
 #include "libdat/MinMax.h"
 #include "libdat/SubExtents.h"
+#include "libdat/types.h"
 #include "libimg/img.h"
 #include "libimg/raw10.h"
+#include "libsys/job.h"
 
 #include <array>
+#include <string>
 
 
 namespace img
@@ -84,6 +87,7 @@ namespace convert
 			( static_cast<float>(u8pixMinValid)
 			, static_cast<float>(u8pixMaxValid)
 			)
+		, size_t const & numJobs = sys::job::defaultNumJobs()
 		);
 
 	//! Convert deep-grid to standard rgb space
@@ -97,6 +101,7 @@ namespace convert
 			( static_cast<float>(u8pixMinValid)
 			, static_cast<float>(u8pixMaxValid)
 			)
+		, size_t const & numJobs = sys::job::defaultNumJobs()
 		);
 
 	//! Subgrid of intensity values extracted from fullGrid
@@ -107,12 +112,106 @@ namespace convert
 		, std::array<fpix_t, 3u> const & rgbGains
 		);
 
+	//! As grayGridFrom() but from half precision source (expanded by row)
+	dat::grid<fpix_t>
+	grayGridFrom
+		( dat::grid<dat::f16_t> const & fullGrid
+		, dat::SubExtents const & crop
+		, std::array<fpix_t, 3u> const & rgbGains
+		);
+
+	//! Range of active values (and percentile clip range) for tone mapping
+	struct ToneRange
+	{
+		//! Extreme values over all active pixels
+		dat::MinMax<float> theMinMax{};
+
+		//! Values bracketing requested fractions of active pixels
+		dat::MinMax<float> theClipMinMax{};
+
+		//! Number of active values considered
+		size_t theNumActive{ 0u };
+
+		//! True if instance is not null
+		bool
+		isValid
+			() const;
+
+		//! Descriptive information about this instance
+		std::string
+		infoString
+			( std::string const & title = std::string()
+			) const;
+	};
+
+	/*! Active value range and percentile values via concurrent reduction.
+	 *
+	 * The min/max pass is followed (only if fracLo/fracHi are inside
+	 * the open interval (0,1)) by a 4096-bin histogram pass from which
+	 * the clip values are interpolated. Clip values are therefore
+	 * accurate to (about) 1/4096 of the full data range.
+	 */
+	ToneRange
+	toneRangeFor
+		( dat::grid<float> const & inGrid
+		, double const & fracLo = 0.
+		, double const & fracHi = 1.
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! As toneRangeFor() but for deep grid (pixels with all chans active)
+	ToneRange
+	toneRangeFor
+		( dat::grid<std::array<float, 3u> > const & inGrid
+		, double const & fracLo = 0.
+		, double const & fracHi = 1.
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	/*! Tone-map gray-scale floating point image into *ptOutGrid.
+	 *
+	 * Storage of *ptOutGrid is reused if it already has the size of
+	 * inGrid (e.g. when generating quicklooks for a sequence of frames).
+	 * If inMinMax is null, the range is computed from the active inGrid
+	 * values. Pixels are processed concurrently with numJobs.
+	 * Returns true on success (else *ptOutGrid is unchanged).
+	 */
+	bool
+	downMappedLinearInto
+		( dat::grid<uint8_t> * const & ptOutGrid
+		, dat::grid<float> const & inGrid
+		, dat::MinMax<float> const & inMinMax = dat::MinMax<float>()
+		, uint8_t const & useForNull = 0u
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! As downMappedLinearInto() but for deep color grid
+	bool
+	downMappedLinearInto
+		( dat::grid<std::array<uint8_t, 3u> > * const & ptOutGrid
+		, dat::grid<std::array<float, 3u> > const & inGrid
+		, dat::MinMax<float> const & inMinMax = dat::MinMax<float>()
+		, std::array<uint8_t, 3u> const useForNull = { 0u, 0u, 0u }
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! As downMappedLinearInto() but for multi-band color grids
+	bool
+	downMappedLinearInto
+		( std::array<dat::grid<uint8_t>, 3u> * const & ptOutGrids
+		, std::array<dat::grid<float>, 3u> const & inGrids
+		, dat::MinMax<float> const & inMinMax = dat::MinMax<float>()
+		, uint8_t const & useForNull = 0u
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
 	//! Tone-map gray-scale floating point image into 8-bit
 	dat::grid<uint8_t>
 	downMappedLinear
 		( dat::grid<float> const & inGrid
 		, dat::MinMax<float> const & inMinMax = dat::MinMax<float>()
 		, uint8_t const & useForNull = 0u
+		, size_t const & numJobs = sys::job::defaultNumJobs()
 		);
 
 	//! Tone-map deep color floating point image into 8-bit
@@ -121,6 +220,7 @@ namespace convert
 		( dat::grid<std::array<float, 3u> > const & inGrid
 		, dat::MinMax<float> const & inMinMax = dat::MinMax<float>()
 		, std::array<uint8_t, 3u> const useForNull = { 0u, 0u, 0u }
+		, size_t const & numJobs = sys::job::defaultNumJobs()
 		);
 
 	//! Tone-map multi-band color floating point image into 8-bit
@@ -129,6 +229,7 @@ namespace convert
 		( std::array<dat::grid<float>, 3u> const & inGrids
 		, dat::MinMax<float> const & inMinMax = dat::MinMax<float>()
 		, uint8_t const & useForNull = 0u
+		, size_t const & numJobs = sys::job::defaultNumJobs()
 		);
 
 	//! Convert to 8-bit with simple static cast
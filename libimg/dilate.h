@@ -41,8 +41,11 @@
 #include "libdat/IndexIterator.h"
 #include "libmath/Extreme.h"
 #include "libmath/math.h"
+#include "libsys/job.h"
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "libdat/info.h"
 #include "libio/stream.h"
@@ -68,6 +71,26 @@ namespace dilate
 	dat::grid<ElemType>
 	floodFilled
 		( dat::grid<ElemType> const & srcGrid
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	/*! Fill *NULL* elements of *ptGrid in place (same result as floodFilled).
+	 *
+	 * Proceeds in passes: each pass sets every null element that has
+	 * a valid element in its (small) neighborhood to the value of the
+	 * nearest of those (first in row-major order if tied). Only null
+	 * elements near those filled in the previous pass are revisited,
+	 * so total work is proportional to the grid size. Neighborhoods
+	 * are evaluated concurrently (numJobs) within each pass.
+	 *
+	 * Returns the number of elements that were filled.
+	 */
+	template <typename ElemType>
+	inline
+	size_t
+	floodFill
+		( dat::grid<ElemType> * const & ptGrid
+		, size_t const & numJobs = sys::job::defaultNumJobs()
 		);
 
 } // dilate
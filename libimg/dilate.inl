@@ -269,6 +269,57 @@ namespace priv
 
 		return fillGrid;
 	}
+
+	//! Neighborhood half size for floodFill passes
+	constexpr size_t sFloodDelta{ 2u };
+
+	//! Fewest candidates per pass worth spreading across several jobs
+	constexpr size_t sMinFloodPerJob{ 4u * 1024u };
+
+	/*! Value of valid element nearest to (row,col) - else null.
+	 *
+	 * The neighborhood and tie-breaking are the same as used by
+	 * floodWithNearest() (with rcDel of sFloodDelta).
+	 */
+	template <typename ElemType>
+	inline
+	ElemType
+	nearestValidAt
+		( dat::grid<ElemType> const & grid
+		, size_t const & row
+		, size_t const & col
+		)
+	{
+		ElemType outElem{ dat::nullValue<ElemType>() };
+		size_t bestDistSq{ 0u };
+		dat::IndexIterator itRow
+			(indexIteratorFor(row, sFloodDelta, { 0u, grid.high() }));
+		for ( ; itRow ; ++itRow)
+		{
+			size_t const & lookRow = *itRow;
+			size_t const dRow
+				{ (lookRow < row) ? (row - lookRow) : (lookRow - row) };
+			dat::IndexIterator itCol
+				(indexIteratorFor(col, sFloodDelta, { 0u, grid.wide() }));
+			for ( ; itCol ; ++itCol)
+			{
+				size_t const & lookCol = *itCol;
+				ElemType const & tryElem = grid(lookRow, lookCol);
+				if (dat::isValid(tryElem))
+				{
+					size_t const dCol
+						{ (lookCol < col) ? (col - lookCol) : (lookCol - col) };
+					size_t const distSq{ dRow*dRow + dCol*dCol };
+					if ((! dat::isValid(outElem)) || (distSq < bestDistSq))
+					{
+						outElem = tryElem;
+						bestDistSq = distSq;
+					}
+				}
+			}
+		}
+		return outElem;
+	}
 }
 
 template <typename ElemType>
@@ -276,27 +327,107 @@ inline
 dat::grid<ElemType>
 floodFilled
 	( dat::grid<ElemType> const & srcGrid
+	, size_t const & numJobs
 	)
 {
 	dat::grid<ElemType> fillGrid(srcGrid);
+	floodFill(&fillGrid, numJobs);
+	return fillGrid;
+}
 
-	// seems faster to do less filling each iteration and use more iterations
-	// therefore, keep per iteration fill windows size smaller
-	constexpr size_t halfStep{ 2u }; // maybe forces cache misses if too big?
-	size_t fillCount{ fillGrid.size() };
-	for (size_t nn{0u} ; (0u < fillCount) ; ++nn)
+template <typename ElemType>
+inline
+size_t
+floodFill
+	( dat::grid<ElemType> * const & ptGrid
+	, size_t const & numJobs
+	)
+{
+	size_t numFilled{ 0u };
+	if (ptGrid && ptGrid->isValid())
 	{
-		size_t currFillCount{};
-		using priv::floodWithNearest;
-		fillGrid = floodWithNearest(fillGrid, halfStep, &currFillCount);
-		assert(! (fillCount < currFillCount));
-		if (fillCount == currFillCount)
+		dat::grid<ElemType> & grid = *ptGrid;
+		size_t const high{ grid.high() };
+		size_t const wide{ grid.wide() };
+		typename dat::grid<ElemType>::iterator const itBeg{ grid.begin() };
+
+		// first pass considers all null elements
+		std::vector<size_t> candNdxs;
+		for (size_t ndx{0u} ; ndx < grid.size() ; ++ndx)
 		{
-			break;
+			if (! dat::isValid(itBeg[ndx]))
+			{
+				candNdxs.emplace_back(ndx);
+			}
+		}
+
+		std::vector<ElemType> candElems;
+		std::vector<size_t> fillNdxs;
+		std::vector<bool> isQueued(grid.size(), false);
+		while (! candNdxs.empty())
+		{
+			// evaluate candidates w.r.t. grid state before this pass
+			candElems.assign(candNdxs.size(), dat::nullValue<ElemType>());
+			size_t const useJobs
+				{ (candNdxs.size() < priv::sMinFloodPerJob) ? 1u : numJobs };
+			sys::job::processRanges
+				( candNdxs.size()
+				, [&] (size_t const & candBeg, size_t const & candEnd)
+					{
+						for (size_t nn{candBeg} ; nn < candEnd ; ++nn)
+						{
+							size_t const & ndx = candNdxs[nn];
+							candElems[nn] = priv::nearestValidAt
+								(grid, (ndx / wide), (ndx % wide));
+						}
+					}
+				, useJobs
+				);
+
+			// apply fills for this pass
+			fillNdxs.clear();
+			for (size_t nn{0u} ; nn < candNdxs.size() ; ++nn)
+			{
+				if (dat::isValid(candElems[nn]))
+				{
+					itBeg[candNdxs[nn]] = candElems[nn];
+					fillNdxs.emplace_back(candNdxs[nn]);
+				}
+			}
+			numFilled += fillNdxs.size();
+
+			// next candidates: null elements with a fill in neighborhood
+			// i.e. those at [-1,+2] offsets (mirror of [-2,+1] windows)
+			std::vector<size_t> nextNdxs;
+			for (size_t const & fillNdx : fillNdxs)
+			{
+				size_t const fillRow{ fillNdx / wide };
+				size_t const fillCol{ fillNdx % wide };
+				size_t const rowBeg{ (0u < fillRow) ? (fillRow - 1u) : 0u };
+				size_t const rowEnd{ std::min(fillRow + 3u, high) };
+				size_t const colBeg{ (0u < fillCol) ? (fillCol - 1u) : 0u };
+				size_t const colEnd{ std::min(fillCol + 3u, wide) };
+				for (size_t row{rowBeg} ; row < rowEnd ; ++row)
+				{
+					for (size_t col{colBeg} ; col < colEnd ; ++col)
+					{
+						size_t const ndx{ row * wide + col };
+						if ((! isQueued[ndx]) && (! dat::isValid(itBeg[ndx])))
+						{
+							isQueued[ndx] = true;
+							nextNdxs.emplace_back(ndx);
+						}
+					}
+				}
+			}
+			for (size_t const & ndx : nextNdxs)
+			{
+				isQueued[ndx] = false;
+			}
+			candNdxs.swap(nextNdxs);
 		}
-		fillCount = currFillCount;
 	}
-	return fillGrid;
+	return numFilled;
 }
 
 } // dilate
@@ -38,6 +38,9 @@
 #include "libdat/grid.h"
 #include "libdat/SubExtents.h"
 #include "libdat/validity.h"
+#include "libsys/job.h"
+
+#include <vector>
 
 
 namespace img
@@ -55,6 +58,34 @@ namespace geo
 		, dat::SubExtents const & cropSub
 		);
 
+	/*! Grids for each of cropSubs in srcGrid (OutType cast of InType).
+	 *
+	 * Crops are extracted concurrently (numJobs) with row copies. As
+	 * for croppedGrid(), each crop must be inside srcGrid. Output
+	 * grids already in *ptOutGrids are reused if they are the crop
+	 * size (e.g. when extracting many chip sets in turn).
+	 * Returns true on success (else *ptOutGrids is unchanged).
+	 */
+	template <typename OutType, typename InType>
+	inline
+	bool
+	croppedGridsInto
+		( std::vector<dat::grid<OutType> > * const & ptOutGrids
+		, dat::grid<InType> const & srcGrid
+		, std::vector<dat::SubExtents> const & cropSubs
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! As croppedGridsInto() but return collection of new grids
+	template <typename OutType, typename InType>
+	inline
+	std::vector<dat::grid<OutType> >
+	croppedGrids
+		( dat::grid<InType> const & srcGrid
+		, std::vector<dat::SubExtents> const & cropSubs
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
 	//! Cropped data from center of srcGrid - (OutType static_cast of InType)
 	template <typename OutType, typename InType>
 	inline
@@ -85,6 +116,7 @@ namespace geo
 		, PixType const & backValue = dat::nullValue<PixType>()
 		, size_t const & pad = 0u
 		, PixType const & foreValue = dat::nullValue<PixType>()
+		, size_t const & numJobs = sys::job::defaultNumJobs()
 		);
 }
 
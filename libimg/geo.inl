@@ -38,7 +38,10 @@
 #include "libio/stream.h"
 #include "libmath/Extreme.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <type_traits>
 
 
 namespace img
@@ -48,6 +51,80 @@ namespace geo
 //======================================================================
 
 
+namespace
+{
+	//! Copy count elements from ptIn to ptOut (same trivially copyable type)
+	template <typename OutType, typename InType>
+	inline
+	void
+	copyRow
+		( OutType * const & ptOut
+		, InType const * const & ptIn
+		, size_t const & count
+		, std::true_type const & // isRawCopy
+		)
+	{
+		std::memcpy(ptOut, ptIn, count * sizeof(OutType));
+	}
+
+	//! Copy count elements from ptIn to ptOut (via static_cast)
+	template <typename OutType, typename InType>
+	inline
+	void
+	copyRow
+		( OutType * const & ptOut
+		, InType const * const & ptIn
+		, size_t const & count
+		, std::false_type const & // isRawCopy
+		)
+	{
+		for (size_t nn{0u} ; nn < count ; ++nn)
+		{
+			ptOut[nn] = static_cast<OutType>(ptIn[nn]);
+		}
+	}
+
+	//! Copy count elements from ptIn to ptOut (memcpy when possible)
+	template <typename OutType, typename InType>
+	inline
+	void
+	copyRow
+		( OutType * const & ptOut
+		, InType const * const & ptIn
+		, size_t const & count
+		)
+	{
+		using IsRawCopy = std::integral_constant
+			< bool
+			,  std::is_same<OutType, InType>::value
+			&& std::is_trivially_copyable<InType>::value
+			>;
+		copyRow(ptOut, ptIn, count, IsRawCopy{});
+	}
+
+	//! Copy cropSub area of srcGrid into (same size) *ptOutGrid
+	template <typename OutType, typename InType>
+	inline
+	void
+	copyCrop
+		( dat::grid<OutType> * const & ptOutGrid
+		, dat::grid<InType> const & srcGrid
+		, dat::SubExtents const & cropSub
+		)
+	{
+		dat::RowCol const & srcUL = cropSub.theUL;
+		size_t const wide{ cropSub.wide() };
+		for (size_t row{0u} ; row < cropSub.high() ; ++row)
+		{
+			copyRow
+				( ptOutGrid->beginRow(row)
+				, srcGrid.iterAt(srcUL[0] + row, srcUL[1])
+				, wide
+				);
+		}
+	}
+}
+
 template <typename OutType, typename InType>
 inline
 dat::grid<OutType>
@@ -60,18 +137,69 @@ croppedGrid
 
 	if (srcGrid.isValid() && cropSub.isValid())
 	{
-		dat::RowCol const & srcUL = cropSub.theUL;
-		typename dat::grid<OutType>::iterator itOut(outgrid.begin());
-		for (dat::ExtentsIterator iter(cropSub.theSize) ; iter ; ++iter)
+		copyCrop(&outgrid, srcGrid, cropSub);
+	}
+
+	return outgrid;
+}
+
+template <typename OutType, typename InType>
+inline
+bool
+croppedGridsInto
+	( std::vector<dat::grid<OutType> > * const & ptOutGrids
+	, dat::grid<InType> const & srcGrid
+	, std::vector<dat::SubExtents> const & cropSubs
+	, size_t const & numJobs
+	)
+{
+	bool okay{ false };
+	if (ptOutGrids && srcGrid.isValid())
+	{
+		// (re)use output grids
+		std::vector<dat::grid<OutType> > & outGrids = *ptOutGrids;
+		outGrids.resize(cropSubs.size());
+		for (size_t nn{0u} ; nn < cropSubs.size() ; ++nn)
 		{
-			dat::RowCol const & cropRowCol = *iter;
-			using dat::operator+;
-			dat::RowCol const srcRowCol(cropRowCol + srcUL);
-			*itOut++ = static_cast<OutType>(srcGrid(srcRowCol));
+			dat::Extents const & cropSize = cropSubs[nn].theSize;
+			if (! (outGrids[nn].hwSize() == cropSize))
+			{
+				outGrids[nn] = dat::grid<OutType>(cropSize);
+			}
 		}
+
+		// extract crops concurrently
+		sys::job::processRanges
+			( cropSubs.size()
+			, [&] (size_t const & cropBeg, size_t const & cropEnd)
+				{
+					for (size_t nn{cropBeg} ; nn < cropEnd ; ++nn)
+					{
+						if (cropSubs[nn].isValid())
+						{
+							copyCrop(&(outGrids[nn]), srcGrid, cropSubs[nn]);
+						}
+					}
+				}
+			, numJobs
+			);
+		okay = true;
 	}
+	return okay;
+}
 
-	return outgrid;
+template <typename OutType, typename InType>
+inline
+std::vector<dat::grid<OutType> >
+croppedGrids
+	( dat::grid<InType> const & srcGrid
+	, std::vector<dat::SubExtents> const & cropSubs
+	, size_t const & numJobs
+	)
+{
+	std::vector<dat::grid<OutType> > outGrids;
+	croppedGridsInto(&outGrids, srcGrid, cropSubs, numJobs);
+	return outGrids;
 }
 
 template <typename OutType, typename InType>
@@ -142,17 +270,22 @@ insertSubGrid
 	{
 		if (srcGrid.isValid() && srcSub.isValid() && ptOutGrid->isValid())
 		{
+			// clip to output grid
 			dat::RowCol const & outUL = srcSub.theUL;
 			dat::Extents const outSize{ ptOutGrid->hwSize() };
-			for (dat::ExtentsIterator iter{srcSub.theSize} ; iter ; ++iter)
+			if ((outUL[0] < outSize.high()) && (outUL[1] < outSize.wide()))
 			{
-				dat::RowCol const & srcRowCol = *iter;
-				using dat::operator+;
-				dat::RowCol const outRowCol(srcRowCol + outUL);
-				if (outSize.includes(outRowCol))
+				size_t const high
+					{ std::min(srcSub.high(), outSize.high() - outUL[0]) };
+				size_t const wide
+					{ std::min(srcSub.wide(), outSize.wide() - outUL[1]) };
+				for (size_t row{0u} ; row < high ; ++row)
 				{
-					(*ptOutGrid)(outRowCol)
-						= static_cast<OutType>(srcGrid(srcRowCol));
+					copyRow
+						( ptOutGrid->iterAt(outUL[0] + row, outUL[1])
+						, srcGrid.beginRow(row)
+						, wide
+						);
 				}
 			}
 		}
@@ -188,18 +321,16 @@ namespace
 		, PixType const & value1
 		)
 	{
-		for (dat::ExtentsIterator iter{ptGrid->hwSize()} ; iter ; ++iter)
+		for (size_t row{0u} ; row < ptGrid->high() ; ++row)
 		{
-			dat::RowCol const & rowcol = *iter;
-			bool const rowParity{ dat::isEven(rowcol[0]) };
-			bool const colParity{ dat::isEven(rowcol[1]) };
-			if (rowParity == colParity)
-			{
-				(*ptGrid)(rowcol) = value0;
-			}
-			else
+			// alternate starting value with row parity
+			PixType const & valueA = dat::isEven(row) ? value0 : value1;
+			PixType const & valueB = dat::isEven(row) ? value1 : value0;
+			typename dat::grid<PixType>::iterator itOut
+				{ ptGrid->beginRow(row) };
+			for (size_t col{0u} ; col < ptGrid->wide() ; ++col)
 			{
-				(*ptGrid)(rowcol) = value1;
+				*itOut++ = dat::isEven(col) ? valueA : valueB;
 			}
 		}
 	}
@@ -235,6 +366,7 @@ montageOf
 	, PixType const & // backValue
 	, size_t const & pad
 	, PixType const & // foreValue
+	, size_t const & numJobs
 	)
 {
 	using PixGrid = dat::grid<PixType>;
@@ -242,17 +374,18 @@ montageOf
 
 	if (end != beg)
 	{
-		// determine maximum item grid extents
+		// determine maximum item grid extents (so that tiles are disjoint)
+		// (Extreme retains elements for which comp(elem, current) is true)
 		using GridType = typename std::iterator_traits<FwdIter>::value_type;
 		math::Extreme<FwdIter> const exHigh
 			( beg, end
 			, [] (GridType const & dA, GridType const & dB)
-				{ return (dA.high() < dB.high()); }
+				{ return (dB.high() < dA.high()); }
 			);
 		math::Extreme<FwdIter> const exWide
 			( beg, end
 			, [] (GridType const & dA, GridType const & dB)
-				{ return (dA.wide() < dB.wide()); }
+				{ return (dB.wide() < dA.wide()); }
 			);
 		size_t const gap{ 2u*pad };
 		size_t const itemHigh{ exHigh.theExVal.high() + gap };
@@ -267,27 +400,38 @@ montageOf
 		dat::MinMax<PixType> const minmax{ activeMinMax<PixType>(beg, end) };
 		fillWithDither(&montage, minmax.min(), minmax.max());
 
-		// copy each source item into montage
-		FwdIter itSrc{ beg };
-		for (size_t row{0u} ; row < numRows ; ++row)
+		// copy source items into montage (tiles are disjoint)
+		std::vector<PixGrid const *> srcPtrs;
+		srcPtrs.reserve(numItems);
+		for (FwdIter itSrc{beg} ; end != itSrc ; ++itSrc)
 		{
-			size_t const rowOut{ pad + itemHigh * row };
-			for (size_t col{0u} ; (col < numCols) && (end != itSrc); ++col)
-			{
-				// access source grid
-				PixGrid const & srcGrid = *itSrc;
-				if (srcGrid.isValid())
+			PixGrid const & srcGrid = *itSrc;
+			srcPtrs.emplace_back(&srcGrid);
+		}
+		sys::job::processRanges
+			( numItems
+			, [&] (size_t const & itemBeg, size_t const & itemEnd)
 				{
-					// define output area
-					size_t const colOut{ pad + itemWide * col };
-					dat::RowCol const ulOut{ rowOut, colOut };
-					dat::SubExtents const crop(ulOut, srcGrid.hwSize());
-					// copy source elements into output
-					insertSubGrid(&montage, crop, srcGrid);
+					for (size_t nn{itemBeg} ; nn < itemEnd ; ++nn)
+					{
+						// access source grid
+						PixGrid const & srcGrid = *(srcPtrs[nn]);
+						if (srcGrid.isValid())
+						{
+							// define output area
+							size_t const row{ nn / numCols };
+							size_t const col{ nn % numCols };
+							size_t const rowOut{ pad + itemHigh * row };
+							size_t const colOut{ pad + itemWide * col };
+							dat::RowCol const ulOut{{ rowOut, colOut }};
+							dat::SubExtents const crop(ulOut, srcGrid.hwSize());
+							// copy source elements into output
+							insertSubGrid(&montage, crop, srcGrid);
+						}
+					}
 				}
-				++itSrc;
-			}
-		}
+			, numJobs
+			);
 	}
 
 	return montage;
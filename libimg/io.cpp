@@ -37,15 +37,17 @@
 #include "libdat/algorithm.h"
 #include "libimg/convert.h"
 #include "libimg/img.h"
+#include "libimg/pnm.h"
 #include "libimg/stats.h"
 #include "libio/sprintf.h"
-#include "libio/string.h"
 
 #include "extstb/stb.h"
 
 #include <cassert>
 #include <cmath>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <sstream>
 
 
@@ -90,112 +92,102 @@ loadFromPgm
 }
 */
 
-namespace
+dat::grid<uint8_t>
+loadFromPgm8
+	( std::string const & fpath
+	)
 {
-	static std::string const sHeaderString
-		( std::string("P0123456789")
-		+ std::string(::io::string::sWhiteSpace)
-		);
+	return pnm::loadGray8(fpath);
+}
 
-	//! True if cc is expected in PGM header
-	inline
-	bool
-	isInPgmHeader
-		( char const & cc
-		)
+std::vector<uint8_t>
+fileBytes
+	( std::string const & fpath
+	)
+{
+	std::vector<uint8_t> bytes;
+	std::ifstream ifs(fpath, std::ios::binary | std::ios::ate);
+	if (ifs.good())
 	{
-		return ::io::string::contains(sHeaderString, cc);
+		std::streamoff const fileSize{ ifs.tellg() };
+		if (0 < fileSize)
+		{
+			bytes.resize(static_cast<size_t>(fileSize));
+			ifs.seekg(0, std::ios::beg);
+			ifs.read(reinterpret_cast<char *>(bytes.data()), fileSize);
+			if (! (fileSize == ifs.gcount()))
+			{
+				bytes.clear();
+			}
+		}
 	}
+	return bytes;
+}
 
-
-	//! parse first four 'ascii' fields
-	std::vector<std::string>
-	headerFields
-		( std::istream & iss
+namespace
+{
+	//! Decode (via extstb) directly into pixels with NumChan bytes each
+	template <typename PixType, int NumChan>
+	bool
+	decodeInto
+		( dat::grid<PixType> * const & ptGrid
+		, std::vector<uint8_t> const & encoded
 		)
 	{
-		std::vector<std::string> fields;
-		char cc('\0');
-		std::string buffer;
-		while (iss && (! iss.eof()))
+		static_assert
+			( sizeof(PixType) == NumChan * sizeof(stbi_uc)
+			, "PixType must be packed NumChan bytes"
+			);
+		bool okay{ false };
+		constexpr size_t maxLen{ std::numeric_limits<int>::max() };
+		if (ptGrid && (! encoded.empty()) && (encoded.size() < maxLen))
 		{
-			// get next char
-			iss.get(cc);
-			if (isInPgmHeader(cc))
+			// decode from memory - stb state is (thread) local
+			int const len{ static_cast<int>(encoded.size()) };
+			int high{}, wide{}, deep{};
+			stbi_uc * const imgdat
+				{ stbi_load_from_memory
+					(encoded.data(), len, &wide, &high, &deep, NumChan)
+				};
+			if (imgdat && (NumChan == deep) && (0 < high) && (0 < wide))
 			{
-				// add to buffer
-				if (::io::string::isWhiteSpace(cc) && (! buffer.empty()))
+				// reuse grid storage if possible
+				dat::grid<PixType> & grid = *ptGrid;
+				size_t const uHigh{ static_cast<size_t>(high) };
+				size_t const uWide{ static_cast<size_t>(wide) };
+				if (! ((uHigh == grid.high()) && (uWide == grid.wide())))
 				{
-					fields.push_back(buffer);
-					buffer.clear();
-				}
-				else
-				{
-					buffer += cc;
+					grid = dat::grid<PixType>(uHigh, uWide);
 				}
+				size_t const numBytes{ grid.size() * sizeof(PixType) };
+				std::memcpy(grid.begin(), imgdat, numBytes);
+				okay = true;
 			}
-			else
-			{
-				// error: encounter non-header char before end of header
-				fields.clear();
-				break;
-			}
-
-			// stop when header has been read
-			if (4u == fields.size())
+			if (imgdat)
 			{
-				break;
+				stbi_image_free(imgdat);
 			}
 		}
-
-		return fields;
+		return okay;
 	}
 }
 
-dat::grid<uint8_t>
-loadFromPgm8
-	( std::string const & fpath
+bool
+decodeRgb8Into
+	( dat::grid<std::array<uint8_t, 3> > * const & ptGrid
+	, std::vector<uint8_t> const & encoded
 	)
 {
-	dat::grid<uint8_t> image8;
-	std::ifstream ifs(fpath, std::ios::binary);
-	if (ifs.good())
-	{
-		// read header info
-		std::vector<std::string> const header(headerFields(ifs));
-		if (4u == header.size())
-		{
-			assert("P5" == header[0]);
-			std::string const & widestr = header[1];
-			std::string const & highstr = header[2];
-			assert("255" == header[3]);
-
-			// allocate space
-			size_t const high(::io::string::from<size_t>(highstr, 0u));
-			size_t const wide(::io::string::from<size_t>(widestr, 0u));
-			if ((0u < high) && (0u < wide))
-			{
-				// allocate space for read operation
-				image8 = dat::grid<uint8_t>(high, wide);
-
-				// read data
-				size_t const expBytes(image8.byteSize());
-				ifs.read
-					( reinterpret_cast<char * const>(image8.begin())
-					, expBytes
-					);
+	return decodeInto<std::array<uint8_t, 3>, 3>(ptGrid, encoded);
+}
 
-				// if not enough to complete the image...
-				size_t const gotBytes(ifs.gcount());
-				if (gotBytes != expBytes)
-				{
-					// .. return null data
-					image8 = dat::grid<uint8_t>{};
-				}
-			}
-		}
-	}
-	return image8;
+bool
+decodeGray8Into
+	( dat::grid<uint8_t> * const & ptGrid
+	, std::vector<uint8_t> const & encoded
+	)
+{
+	return decodeInto<uint8_t, 1>(ptGrid, encoded);
 }
 
 namespace
@@ -207,20 +199,7 @@ namespace
 		)
 	{
 		dat::grid<std::array<uint8_t, 3> > grid;
-		int high{}, wide{}, deep{};
-		unsigned char * imgdat{ nullptr };
-		{ // guarded
-			std::lock_guard<std::mutex> lock(stb::gStbMutex);
-			imgdat = stbi_load(fpath.c_str(), &wide, &high, &deep, 3);
-		}
-		if (imgdat && (3u == deep))
-		{
-			grid = convert::gridRgb8From(high, wide, imgdat);
-		}
-		if (imgdat)
-		{
-			stbi_image_free(imgdat);
-		}
+		decodeRgb8Into(&grid, fileBytes(fpath));
 		return grid;
 	}
 }
@@ -249,27 +228,7 @@ loadFromPng8
 	dat::grid<uint8_t> grid;
 	if (! fpath.empty())
 	{
-		int wide{}, high{}, deep{};
-		unsigned char * imgdat{ nullptr };
-		{ // guarded
-			std::lock_guard<std::mutex> lock(stb::gStbMutex);
-			imgdat = stbi_load(fpath.c_str(), &wide, &high, &deep, 1);
-		}
-		if (imgdat && (1u == deep))
-		{
-			grid = dat::grid<uint8_t>(high, wide);
-			size_t const byteSize{ high * wide * sizeof(unsigned char) };
-			std::transform
-				( imgdat, imgdat + byteSize
-				, grid.begin()
-				, [] (unsigned char const & pix)
-					{ return static_cast<uint8_t>(pix); }
-				);
-		}
-		if (imgdat)
-		{
-			stbi_image_free(imgdat);
-		}
+		decodeGray8Into(&grid, fileBytes(fpath));
 	}
 	return grid;
 }
@@ -295,10 +254,11 @@ namespace
 	};
 
 	//! Return header for specific image size
+	template <typename PixType>
 	inline
 	FloatHeader
 	headerFor
-		( dat::grid<float> const & grid
+		( dat::grid<PixType> const & grid
 		)
 	{
 		FloatHeader header;
@@ -317,6 +277,7 @@ namespace
 	}
 
 	//! Number of bytes image requires for storage
+	template <typename PixType>
 	inline
 	size_t
 	imageSize
@@ -326,10 +287,110 @@ namespace
 		return
 			( header.theFormat.theHigh
 			* header.theFormat.theWide
-			* sizeof(float)
+			* sizeof(PixType)
 			);
 	}
 
+	/*! True if numDataBytes holds exactly the image described by header.
+	 *
+	 * FloatHeader has no element type tag, so this is what distinguishes
+	 * e.g. a half precision file from a float one (and rejects truncated
+	 * files or garbage sizes before any allocation).
+	 */
+	template <typename PixType>
+	inline
+	bool
+	isImageSize
+		( FloatHeader const & header
+		, size_t const & numDataBytes
+		)
+	{
+		size_t const & high = header.theFormat.theHigh;
+		size_t const & wide = header.theFormat.theWide;
+		size_t const maxPix{ numDataBytes / sizeof(PixType) };
+		return
+			(  (0u < high)
+			&& (0u < wide)
+			&& (wide <= (maxPix / high))
+			&& (imageSize<PixType>(header) == numDataBytes)
+			);
+	}
+
+	//! Load grid stored after FloatHeader - valid on success
+	template <typename PixType>
+	inline
+	dat::grid<PixType>
+	loadWithHeader
+		( std::string const & fpath
+		)
+	{
+		dat::grid<PixType> grid;
+		std::ifstream ifs(fpath, std::ios::binary | std::ios::ate);
+		if (ifs.good())
+		{
+			// file size (stream opened at end)
+			std::streamoff const fileSize(ifs.tellg());
+			ifs.seekg(0, std::ios::beg);
+			// space for header
+			FloatHeader header;
+			// read header
+			size_t const expNumHdr(headerSize());
+			ifs.read(header.theHeader, static_cast<long>(expNumHdr));
+			size_t const gotNumHdr(static_cast<size_t>(ifs.gcount()));
+			if ( (gotNumHdr == expNumHdr)
+			  && isImageSize<PixType>
+				(header, static_cast<size_t>(fileSize) - expNumHdr)
+			   )
+			{
+				// allocate image storage
+				grid = dat::grid<PixType>
+					(header.theFormat.theHigh, header.theFormat.theWide);
+				// read image
+				size_t const expNumImg(imageSize<PixType>(header));
+				ifs.read
+					( reinterpret_cast<char * const>(grid.begin())
+					, static_cast<long>(expNumImg)
+					);
+				size_t const gotNumImg(static_cast<size_t>(ifs.gcount()));
+				if (! (gotNumImg == expNumImg))
+				{
+					// else return null
+					grid = dat::grid<PixType>{};
+				}
+			}
+		}
+		return grid;
+	}
+
+	//! Save grid after FloatHeader - true on success
+	template <typename PixType>
+	inline
+	bool
+	saveWithHeader
+		( dat::grid<PixType> const & grid
+		, std::string const & fpath
+		)
+	{
+		bool okay(false);
+		if (grid.isValid())
+		{
+			// configure header
+			FloatHeader const header(headerFor(grid));
+			// open file
+			std::ofstream ofs(fpath, std::ios::binary);
+			// write header
+			ofs.write(header.theHeader, sizeof(FloatHeader));
+			// write image
+			ofs.write
+				( reinterpret_cast<char const *>(grid.begin())
+				, static_cast<long>(imageSize<PixType>(header))
+				);
+			// check status
+			okay = (! ofs.fail());
+		}
+		return okay;
+	}
+
 }
 
 
@@ -339,36 +400,15 @@ loadFromFloat
 	( std::string const & fpath
 	)
 {
-	dat::grid<float> grid;
-	std::ifstream ifs(fpath, std::ios::binary);
-	if (ifs.good())
-	{
-		// space for header
-		FloatHeader header;
-		// read header
-		size_t const expNumHdr(headerSize());
-		ifs.read(header.theHeader, static_cast<long>(expNumHdr));
-		size_t const gotNumHdr(static_cast<size_t>(ifs.gcount()));
-		if (gotNumHdr == expNumHdr)
-		{
-			// allocate image storage
-			grid = dat::grid<float>
-				(header.theFormat.theHigh, header.theFormat.theWide);
-			// read image
-			size_t const expNumImg(imageSize(header));
-			ifs.read
-				( reinterpret_cast<char * const>(grid.begin())
-				, static_cast<long>(expNumImg)
-				);
-			size_t const gotNumImg(static_cast<size_t>(ifs.gcount()));
-			if (! (gotNumImg == expNumImg))
-			{
-				// else return null
-				grid = dat::grid<float>{};
-			}
-		}
-	}
-	return grid;
+	return loadWithHeader<float>(fpath);
+}
+
+dat::grid<dat::f16_t>
+loadFromHalf
+	( std::string const & fpath
+	)
+{
+	return loadWithHeader<dat::f16_t>(fpath);
 }
 
 dat::grid<raw10::FourPix>
@@ -442,24 +482,16 @@ saveToFloat
 	, std::string const & fpath
 	)
 {
-	bool okay(false);
-	if (grid.isValid())
-	{
-		// configure header
-		FloatHeader const header(headerFor(grid));
-		// open file
-		std::ofstream ofs(fpath, std::ios::binary);
-		// write header
-		ofs.write(header.theHeader, sizeof(FloatHeader));
-		// write image
-		ofs.write
-			( reinterpret_cast<char const * const>(grid.begin())
-			, imageSize(header)
-			);
-		// check status
-		okay = (! ofs.fail());
-	}
-	return okay;
+	return saveWithHeader(grid, fpath);
+}
+
+bool
+saveToHalf
+	( dat::grid<dat::f16_t> const & grid
+	, std::string const & fpath
+	)
+{
+	return saveWithHeader(grid, fpath);
 }
 
 bool
@@ -512,40 +544,7 @@ savePgm
 	, std::string const & filename
 	)
 {
-	bool okay(false);
-
-	// check for valid input
-	if (grid.isValid())
-	{
-		// open file for output
-		std::ofstream ofs(filename, std::ios::binary);
-		if (ofs)
-		{
-			// write header
-			dat::Extents const inSize(grid.hwSize());
-			std::ostringstream oss;
-			oss << "P5" << '\n'
-				<< inSize.wide() << '\n' // col, row order for PGM
-				<< inSize.high() << '\n'
-				<< static_cast<int>(std::numeric_limits<uint8_t>::max()) << '\n'
-				;
-			std::string const header(oss.str());
-			ofs.write(header.data(), header.size());
-
-			// write data - for 8-bit, endian-ness doesn't matter
-			size_t const numBytes(grid.byteSize());
-			size_t const pos1(ofs.tellp());
-			ofs.write
-				( reinterpret_cast<char const * const>(grid.begin())
-				, numBytes
-				);
-			size_t const pos2(ofs.tellp());
-			size_t const gotBytes(pos2 - pos1);
-			okay = ((! ofs.fail()) && (gotBytes == numBytes));
-		}
-	}
-
-	return okay;
+	return pnm::save(grid, filename);
 }
 
 bool
@@ -554,40 +553,14 @@ savePpm
 	, std::string const & filename
 	)
 {
-	bool okay(false);
-	std::ofstream ofs(filename, std::ios::binary);
-
 	assert(srgbGrids[0].isValid());
 	assert(srgbGrids[1].isValid());
 	assert(srgbGrids[2].isValid());
 
-	// write header
-	dat::Extents const inSize(srgbGrids[0].hwSize());
-	std::ostringstream oss;
-	oss << "P6" << '\n'
-		<< inSize.wide() << '\n' // col, row order for PPM
-		<< inSize.high() << '\n'
-		<< static_cast<int>(std::numeric_limits<uint8_t>::max()) << '\n'
-		;
-	std::string const header(oss.str());
-	ofs.write(header.data(), header.size());
-
 	// multiplex image channels into PPM pixels
 	dat::grid<std::array<uint8_t, 3u> > const gridOfRgb
 		(convert::multiplexed<uint8_t>(srgbGrids));
-
-	// write data - for 8-bit, endian-ness doesn't matter
-	size_t const numBytes(gridOfRgb.byteSize());
-	size_t const pos1(ofs.tellp());
-	ofs.write
-		( reinterpret_cast<char const * const>(gridOfRgb.begin())
-		, numBytes
-		);
-	size_t const pos2(ofs.tellp());
-	size_t const gotBytes(pos2 - pos1);
-	okay = ((! ofs.fail()) && (gotBytes == numBytes));
-
-	return okay;
+	return pnm::save(gridOfRgb, filename);
 }
 
 bool
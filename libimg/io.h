@@ -35,12 +35,15 @@
 
 
 #include "libdat/grid.h"
+#include "libdat/types.h"
 #include "libimg/convert.h"
 #include "libimg/pixel.h"
 #include "libimg/raw10.h"
 
 #include <array>
 #include <fstream>
+#include <string>
+#include <vector>
 
 
 namespace img
@@ -80,12 +83,48 @@ namespace io
 		( std::string const & fpath
 		);
 
-	//! Load from floating point format - valid on success
+	//! Entire content of file as (encoded) bytes - empty on failure
+	std::vector<uint8_t>
+	fileBytes
+		( std::string const & fpath
+		);
+
+	/*! Decode 8-bit RGB (JPEG or PNG) content into *ptGrid.
+	 *
+	 * Safe to call concurrently (decoding is from memory with no
+	 * global lock). Storage of *ptGrid is reused if it already has
+	 * the image size (e.g. when decoding a sequence of frames).
+	 * Returns true on success (else *ptGrid is unchanged).
+	 */
+	bool
+	decodeRgb8Into
+		( dat::grid<std::array<uint8_t, 3> > * const & ptGrid
+		, std::vector<uint8_t> const & encoded
+		);
+
+	//! As decodeRgb8Into() but for single channel 8-bit (gray) content
+	bool
+	decodeGray8Into
+		( dat::grid<uint8_t> * const & ptGrid
+		, std::vector<uint8_t> const & encoded
+		);
+
+	/*! Load from floating point format - valid on success.
+	 *
+	 * Result is null unless the data after the header is exactly the
+	 * size of a float grid (e.g. is null for a saveToHalf() file).
+	 */
 	dat::grid<float>
 	loadFromFloat
 		( std::string const & fpath
 		);
 
+	//! Load from half precision (saveToHalf) format - as loadFromFloat()
+	dat::grid<dat::f16_t>
+	loadFromHalf
+		( std::string const & fpath
+		);
+
 	//! Extract contiguous data elements out of (padded) file content
 	dat::grid<raw10::FourPix>
 	loadFourPixGrid
@@ -109,6 +148,13 @@ namespace io
 		, std::string const & fpath
 		);
 
+	//! Save as saveToFloat() but with half precision data (half the size)
+	bool
+	saveToHalf
+		( dat::grid<dat::f16_t> const & grid
+		, std::string const & fpath
+		);
+
 	//! Save grid to ascii file in <row col value>
 	bool
 	saveToXyz
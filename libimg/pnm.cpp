@@ -0,0 +1,446 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Definitions for img::pnm
+*/
+
+
+#include "libimg/pnm.h"
+
+#include "libimg/io.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+
+namespace img
+{
+namespace pnm
+{
+
+namespace
+{
+	//! Largest header field value accepted
+	constexpr size_t sMaxField{ 1024u * 1024u * 1024u };
+
+	//! True for PNM header whitespace
+	inline
+	bool
+	isSpace
+		( uint8_t const & cc
+		)
+	{
+		return
+			(  (' ' == cc) || ('\t' == cc) || ('\n' == cc)
+			|| ('\r' == cc) || ('\v' == cc) || ('\f' == cc)
+			);
+	}
+
+	//! True for decimal digit
+	inline
+	bool
+	isDigit
+		( uint8_t const & cc
+		)
+	{
+		return (('0' <= cc) && (cc <= '9'));
+	}
+
+	//! Swap bytes of each 16-bit value (loop suited to auto-vectorizing)
+	inline
+	void
+	swapBytes16
+		( uint16_t * const & beg
+		, size_t const & numValues
+		)
+	{
+		for (size_t nn{0u} ; nn < numValues ; ++nn)
+		{
+			uint16_t const & value = beg[nn];
+			beg[nn] = static_cast<uint16_t>((value << 8u) | (value >> 8u));
+		}
+	}
+
+	//! True if host stores multi-byte values least significant first
+	inline
+	bool
+	isLittleEndian
+		()
+	{
+		uint16_t const probe{ 1u };
+		uint8_t first{ 0u };
+		std::memcpy(&first, &probe, 1u);
+		return (1u == first);
+	}
+
+	//! Pixel type attributes
+	template <typename PixType>
+	struct PixTraits
+	{
+		using Sample = PixType;
+		static constexpr size_t sNumChan{ 1u };
+	};
+
+	template <typename SampType>
+	struct PixTraits<std::array<SampType, 3u> >
+	{
+		using Sample = SampType;
+		static constexpr size_t sNumChan{ 3u };
+	};
+
+	//! Load grid if file is consistent with PixType
+	template <typename PixType>
+	dat::grid<PixType>
+	loadAs
+		( std::string const & fpath
+		)
+	{
+		using Traits = PixTraits<PixType>;
+		using Sample = typename Traits::Sample;
+		static_assert
+			( sizeof(PixType) == (Traits::sNumChan * sizeof(Sample))
+			, "PixType must be packed samples"
+			);
+
+		dat::grid<PixType> grid;
+		std::vector<uint8_t> const bytes(img::io::fileBytes(fpath));
+		uint8_t const * const beg{ bytes.data() };
+		Header const header(Header::from(beg, beg + bytes.size()));
+		if ( header.isValid()
+		  && (Traits::sNumChan == header.theNumChan)
+		  && (sizeof(Sample) == header.bytesPerSample())
+		  && ((header.theDataOffset + header.dataSize()) <= bytes.size())
+		   )
+		{
+			grid = dat::grid<PixType>(header.theHigh, header.theWide);
+			std::memcpy
+				(grid.begin(), beg + header.theDataOffset, header.dataSize());
+			if ((2u == sizeof(Sample)) && isLittleEndian())
+			{
+				swapBytes16
+					( reinterpret_cast<uint16_t *>(grid.begin())
+					, grid.size() * Traits::sNumChan
+					);
+			}
+		}
+		return grid;
+	}
+
+	//! Save grid samples after header
+	template <typename PixType>
+	bool
+	saveAs
+		( dat::grid<PixType> const & grid
+		, std::string const & fpath
+		, size_t const & maxVal
+		)
+	{
+		using Traits = PixTraits<PixType>;
+		using Sample = typename Traits::Sample;
+
+		bool okay{ false };
+		if (grid.isValid() && (0u < maxVal))
+		{
+			std::ofstream ofs(fpath, std::ios::binary);
+			if (ofs)
+			{
+				// header (with wide before high)
+				std::ostringstream oss;
+				oss << ((3u == Traits::sNumChan) ? "P6" : "P5") << '\n'
+					<< grid.wide() << ' ' << grid.high() << '\n'
+					<< maxVal << '\n';
+				std::string const hdr(oss.str());
+				ofs.write(hdr.data(), static_cast<std::streamsize>(hdr.size()));
+
+				char const * const data
+					{ reinterpret_cast<char const *>(grid.begin()) };
+				size_t const numBytes{ grid.byteSize() };
+				if ((1u == sizeof(Sample)) || (! isLittleEndian()))
+				{
+					ofs.write(data, static_cast<std::streamsize>(numBytes));
+				}
+				else
+				{
+					// swap to big-endian through a (modest size) buffer
+					constexpr size_t chunkValues{ 64u * 1024u };
+					std::vector<uint16_t> chunk(chunkValues);
+					size_t const numValues{ numBytes / sizeof(uint16_t) };
+					for (size_t nn{0u} ; nn < numValues ; nn += chunkValues)
+					{
+						size_t const num
+							{ std::min(chunkValues, numValues - nn) };
+						size_t const useBytes{ num * sizeof(uint16_t) };
+						char const * const src{ data + nn*sizeof(uint16_t) };
+						std::memcpy(chunk.data(), src, useBytes);
+						swapBytes16(chunk.data(), num);
+						ofs.write
+							( reinterpret_cast<char const *>(chunk.data())
+							, static_cast<std::streamsize>(useBytes)
+							);
+					}
+				}
+				okay = (! ofs.fail());
+			}
+		}
+		return okay;
+	}
+}
+
+// static
+Header
+Header :: from
+	( uint8_t const * const & beg
+	, uint8_t const * const & end
+	)
+{
+	Header header;
+	if (beg && end && ((beg + 2) < end) && ('P' == beg[0]))
+	{
+		size_t numChan{ 0u };
+		if ('5' == beg[1])
+		{
+			numChan = 1u;
+		}
+		else
+		if ('6' == beg[1])
+		{
+			numChan = 3u;
+		}
+
+		// state machine over (width, height, maxval) fields
+		enum State { Space, Comment, Number };
+		State state{ Space };
+		size_t values[3]{ 0u, 0u, 0u };
+		size_t numValues{ 0u };
+		uint8_t const * iter{ beg + 2 };
+		for ( ; (0u < numChan) && (iter < end) ; ++iter)
+		{
+			uint8_t const & cc = *iter;
+			if (Comment == state)
+			{
+				if (('\n' == cc) || ('\r' == cc))
+				{
+					state = Space;
+				}
+			}
+			else
+			if (isDigit(cc))
+			{
+				if (Space == state)
+				{
+					if ((iter == beg + 2) || (3u == numValues))
+					{
+						break; // field not separated or too many
+					}
+					state = Number;
+				}
+				size_t & value = values[numValues];
+				value = 10u * value + static_cast<size_t>(cc - '0');
+				if (sMaxField < value)
+				{
+					break; // unreasonable size
+				}
+			}
+			else
+			if (isSpace(cc))
+			{
+				if (Number == state)
+				{
+					++numValues;
+					state = Space;
+					if (3u == numValues)
+					{
+						// single whitespace precedes samples
+						++iter;
+						break;
+					}
+				}
+			}
+			else
+			if (('#' == cc) && (Space == state))
+			{
+				state = Comment;
+			}
+			else
+			{
+				break; // unexpected character
+			}
+		}
+
+		if ((3u == numValues) && (values[2] < 65536u))
+		{
+			header.theNumChan = numChan;
+			header.theWide = values[0];
+			header.theHigh = values[1];
+			header.theMaxVal = values[2];
+			header.theDataOffset = static_cast<size_t>(iter - beg);
+		}
+	}
+	return header;
+}
+
+bool
+Header :: isValid
+	() const
+{
+	return
+		(  ((1u == theNumChan) || (3u == theNumChan))
+		&& (0u < theWide)
+		&& (0u < theHigh)
+		&& (0u < theMaxVal) && (theMaxVal < 65536u)
+		);
+}
+
+size_t
+Header :: bytesPerSample
+	() const
+{
+	return ((theMaxVal < 256u) ? 1u : 2u);
+}
+
+size_t
+Header :: dataSize
+	() const
+{
+	return (theHigh * theWide * theNumChan * bytesPerSample());
+}
+
+std::string
+Header :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << " ";
+	}
+	if (isValid())
+	{
+		oss << "numChan: " << theNumChan
+			<< " high: " << theHigh
+			<< " wide: " << theWide
+			<< " maxVal: " << theMaxVal
+			<< " dataOffset: " << theDataOffset;
+	}
+	else
+	{
+		oss << " <null>";
+	}
+	return oss.str();
+}
+
+Header
+headerFor
+	( std::string const & fpath
+	)
+{
+	// headers are small, but comments can be of any size
+	std::vector<uint8_t> const bytes(img::io::fileBytes(fpath));
+	uint8_t const * const beg{ bytes.data() };
+	return Header::from(beg, beg + bytes.size());
+}
+
+dat::grid<uint8_t>
+loadGray8
+	( std::string const & fpath
+	)
+{
+	return loadAs<uint8_t>(fpath);
+}
+
+dat::grid<uint16_t>
+loadGray16
+	( std::string const & fpath
+	)
+{
+	return loadAs<uint16_t>(fpath);
+}
+
+dat::grid<std::array<uint8_t, 3u> >
+loadRgb8
+	( std::string const & fpath
+	)
+{
+	return loadAs<std::array<uint8_t, 3u> >(fpath);
+}
+
+dat::grid<std::array<uint16_t, 3u> >
+loadRgb16
+	( std::string const & fpath
+	)
+{
+	return loadAs<std::array<uint16_t, 3u> >(fpath);
+}
+
+bool
+save
+	( dat::grid<uint8_t> const & grid
+	, std::string const & fpath
+	)
+{
+	return saveAs(grid, fpath, 255u);
+}
+
+bool
+save
+	( dat::grid<uint16_t> const & grid
+	, std::string const & fpath
+	, uint16_t const & maxVal
+	)
+{
+	// maxval less than 256 would imply 8-bit samples
+	return saveAs(grid, fpath, std::max(maxVal, uint16_t{ 256u }));
+}
+
+bool
+save
+	( dat::grid<std::array<uint8_t, 3u> > const & grid
+	, std::string const & fpath
+	)
+{
+	return saveAs(grid, fpath, 255u);
+}
+
+bool
+save
+	( dat::grid<std::array<uint16_t, 3u> > const & grid
+	, std::string const & fpath
+	, uint16_t const & maxVal
+	)
+{
+	return saveAs(grid, fpath, std::max(maxVal, uint16_t{ 256u }));
+}
+
+} // pnm
+} // img
+
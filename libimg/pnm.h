@@ -0,0 +1,169 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef img_pnm_INCL_
+#define img_pnm_INCL_
+
+/*! \file
+\brief Declarations for img::pnm
+*/
+
+
+#include "libdat/grid.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace img
+{
+
+/*! \brief Binary PNM (P5 gray, P6 color) image files with 8/16-bit samples.
+
+Files are read with a single bulk read and the header is parsed
+directly from the buffer (including '#' comments). Samples are moved
+straight into (or out of) the pixel grids. Sixteen bit samples are
+big-endian in the file (as per the Netpbm specification) and are
+byte swapped in bulk.
+
+\par Example
+\dontinclude testimg/upnm.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+namespace pnm
+{
+	//! Parsed header information
+	struct Header
+	{
+		size_t theNumChan{ 0u }; //!< 1 for P5, 3 for P6
+		size_t theWide{ 0u };
+		size_t theHigh{ 0u };
+		size_t theMaxVal{ 0u };
+		size_t theDataOffset{ 0u }; //!< Start of samples in file
+
+		//! Header from content (null if not a valid P5/P6 header)
+		static
+		Header
+		from
+			( uint8_t const * const & beg
+			, uint8_t const * const & end
+			);
+
+		//! True if this instance is valid
+		bool
+		isValid
+			() const;
+
+		//! Number of bytes per sample (1 or 2)
+		size_t
+		bytesPerSample
+			() const;
+
+		//! Number of bytes in all samples
+		size_t
+		dataSize
+			() const;
+
+		//! Descriptive information about this instance.
+		std::string
+		infoString
+			( std::string const & title = std::string()
+			) const;
+	};
+
+	//! Header for file (null on failure)
+	Header
+	headerFor
+		( std::string const & fpath
+		);
+
+	//! Load 8-bit P5 image (null if file has other format)
+	dat::grid<uint8_t>
+	loadGray8
+		( std::string const & fpath
+		);
+
+	//! Load 16-bit P5 image (null if file has other format)
+	dat::grid<uint16_t>
+	loadGray16
+		( std::string const & fpath
+		);
+
+	//! Load 8-bit P6 image (null if file has other format)
+	dat::grid<std::array<uint8_t, 3u> >
+	loadRgb8
+		( std::string const & fpath
+		);
+
+	//! Load 16-bit P6 image (null if file has other format)
+	dat::grid<std::array<uint16_t, 3u> >
+	loadRgb16
+		( std::string const & fpath
+		);
+
+	//! Save as 8-bit P5 - true on success
+	bool
+	save
+		( dat::grid<uint8_t> const & grid
+		, std::string const & fpath
+		);
+
+	//! Save as 16-bit P5 (with maxval) - true on success
+	bool
+	save
+		( dat::grid<uint16_t> const & grid
+		, std::string const & fpath
+		, uint16_t const & maxVal = { 65535u }
+		);
+
+	//! Save as 8-bit P6 - true on success
+	bool
+	save
+		( dat::grid<std::array<uint8_t, 3u> > const & grid
+		, std::string const & fpath
+		);
+
+	//! Save as 16-bit P6 (with maxval) - true on success
+	bool
+	save
+		( dat::grid<std::array<uint16_t, 3u> > const & grid
+		, std::string const & fpath
+		, uint16_t const & maxVal = { 65535u }
+		);
+}
+
+}
+
+// Inline definitions
+// #include "libimg/pnm.inl"
+
+#endif // img_pnm_INCL_
+
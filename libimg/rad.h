@@ -38,6 +38,7 @@
 #include "libmath/Partition.h"
 #include "libdat/Region.h"
 #include "libprob/Histogram.h"
+#include "libsys/job.h"
 
 #include <utility>
 #include <array>
@@ -50,13 +51,19 @@ namespace img
 namespace rad
 {
 
-	//! Histogram-equalized grid -- TODO move someplace (to libprob?)
+	/*! \brief Histogram-equalized grid -- TODO move someplace (to libprob?)
+	 *
+	 * The equalization function is baked into a lookup table (direct
+	 * code table for uint8_t/uint16_t pixels, else an interpolated
+	 * prob::RemapTable) which is applied concurrently to groups of rows.
+	 */
 	template <typename PixType>
 	inline
 	dat::grid<PixType>
 	equalized
 		( dat::grid<PixType> const & from
 		, math::Partition const & part
+		, size_t const & numJobs = sys::job::defaultNumJobs()
 		);
 
 	//! Histograms for (all, only active) pixels within areas
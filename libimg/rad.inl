@@ -37,6 +37,8 @@
 #include "libprob/Remapper.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <vector>
 
 
 
@@ -46,12 +48,105 @@ namespace rad
 {
 //======================================================================
 
+//! Private utilities for img::rad implementations
+namespace priv
+{
+	//! Apply remapping to all pixels via interpolated lookup table
+	template <typename PixType>
+	inline
+	void
+	remapGrid
+		( dat::grid<PixType> * const & ptInto
+		, dat::grid<PixType> const & from
+		, prob::Remapper const & rem
+		, size_t const & lutSize
+		, size_t const & numJobs
+		)
+	{
+		prob::RemapTable const table(rem.lookupTable(lutSize));
+		size_t const wide{ from.wide() };
+		sys::job::processRanges
+			( from.high()
+			, [&table, &from, &ptInto, &wide]
+				(size_t const & rowBeg, size_t const & rowEnd)
+				{
+					PixType const * const inBeg{ from.beginRow(rowBeg) };
+					PixType const * const inEnd
+						{ inBeg + (rowEnd - rowBeg) * wide };
+					table.transform(inBeg, inEnd, ptInto->beginRow(rowBeg));
+				}
+			, numJobs
+			);
+	}
+
+	//! Apply remapping to all pixels via direct lookup of each code value
+	template <typename UType>
+	inline
+	void
+	remapCodeGrid
+		( dat::grid<UType> * const & ptInto
+		, dat::grid<UType> const & from
+		, prob::Remapper const & rem
+		, size_t const & numJobs
+		)
+	{
+		std::vector<UType> const codes(rem.codeValues<UType>());
+		UType const * const lut{ codes.data() };
+		size_t const wide{ from.wide() };
+		sys::job::processRanges
+			( from.high()
+			, [&lut, &from, &ptInto, &wide]
+				(size_t const & rowBeg, size_t const & rowEnd)
+				{
+					UType const * const inBeg{ from.beginRow(rowBeg) };
+					UType const * const inEnd
+						{ inBeg + (rowEnd - rowBeg) * wide };
+					UType * ptOut{ ptInto->beginRow(rowBeg) };
+					for (UType const * ptIn{inBeg} ; inEnd != ptIn ; ++ptIn)
+					{
+						*ptOut++ = lut[*ptIn];
+					}
+				}
+			, numJobs
+			);
+	}
+
+	//! Specialization for 8-bit data - uses direct code lookup
+	inline
+	void
+	remapGrid
+		( dat::grid<uint8_t> * const & ptInto
+		, dat::grid<uint8_t> const & from
+		, prob::Remapper const & rem
+		, size_t const & // lutSize
+		, size_t const & numJobs
+		)
+	{
+		remapCodeGrid(ptInto, from, rem, numJobs);
+	}
+
+	//! Specialization for 16-bit data - uses direct code lookup
+	inline
+	void
+	remapGrid
+		( dat::grid<uint16_t> * const & ptInto
+		, dat::grid<uint16_t> const & from
+		, prob::Remapper const & rem
+		, size_t const & // lutSize
+		, size_t const & numJobs
+		)
+	{
+		remapCodeGrid(ptInto, from, rem, numJobs);
+	}
+}
+
 template <typename PixType>
 inline
 dat::grid<PixType>
 equalized
 	( dat::grid<PixType> const & from
 	, math::Partition const & part
+	, size_t const & numJobs
 	)
 {
 	dat::grid<PixType> into(from.hwSize());
@@ -72,7 +167,17 @@ equalized
 
 	// remap values to uniform distribution
 	prob::Remapper const rem(cdfFwd, cdfInv);
-	std::transform(from.begin(), from.end(), into.begin(), rem);
+	if (rem.isValid())
+	{
+		// forward cdf is linear over each partition bin and inverse is
+		// linear overall, so a table node per bin reproduces remapper
+		size_t const lutSize{ part.size() };
+		priv::remapGrid(&into, from, rem, lutSize, numJobs);
+	}
+	else
+	{
+		std::fill(into.begin(), into.end(), dat::nullValue<PixType>());
+	}
 
 	// return results
 	return into;
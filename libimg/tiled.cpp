@@ -0,0 +1,808 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Definitions for img::tiled
+*/
+
+
+#include "libimg/tiled.h"
+
+#include "libdat/info.h"
+
+#include "extstb/stb.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+
+namespace img
+{
+namespace tiled
+{
+
+namespace
+{
+	//! Identification of file format (and version)
+	constexpr char sMagic[8]{ 't', 'p', 'q', 'z', 'T', 'I', 'L', '1' };
+
+	//! Deflate compression level used for tiles
+	constexpr int sZipQuality{ 8 };
+
+	//! File header (fixed size, no padding)
+	struct FileHeader
+	{
+		char theMagic[8];
+		uint64_t theHigh;
+		uint64_t theWide;
+		uint64_t theTileHigh;
+		uint64_t theTileWide;
+		uint32_t thePixCode;
+		uint32_t theIsCompressed;
+	};
+
+	//! Number of bytes in tile (uncompressed)
+	inline
+	size_t
+	tileByteSize
+		( dat::SubExtents const & area
+		, size_t const & bpp
+		)
+	{
+		return (area.high() * area.wide() * bpp);
+	}
+
+	/*! True if tile data [offset, offset+numBytes) is within file data.
+	 *
+	 * Data must follow header and index (at dataBeg) and end within
+	 * fileSize. Uncompressed tiles must have exactly numTileBytes and
+	 * compressed tiles must be non-empty (and addressable as int).
+	 */
+	inline
+	bool
+	isValidEntry
+		( uint64_t const & offset
+		, uint64_t const & numBytes
+		, uint64_t const & dataBeg
+		, uint64_t const & fileSize
+		, size_t const & numTileBytes
+		, bool const & isCompressed
+		)
+	{
+		bool okay
+			{  (dataBeg <= offset)
+			&& (offset <= fileSize)
+			&& (numBytes <= (fileSize - offset))
+			};
+		if (okay)
+		{
+			if (isCompressed)
+			{
+				constexpr uint64_t maxZip
+					{ static_cast<uint64_t>(std::numeric_limits<int>::max()) };
+				okay = ((0u < numBytes) && (numBytes <= maxZip));
+			}
+			else
+			{
+				okay = (numTileBytes == numBytes);
+			}
+		}
+		return okay;
+	}
+
+	//! Group bytes by significance: out[kk*numPix + pp] = in[pp*bpp + kk]
+	inline
+	void
+	shuffleBytes
+		( uint8_t const * const & inBytes
+		, size_t const & numPix
+		, size_t const & bpp
+		, uint8_t * const & outBytes
+		)
+	{
+		for (size_t pp{0u} ; pp < numPix ; ++pp)
+		{
+			for (size_t kk{0u} ; kk < bpp ; ++kk)
+			{
+				outBytes[kk*numPix + pp] = inBytes[pp*bpp + kk];
+			}
+		}
+	}
+
+	//! Inverse of shuffleBytes()
+	inline
+	void
+	unshuffleBytes
+		( uint8_t const * const & inBytes
+		, size_t const & numPix
+		, size_t const & bpp
+		, uint8_t * const & outBytes
+		)
+	{
+		for (size_t pp{0u} ; pp < numPix ; ++pp)
+		{
+			for (size_t kk{0u} ; kk < bpp ; ++kk)
+			{
+				outBytes[pp*bpp + kk] = inBytes[kk*numPix + pp];
+			}
+		}
+	}
+
+	//! Read exactly numBytes from fd at offset - true on success
+	inline
+	bool
+	readAt
+		( int const & fd
+		, uint64_t const & offset
+		, size_t const & numBytes
+		, uint8_t * const & outBytes
+		)
+	{
+		size_t numDone{ 0u };
+		while (numDone < numBytes)
+		{
+			ssize_t const numGot
+				{ ::pread
+					( fd
+					, outBytes + numDone
+					, numBytes - numDone
+					, static_cast<off_t>(offset + numDone)
+					)
+				};
+			if (! (0 < numGot))
+			{
+				break;
+			}
+			numDone += static_cast<size_t>(numGot);
+		}
+		return (numBytes == numDone);
+	}
+
+	//! Encoded (possibly compressed) bytes for one tile
+	std::vector<uint8_t>
+	encodedTile
+		( Layout const & layout
+		, uint8_t const * const & pixBytes
+		, size_t const & tileNdx
+		, std::vector<uint8_t> * const & ptScratch
+		)
+	{
+		std::vector<uint8_t> tileBytes;
+		size_t const bpp{ bytesPerPix(layout.thePixCode) };
+		dat::SubExtents const area{ layout.tileArea(tileNdx) };
+		size_t const rowBytes{ area.wide() * bpp };
+		size_t const fullRowBytes{ layout.theHwSize.wide() * bpp };
+
+		// gather tile pixels into contiguous storage
+		std::vector<uint8_t> & raw = *ptScratch;
+		raw.resize(tileByteSize(area, bpp));
+		for (size_t row{0u} ; row < area.high() ; ++row)
+		{
+			size_t const fullRow{ area.theUL[0] + row };
+			uint8_t const * const src
+				{ pixBytes + fullRow*fullRowBytes + area.theUL[1]*bpp };
+			std::memcpy(raw.data() + row*rowBytes, src, rowBytes);
+		}
+
+		if (layout.theIsCompressed)
+		{
+			size_t const numPix{ area.high() * area.wide() };
+			tileBytes.resize(raw.size());
+			shuffleBytes(raw.data(), numPix, bpp, tileBytes.data());
+			int zipSize{ 0 };
+			unsigned char * const zip
+				{ stbi_zlib_compress
+					( tileBytes.data()
+					, static_cast<int>(tileBytes.size())
+					, &zipSize
+					, sZipQuality
+					)
+				};
+			if (zip && (0 < zipSize))
+			{
+				tileBytes.assign(zip, zip + zipSize);
+			}
+			else
+			{
+				tileBytes.clear();
+			}
+			std::free(zip);
+		}
+		else
+		{
+			tileBytes.swap(raw);
+		}
+		return tileBytes;
+	}
+
+	//! Subrange of [beg0,end0) that overlaps [beg1,end1) - may be empty
+	inline
+	std::pair<size_t, size_t>
+	overlapOf
+		( size_t const & beg0
+		, size_t const & end0
+		, size_t const & beg1
+		, size_t const & end1
+		)
+	{
+		size_t const beg{ std::max(beg0, beg1) };
+		size_t const end{ std::max(beg, std::min(end0, end1)) };
+		return { beg, end };
+	}
+}
+
+size_t
+bytesPerPix
+	( PixCode const & pixCode
+	)
+{
+	size_t bpp{ 0u };
+	switch (pixCode)
+	{
+		case PixCode::U8:
+			bpp = 1u;
+			break;
+		case PixCode::U16:
+		case PixCode::F16:
+			bpp = 2u;
+			break;
+		case PixCode::F32:
+			bpp = 4u;
+			break;
+		case PixCode::Unknown:
+			break;
+	}
+	return bpp;
+}
+
+// explicit
+Layout :: Layout
+	( dat::Extents const & hwSize
+	, dat::Extents const & hwTile
+	, PixCode const & pixCode
+	, bool const & isCompressed
+	)
+	: theHwSize{ hwSize }
+	, theHwTile{ hwTile }
+	, thePixCode{ pixCode }
+	, theIsCompressed{ isCompressed }
+{
+}
+
+bool
+Layout :: isValid
+	() const
+{
+	// tile (compression) buffers are addressed with int
+	constexpr size_t maxTileBytes
+		{ static_cast<size_t>(std::numeric_limits<int>::max()) };
+	size_t const bpp{ bytesPerPix(thePixCode) };
+	return
+		(  theHwSize.isValid()
+		&& theHwTile.isValid()
+		&& (0u < bpp)
+		&& (theHwTile.size() < (maxTileBytes / bpp))
+		);
+}
+
+dat::Extents
+Layout :: hwTileCounts
+	() const
+{
+	dat::Extents counts;
+	if (isValid())
+	{
+		counts = dat::Extents
+			( (theHwSize.high() + theHwTile.high() - 1u) / theHwTile.high()
+			, (theHwSize.wide() + theHwTile.wide() - 1u) / theHwTile.wide()
+			);
+	}
+	return counts;
+}
+
+size_t
+Layout :: numTiles
+	() const
+{
+	size_t num{ 0u };
+	if (isValid())
+	{
+		num = hwTileCounts().size();
+	}
+	return num;
+}
+
+dat::SubExtents
+Layout :: tileArea
+	( size_t const & tileNdx
+	) const
+{
+	dat::SubExtents area;
+	if (tileNdx < numTiles())
+	{
+		size_t const tileWide{ hwTileCounts().wide() };
+		size_t const row0{ (tileNdx / tileWide) * theHwTile.high() };
+		size_t const col0{ (tileNdx % tileWide) * theHwTile.wide() };
+		size_t const row1
+			{ std::min(row0 + theHwTile.high(), theHwSize.high()) };
+		size_t const col1
+			{ std::min(col0 + theHwTile.wide(), theHwSize.wide()) };
+		area = dat::SubExtents
+			( dat::RowCol{{ row0, col0 }}
+			, dat::Extents(row1 - row0, col1 - col0)
+			);
+	}
+	return area;
+}
+
+std::vector<size_t>
+Layout :: tilesFor
+	( dat::SubExtents const & crop
+	) const
+{
+	std::vector<size_t> tileNdxs;
+	if (isValid() && crop.isValid() && crop.fitsWithin(theHwSize))
+	{
+		dat::RowCol const & ul = crop.theUL;
+		dat::RowCol const br{ crop.insideCornerBR() };
+		size_t const tileWide{ hwTileCounts().wide() };
+		size_t const tr0{ ul[0] / theHwTile.high() };
+		size_t const tr1{ br[0] / theHwTile.high() + 1u };
+		size_t const tc0{ ul[1] / theHwTile.wide() };
+		size_t const tc1{ br[1] / theHwTile.wide() + 1u };
+		tileNdxs.reserve((tr1 - tr0) * (tc1 - tc0));
+		for (size_t tr{tr0} ; tr < tr1 ; ++tr)
+		{
+			for (size_t tc{tc0} ; tc < tc1 ; ++tc)
+			{
+				tileNdxs.emplace_back(tr * tileWide + tc);
+			}
+		}
+	}
+	return tileNdxs;
+}
+
+std::string
+Layout :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << " ";
+	}
+	if (isValid())
+	{
+		oss << dat::infoString(theHwSize, "hwSize");
+		oss << " " << dat::infoString(theHwTile, "hwTile");
+		oss << " bytesPerPix: " << bytesPerPix(thePixCode);
+		oss << " isCompressed: " << std::boolalpha << theIsCompressed;
+	}
+	else
+	{
+		oss << " <null>";
+	}
+	return oss.str();
+}
+
+bool
+saveBytes
+	( Layout const & layout
+	, uint8_t const * const & pixBytes
+	, std::string const & fpath
+	, size_t const & numJobs
+	)
+{
+	bool okay{ false };
+	if (layout.isValid() && pixBytes)
+	{
+		// encode tiles concurrently
+		size_t const numTiles{ layout.numTiles() };
+		std::vector<std::vector<uint8_t> > tileDatas(numTiles);
+		sys::job::processRanges
+			( numTiles
+			, [&layout, &pixBytes, &tileDatas]
+				( size_t const & beg
+				, size_t const & end
+				)
+				{
+					std::vector<uint8_t> scratch;
+					for (size_t nn{beg} ; nn < end ; ++nn)
+					{
+						tileDatas[nn] = encodedTile
+							(layout, pixBytes, nn, &scratch);
+					}
+				}
+			, numJobs
+			);
+
+		// assemble header and tile index
+		FileHeader header;
+		std::copy(sMagic, sMagic + sizeof(sMagic), header.theMagic);
+		header.theHigh = layout.theHwSize.high();
+		header.theWide = layout.theHwSize.wide();
+		header.theTileHigh = layout.theHwTile.high();
+		header.theTileWide = layout.theHwTile.wide();
+		header.thePixCode = static_cast<uint32_t>(layout.thePixCode);
+		header.theIsCompressed = (layout.theIsCompressed ? 1u : 0u);
+
+		std::vector<uint64_t> entries(2u * numTiles); // (offset, numBytes)
+		size_t const ndxSize{ entries.size() * sizeof(uint64_t) };
+		uint64_t offset{ sizeof(FileHeader) + ndxSize };
+		bool allEncoded{ true };
+		for (size_t nn{0u} ; nn < numTiles ; ++nn)
+		{
+			entries[2u*nn    ] = offset;
+			entries[2u*nn + 1u] = tileDatas[nn].size();
+			offset += tileDatas[nn].size();
+			allEncoded &= (! tileDatas[nn].empty());
+		}
+
+		// write file
+		if (allEncoded)
+		{
+			std::ofstream ofs(fpath, std::ios::binary);
+			ofs.write
+				( reinterpret_cast<char const *>(&header)
+				, sizeof(FileHeader)
+				);
+			ofs.write
+				( reinterpret_cast<char const *>(entries.data())
+				, static_cast<std::streamsize>(ndxSize)
+				);
+			for (std::vector<uint8_t> const & tileData : tileDatas)
+			{
+				ofs.write
+					( reinterpret_cast<char const *>(tileData.data())
+					, static_cast<std::streamsize>(tileData.size())
+					);
+			}
+			okay = (! ofs.fail());
+		}
+	}
+	return okay;
+}
+
+// explicit
+Reader :: Reader
+	( std::string const & fpath
+	, bool const & useMmap
+	)
+{
+	theFd = ::open(fpath.c_str(), O_RDONLY);
+	if (! (theFd < 0))
+	{
+		bool okay{ false };
+		uint64_t fileSize{ 0u };
+		struct stat info;
+		if ((0 == ::fstat(theFd, &info)) && (0 < info.st_size))
+		{
+			fileSize = static_cast<uint64_t>(info.st_size);
+		}
+
+		FileHeader header;
+		uint8_t * const hdrBytes{ reinterpret_cast<uint8_t *>(&header) };
+		if ( (sizeof(FileHeader) <= fileSize)
+		  && readAt(theFd, 0u, sizeof(FileHeader), hdrBytes)
+		   )
+		{
+			Layout const layout
+				( dat::Extents(header.theHigh, header.theWide)
+				, dat::Extents(header.theTileHigh, header.theTileWide)
+				, static_cast<PixCode>(header.thePixCode)
+				, (0u != header.theIsCompressed)
+				);
+			bool const isTiled
+				{ std::equal(sMagic, sMagic + sizeof(sMagic), header.theMagic)
+				};
+			// index must fit in file (before allocating space for it)
+			size_t const numTiles{ layout.numTiles() };
+			uint64_t const maxNdxSize{ fileSize - sizeof(FileHeader) };
+			uint64_t const entrySize{ 2u * sizeof(uint64_t) };
+			if ( isTiled && layout.isValid()
+			  && (numTiles <= (maxNdxSize / entrySize))
+			   )
+			{
+				std::vector<uint64_t> entries(2u * numTiles);
+				uint8_t * const ndxBytes
+					{ reinterpret_cast<uint8_t *>(entries.data()) };
+				size_t const ndxSize{ entries.size() * sizeof(uint64_t) };
+				if (readAt(theFd, sizeof(FileHeader), ndxSize, ndxBytes))
+				{
+					// reject file if any entry is outside of tile data
+					uint64_t const dataBeg{ sizeof(FileHeader) + ndxSize };
+					size_t const bpp{ bytesPerPix(layout.thePixCode) };
+					theEntries.resize(numTiles);
+					okay = true;
+					for (size_t nn{0u} ; okay && (nn < numTiles) ; ++nn)
+					{
+						TileEntry & entry = theEntries[nn];
+						entry.theOffset = entries[2u*nn];
+						entry.theNumBytes = entries[2u*nn + 1u];
+						size_t const numTileBytes
+							{ tileByteSize(layout.tileArea(nn), bpp) };
+						okay = isValidEntry
+							( entry.theOffset, entry.theNumBytes
+							, dataBeg, fileSize
+							, numTileBytes, layout.theIsCompressed
+							);
+					}
+					if (okay)
+					{
+						theLayout = layout;
+					}
+				}
+			}
+		}
+
+		// map uncompressed content (tile data are used in place)
+		if (okay && useMmap && (! theLayout.theIsCompressed))
+		{
+			size_t const mapSize{ static_cast<size_t>(fileSize) };
+			void * const addr
+				{ ::mmap(nullptr, mapSize, PROT_READ, MAP_SHARED, theFd, 0) };
+			if (MAP_FAILED != addr)
+			{
+				theMap = static_cast<uint8_t const *>(addr);
+				theMapSize = mapSize;
+			}
+		}
+
+		if (! okay)
+		{
+			::close(theFd);
+			theFd = -1;
+			theLayout = Layout{};
+			theEntries.clear();
+		}
+	}
+}
+
+Reader :: ~Reader
+	()
+{
+	if (theMap)
+	{
+		::munmap(const_cast<uint8_t *>(theMap), theMapSize);
+	}
+	if (! (theFd < 0))
+	{
+		::close(theFd);
+	}
+}
+
+bool
+Reader :: isValid
+	() const
+{
+	return
+		(  (! (theFd < 0))
+		&& theLayout.isValid()
+		&& (theLayout.numTiles() == theEntries.size())
+		);
+}
+
+Layout const &
+Reader :: layout
+	() const
+{
+	return theLayout;
+}
+
+bool
+Reader :: isMapped
+	() const
+{
+	return (nullptr != theMap);
+}
+
+dat::Extents
+Reader :: hwSize
+	() const
+{
+	return theLayout.theHwSize;
+}
+
+bool
+Reader :: copyRegionBytes
+	( dat::SubExtents const & crop
+	, uint8_t * const & outBytes
+	, size_t const & numJobs
+	) const
+{
+	std::vector<size_t> const tileNdxs{ theLayout.tilesFor(crop) };
+	if (! (isValid() && outBytes && (! tileNdxs.empty())))
+	{
+		return false;
+	}
+
+	size_t const bpp{ bytesPerPix(theLayout.thePixCode) };
+	size_t const cropRowBytes{ crop.wide() * bpp };
+	dat::RowCol const cropEnd{ crop.outsideCornerBR() };
+	std::atomic<bool> allOkay{ true };
+
+	// each tile fills a distinct portion of output
+	sys::job::processRanges
+		( tileNdxs.size()
+		, [this, &tileNdxs, &crop, &cropEnd, &bpp, &cropRowBytes
+		  , &outBytes, &allOkay]
+			( size_t const & beg
+			, size_t const & end
+			)
+			{
+				std::vector<uint8_t> fileData;
+				std::vector<uint8_t> tileData;
+				for (size_t nn{beg} ; nn < end ; ++nn)
+				{
+					size_t const & tileNdx = tileNdxs[nn];
+					uint8_t const * const tileBytes
+						{ tileBytesFor(tileNdx, &fileData, &tileData) };
+					if (! tileBytes)
+					{
+						allOkay = false;
+						continue;
+					}
+
+					// copy overlapping portion of each tile row
+					dat::SubExtents const area{ theLayout.tileArea(tileNdx) };
+					dat::RowCol const & ul = area.theUL;
+					dat::RowCol const & cropUL = crop.theUL;
+					dat::RowCol const areaEnd{ area.outsideCornerBR() };
+					std::pair<size_t, size_t> const rows
+						{ overlapOf(ul[0], areaEnd[0], cropUL[0], cropEnd[0]) };
+					std::pair<size_t, size_t> const cols
+						{ overlapOf(ul[1], areaEnd[1], cropUL[1], cropEnd[1]) };
+					size_t const tileRowBytes{ area.wide() * bpp };
+					size_t const copyBytes{ (cols.second - cols.first) * bpp };
+					for (size_t row{rows.first} ; row < rows.second ; ++row)
+					{
+						uint8_t const * const src
+							{ tileBytes
+							+ (row - ul[0]) * tileRowBytes
+							+ (cols.first - ul[1]) * bpp
+							};
+						uint8_t * const dst
+							{ outBytes
+							+ (row - cropUL[0]) * cropRowBytes
+							+ (cols.first - cropUL[1]) * bpp
+							};
+						std::memcpy(dst, src, copyBytes);
+					}
+				}
+			}
+		, numJobs
+		);
+
+	return allOkay;
+}
+
+std::string
+Reader :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << " ";
+	}
+	if (isValid())
+	{
+		oss << theLayout.infoString();
+		oss << " numTiles: " << theEntries.size();
+		oss << " isMapped: " << std::boolalpha << isMapped();
+	}
+	else
+	{
+		oss << " <null>";
+	}
+	return oss.str();
+}
+
+uint8_t const *
+Reader :: tileBytesFor
+	( size_t const & tileNdx
+	, std::vector<uint8_t> * const & ptFileData
+	, std::vector<uint8_t> * const & ptTileData
+	) const
+{
+	uint8_t const * tileBytes{ nullptr };
+	TileEntry const & entry = theEntries[tileNdx];
+	dat::SubExtents const area{ theLayout.tileArea(tileNdx) };
+	size_t const bpp{ bytesPerPix(theLayout.thePixCode) };
+	size_t const numTileBytes{ tileByteSize(area, bpp) };
+	std::vector<uint8_t> & fileData = *ptFileData;
+	std::vector<uint8_t> & tileData = *ptTileData;
+
+	if (theMap)
+	{
+		// use mapped content in place
+		if ( (entry.theNumBytes == numTileBytes)
+		  && (entry.theOffset <= theMapSize)
+		  && (numTileBytes <= (theMapSize - entry.theOffset))
+		   )
+		{
+			tileBytes = theMap + entry.theOffset;
+		}
+	}
+	else
+	if (! theLayout.theIsCompressed)
+	{
+		fileData.resize(numTileBytes);
+		if ( (entry.theNumBytes == numTileBytes)
+		  && readAt(theFd, entry.theOffset, numTileBytes, fileData.data())
+		   )
+		{
+			tileBytes = fileData.data();
+		}
+	}
+	else
+	{
+		// inflate and then restore byte order within pixels
+		// (entry.theNumBytes is bounded by file size - checked at open)
+		fileData.resize(static_cast<size_t>(entry.theNumBytes));
+		tileData.resize(numTileBytes);
+		if ( (! fileData.empty())
+		  && readAt(theFd, entry.theOffset, fileData.size(), fileData.data())
+		   )
+		{
+			int const numUnzip
+				{ stbi_zlib_decode_buffer
+					( reinterpret_cast<char *>(tileData.data())
+					, static_cast<int>(tileData.size())
+					, reinterpret_cast<char const *>(fileData.data())
+					, static_cast<int>(fileData.size())
+					)
+				};
+			if (static_cast<int>(numTileBytes) == numUnzip)
+			{
+				size_t const numPix{ area.high() * area.wide() };
+				fileData.resize(numTileBytes);
+				unshuffleBytes(tileData.data(), numPix, bpp, fileData.data());
+				tileBytes = fileData.data();
+			}
+		}
+	}
+	return tileBytes;
+}
+
+} // tiled
+} // img
+
@@ -0,0 +1,286 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef img_tiled_INCL_
+#define img_tiled_INCL_
+
+/*! \file
+\brief Declarations for img::tiled
+*/
+
+
+#include "libdat/Extents.h"
+#include "libdat/grid.h"
+#include "libdat/SubExtents.h"
+#include "libdat/types.h"
+#include "libsys/job.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace img
+{
+
+/*! \brief Tiled (chunked) raster file format with region of interest reads.
+
+The image is stored as a grid of fixed size tiles (edge tiles are
+clipped to the image) with an index of per-tile file offsets. A region
+read (Reader::readRegion) accesses only the tiles that overlap the
+region. Tiles are optionally compressed (lossless deflate after
+grouping bytes by significance) and are encoded and decoded in
+parallel. Uncompressed files are accessed via a memory map.
+
+Data are stored in host byte order (as with io::saveToFloat).
+
+\par Example
+\dontinclude testimg/utiled.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+namespace tiled
+{
+	//! Pixel data types supported in file
+	enum class PixCode : uint32_t
+	{
+		  Unknown = 0u
+		, U8 = 1u
+		, U16 = 2u
+		, F16 = 3u
+		, F32 = 4u
+	};
+
+	//! PixCode associated with PixType (Unknown if not supported)
+	template <typename PixType>
+	inline
+	PixCode
+	pixCodeFor
+		();
+
+	//! Number of bytes per pixel for code (zero if Unknown)
+	size_t
+	bytesPerPix
+		( PixCode const & pixCode
+		);
+
+	//! Default tile size
+	constexpr size_t sTileSize{ 256u };
+
+	//! Geometry of a tile decomposition
+	struct Layout
+	{
+		dat::Extents theHwSize;
+		dat::Extents theHwTile;
+		PixCode thePixCode{ PixCode::Unknown };
+		bool theIsCompressed{ false };
+
+		//! Construct a null instance
+		Layout
+			() = default;
+
+		//! Value construction
+		explicit
+		Layout
+			( dat::Extents const & hwSize
+			, dat::Extents const & hwTile
+			, PixCode const & pixCode
+			, bool const & isCompressed
+			);
+
+		//! True if this instance is valid
+		bool
+		isValid
+			() const;
+
+		//! Number of tiles in each of (row,col) directions
+		dat::Extents
+		hwTileCounts
+			() const;
+
+		//! Total number of tiles
+		size_t
+		numTiles
+			() const;
+
+		//! Area (in full image) covered by tile (row-major index)
+		dat::SubExtents
+		tileArea
+			( size_t const & tileNdx
+			) const;
+
+		//! Indices of tiles that overlap crop (which must fit in image)
+		std::vector<size_t>
+		tilesFor
+			( dat::SubExtents const & crop
+			) const;
+
+		//! Descriptive information about this instance.
+		std::string
+		infoString
+			( std::string const & title = std::string()
+			) const;
+	};
+
+	//! Save pixel bytes (of layout.theHwSize, row major) - true on success
+	bool
+	saveBytes
+		( Layout const & layout
+		, uint8_t const * const & pixBytes
+		, std::string const & fpath
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! Save grid to tiled file - true on success
+	template <typename PixType>
+	inline
+	bool
+	save
+		( dat::grid<PixType> const & grid
+		, std::string const & fpath
+		, bool const & compress = false
+		, dat::Extents const & hwTile = dat::Extents(sTileSize, sTileSize)
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! Access to tiled file content
+	class Reader
+	{
+		//! Location of tile data within file
+		struct TileEntry
+		{
+			uint64_t theOffset;
+			uint64_t theNumBytes;
+		};
+
+		Layout theLayout{};
+		std::vector<TileEntry> theEntries{};
+		int theFd{ -1 };
+		uint8_t const * theMap{ nullptr };
+		size_t theMapSize{ 0u };
+
+	public: // methods
+
+		//! Construct a null instance
+		Reader
+			() = default;
+
+		/*! Open file (and map uncompressed content if useMmap).
+		 *
+		 * Instance is invalid if any tile index entry does not lie
+		 * within the file (or has wrong size for uncompressed tile).
+		 */
+		explicit
+		Reader
+			( std::string const & fpath
+			, bool const & useMmap = true
+			);
+
+		// disable copy (instance owns file resources)
+		Reader(Reader const &) = delete;
+		Reader & operator=(Reader const &) = delete;
+
+		//! Release file resources
+		~Reader
+			();
+
+		//! True if file was successfully opened
+		bool
+		isValid
+			() const;
+
+		//! Tile decomposition for file
+		Layout const &
+		layout
+			() const;
+
+		//! True if content is accessed via memory map
+		bool
+		isMapped
+			() const;
+
+		//! Size of full image
+		dat::Extents
+		hwSize
+			() const;
+
+		/*! Copy crop area pixel bytes into (crop size) output buffer.
+		 *
+		 * Only tiles overlapping crop are read. Returns false if crop
+		 * does not fit within image or if any tile can not be read.
+		 */
+		bool
+		copyRegionBytes
+			( dat::SubExtents const & crop
+			, uint8_t * const & outBytes
+			, size_t const & numJobs = sys::job::defaultNumJobs()
+			) const;
+
+		//! Grid with crop area pixels (null if invalid or PixType mismatch)
+		template <typename PixType>
+		inline
+		dat::grid<PixType>
+		readRegion
+			( dat::SubExtents const & crop
+			, size_t const & numJobs = sys::job::defaultNumJobs()
+			) const;
+
+		//! Grid with full image
+		template <typename PixType>
+		inline
+		dat::grid<PixType>
+		readAll
+			( size_t const & numJobs = sys::job::defaultNumJobs()
+			) const;
+
+		//! Descriptive information about this instance.
+		std::string
+		infoString
+			( std::string const & title = std::string()
+			) const;
+
+	private:
+
+		//! Start of (uncompressed) tile pixel bytes - null on failure
+		uint8_t const *
+		tileBytesFor
+			( size_t const & tileNdx
+			, std::vector<uint8_t> * const & ptFileData //!< work space
+			, std::vector<uint8_t> * const & ptTileData //!< work space
+			) const;
+	};
+
+}
+
+}
+
+// Inline definitions
+#include "libimg/tiled.inl"
+
+#endif // img_tiled_INCL_
+
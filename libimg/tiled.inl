@@ -0,0 +1,145 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Inline definitions for img::tiled
+*/
+
+
+namespace img
+{
+namespace tiled
+{
+
+template <typename PixType>
+inline
+PixCode
+pixCodeFor
+	()
+{
+	return PixCode::Unknown;
+}
+
+template <>
+inline
+PixCode
+pixCodeFor<uint8_t>
+	()
+{
+	return PixCode::U8;
+}
+
+template <>
+inline
+PixCode
+pixCodeFor<uint16_t>
+	()
+{
+	return PixCode::U16;
+}
+
+template <>
+inline
+PixCode
+pixCodeFor<dat::f16_t>
+	()
+{
+	return PixCode::F16;
+}
+
+template <>
+inline
+PixCode
+pixCodeFor<float>
+	()
+{
+	return PixCode::F32;
+}
+
+template <typename PixType>
+inline
+bool
+save
+	( dat::grid<PixType> const & grid
+	, std::string const & fpath
+	, bool const & compress
+	, dat::Extents const & hwTile
+	, size_t const & numJobs
+	)
+{
+	bool okay{ false };
+	PixCode const pixCode{ pixCodeFor<PixType>() };
+	if (grid.isValid() && (sizeof(PixType) == bytesPerPix(pixCode)))
+	{
+		Layout const layout(grid.hwSize(), hwTile, pixCode, compress);
+		okay = saveBytes
+			( layout
+			, reinterpret_cast<uint8_t const *>(grid.begin())
+			, fpath
+			, numJobs
+			);
+	}
+	return okay;
+}
+
+template <typename PixType>
+inline
+dat::grid<PixType>
+Reader :: readRegion
+	( dat::SubExtents const & crop
+	, size_t const & numJobs
+	) const
+{
+	dat::grid<PixType> grid;
+	if (isValid() && (pixCodeFor<PixType>() == theLayout.thePixCode))
+	{
+		dat::grid<PixType> tmp(crop.theSize);
+		uint8_t * const outBytes{ reinterpret_cast<uint8_t *>(tmp.begin()) };
+		if (copyRegionBytes(crop, outBytes, numJobs))
+		{
+			grid = std::move(tmp);
+		}
+	}
+	return grid;
+}
+
+template <typename PixType>
+inline
+dat::grid<PixType>
+Reader :: readAll
+	( size_t const & numJobs
+	) const
+{
+	dat::SubExtents const full(dat::RowCol{{ 0u, 0u }}, hwSize());
+	return readRegion<PixType>(full, numJobs);
+}
+
+} // tiled
+} // img
+
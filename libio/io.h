@@ -39,6 +39,7 @@ Package-specific conventions for Input/Output involving strings and streams.
 \par Special Notes:
 
 + Provides thread-save wrapping for output streams.
++ Optional background (lock-free queued) delivery of stream messages.
 
 
 */
@@ -34,11 +34,16 @@
 #include "libsys/time.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
-#include <iterator>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace
@@ -48,6 +53,473 @@ namespace
 	std::vector<std::ostream *> localErrSinks;
 	std::vector<std::ostream *> localOutSinks;
 	std::vector<std::pair<std::ostream *, bool> > localLogSinks;
+
+	//! Destination category for a message
+	enum Kind
+	{
+		  ToErr
+		, ToOut
+		, ToLog
+	};
+
+	//! Write message to stream
+	void
+	putTo
+		( std::ostream * const & ostr
+		, std::string const & msg
+		)
+	{
+		ostr->write(msg.data(), static_cast<std::streamsize>(msg.size()));
+	}
+
+	//! Write (complete) message to all sinks for kind - sink mutex held
+	void
+	deliverLocked
+		( Kind const & kind
+		, std::string const & msg
+		)
+	{
+		if (ToErr == kind)
+		{
+			if (localErrSinks.empty())
+			{
+				localErrSinks.push_back(&std::cerr);
+			}
+			for (std::ostream * const & ostr : localErrSinks)
+			{
+				putTo(ostr, msg);
+				ostr->flush();
+			}
+		}
+		else
+		if (ToOut == kind)
+		{
+			if (localOutSinks.empty())
+			{
+				localOutSinks.push_back(&std::cout);
+			}
+			for (std::ostream * const & ostr : localOutSinks)
+			{
+				putTo(ostr, msg);
+				ostr->flush();
+			}
+		}
+		else
+		if (ToLog == kind)
+		{
+			for (std::pair<std::ostream *, bool> const & sink : localLogSinks)
+			{
+				std::ostream * const & ostr = sink.first;
+				bool const & useFlush = sink.second;
+				putTo(ostr, msg);
+				if (useFlush)
+				{
+					ostr->flush();
+				}
+			}
+		}
+	}
+
+	//! Write message to sinks (from calling thread)
+	void
+	deliver
+		( Kind const & kind
+		, std::string const & msg
+		)
+	{
+		std::lock_guard<std::mutex> lock(localSinkMutex);
+		deliverLocked(kind, msg);
+	}
+
+	/*! \brief Bounded lock-free multi-producer, single-consumer ring.
+	 *
+	 * Each slot carries a sequence number that indicates whether it
+	 * is ready to be filled (seq == pos) or ready to be consumed
+	 * (seq == pos + 1). Producers claim positions with a CAS on the
+	 * enqueue counter, so no producer ever blocks on a mutex. When the
+	 * ring is full, producers yield until the consumer frees a slot.
+	 */
+	class MessageRing
+	{
+		//! Element of ring
+		struct Slot
+		{
+			std::atomic<size_t> theSeq{ 0u };
+			Kind theKind{ ToOut };
+			std::string theMsg{};
+		};
+
+		size_t const theMask;
+		std::unique_ptr<Slot[]> const theSlots;
+		std::atomic<size_t> theEnqPos;
+		size_t theDeqPos; // only used by consumer
+
+	private: // disable
+
+		//! Disable implicit copy and assignment
+		MessageRing(MessageRing const &) = delete;
+		MessageRing & operator=(MessageRing const &) = delete;
+
+	public:
+
+		//! Allocate ring with (power of 2) size
+		explicit
+		MessageRing
+			( size_t const & sizePow2
+			)
+			: theMask{ sizePow2 - 1u }
+			, theSlots(new Slot[sizePow2])
+			, theEnqPos{ 0u }
+			, theDeqPos{ 0u }
+		{
+			for (size_t nn{0u} ; nn < sizePow2 ; ++nn)
+			{
+				theSlots[nn].theSeq.store(nn, std::memory_order_relaxed);
+			}
+		}
+
+		//! Number of messages claimed by producers so far
+		size_t
+		numPushed
+			() const
+		{
+			return theEnqPos.load(std::memory_order_acquire);
+		}
+
+		//! Number of messages removed by consumer so far
+		size_t
+		numPopped
+			() const
+		{
+			return theDeqPos;
+		}
+
+		//! Add message to ring (yields while ring is full)
+		void
+		push
+			( Kind const & kind
+			, std::string && msg
+			)
+		{
+			size_t pos{ theEnqPos.load(std::memory_order_relaxed) };
+			Slot * ptSlot{ nullptr };
+			for (;;)
+			{
+				ptSlot = &(theSlots[pos & theMask]);
+				size_t const seq
+					{ ptSlot->theSeq.load(std::memory_order_acquire) };
+				std::intptr_t const dif
+					{ static_cast<std::intptr_t>(seq)
+					- static_cast<std::intptr_t>(pos)
+					};
+				if (0 == dif)
+				{
+					if (theEnqPos.compare_exchange_weak
+						(pos, pos + 1u, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else
+				{
+					if (dif < 0) // full - wait for consumer
+					{
+						std::this_thread::yield();
+					}
+					pos = theEnqPos.load(std::memory_order_relaxed);
+				}
+			}
+			ptSlot->theKind = kind;
+			ptSlot->theMsg = std::move(msg);
+			ptSlot->theSeq.store(pos + 1u, std::memory_order_release);
+		}
+
+		//! True if next message is ready to pop - consumer thread only
+		bool
+		isReady
+			() const
+		{
+			Slot const & slot = theSlots[theDeqPos & theMask];
+			size_t const seq{ slot.theSeq.load(std::memory_order_acquire) };
+			return ((theDeqPos + 1u) == seq);
+		}
+
+		//! Remove next message (if any is ready) - consumer thread only
+		bool
+		pop
+			( Kind * const & ptKind
+			, std::string * const & ptMsg
+			)
+		{
+			bool got{ false };
+			Slot & slot = theSlots[theDeqPos & theMask];
+			size_t const seq{ slot.theSeq.load(std::memory_order_acquire) };
+			if ((theDeqPos + 1u) == seq)
+			{
+				*ptKind = slot.theKind;
+				ptMsg->swap(slot.theMsg);
+				slot.theMsg.clear();
+				slot.theSeq.store
+					(theDeqPos + theMask + 1u, std::memory_order_release);
+				++theDeqPos;
+				got = true;
+			}
+			return got;
+		}
+	};
+
+	//! Background writer draining a MessageRing into sinks
+	class AsyncWriter
+	{
+		MessageRing theRing;
+		std::atomic<size_t> theNumInPush{ 0u };
+		std::atomic<size_t> theNumWritten{ 0u };
+		std::atomic<bool> theIsAccepting{ true };
+		std::atomic<bool> theStopReq{ false };
+		std::atomic<bool> theIsIdle{ false };
+		std::mutex theWakeMutex{};
+		std::condition_variable theWakeCond{};
+		std::mutex theDoneMutex{};
+		std::condition_variable theDoneCond{};
+		std::thread theThread{};
+
+	private: // disable
+
+		//! Disable implicit copy and assignment
+		AsyncWriter(AsyncWriter const &) = delete;
+		AsyncWriter & operator=(AsyncWriter const &) = delete;
+
+	public:
+
+		//! Start writer thread
+		explicit
+		AsyncWriter
+			( size_t const & sizePow2
+			)
+			: theRing(sizePow2)
+		{
+			theThread = std::thread(&AsyncWriter::run, this);
+		}
+
+		//! Deliver pending messages and stop writer thread
+		~AsyncWriter
+			()
+		{
+			shutdown();
+		}
+
+		//! Stop accepting messages, deliver those pending, and end thread
+		void
+		shutdown
+			()
+		{
+			// stop accepting, then wait for producers already inside push
+			theIsAccepting.store(false);
+			while (0u < theNumInPush.load())
+			{
+				std::this_thread::yield();
+			}
+			{ std::lock_guard<std::mutex> lock(theWakeMutex);
+				theStopReq.store(true);
+			}
+			theWakeCond.notify_one();
+			if (theThread.joinable())
+			{
+				theThread.join();
+			}
+		}
+
+		//! Queue message - false if writer is shutting down (not queued)
+		bool
+		push
+			( Kind const & kind
+			, std::string && msg
+			)
+		{
+			bool queued{ false };
+			++theNumInPush;
+			if (theIsAccepting.load())
+			{
+				theRing.push(kind, std::move(msg));
+				wakeWriter();
+				queued = true;
+			}
+			--theNumInPush;
+			return queued;
+		}
+
+		//! Block until all messages queued before call have been written
+		void
+		flush
+			()
+		{
+			size_t const target{ theRing.numPushed() };
+			std::unique_lock<std::mutex> lock(theDoneMutex);
+			theDoneCond.wait
+				( lock
+				, [this, &target] { return (target <= theNumWritten.load()); }
+				);
+		}
+
+	private:
+
+		//! Signal writer thread if it is (about to be) waiting
+		void
+		wakeWriter
+			()
+		{
+			// pairs with fence in run(): either the writer sees the
+			// published slot or this thread sees the writer is idle
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (theIsIdle.load(std::memory_order_relaxed))
+			{
+				// writer is either before its predicate check or waiting
+				std::unique_lock<std::mutex> lock(theWakeMutex);
+				lock.unlock();
+				theWakeCond.notify_one();
+			}
+		}
+
+		//! Move available messages to sinks (return number written)
+		size_t
+		drain
+			()
+		{
+			size_t count{ 0u };
+			Kind kind{ ToOut };
+			std::string msg;
+			while (theRing.pop(&kind, &msg))
+			{
+				deliver(kind, msg);
+				++count;
+			}
+			if (0u < count)
+			{
+				{ std::lock_guard<std::mutex> lock(theDoneMutex);
+					theNumWritten.store(theRing.numPopped());
+				}
+				theDoneCond.notify_all();
+			}
+			return count;
+		}
+
+		//! Writer thread loop
+		void
+		run
+			()
+		{
+			for (;;)
+			{
+				if (0u == drain())
+				{
+					bool const allOut
+						{ theRing.numPopped() == theRing.numPushed() };
+					if (theStopReq.load() && allOut)
+					{
+						break;
+					}
+					// sleep until a producer publishes (or stop is requested)
+					std::unique_lock<std::mutex> lock(theWakeMutex);
+					theIsIdle.store(true, std::memory_order_relaxed);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					theWakeCond.wait
+						( lock
+						, [this]
+							{ return (theStopReq.load() || theRing.isReady()); }
+						);
+					theIsIdle.store(false, std::memory_order_relaxed);
+				}
+			}
+		}
+	};
+
+	std::mutex localAsyncMutex;
+	// Every writer started (current one last). Stopped writers are kept
+	// until exit since late producers may still hold a pointer to one
+	// (they then see it is not accepting and deliver directly).
+	std::vector<std::unique_ptr<AsyncWriter> > localAsyncWriters{};
+	std::atomic<AsyncWriter *> localPtAsync{ nullptr };
+
+	//! Ensure pending messages are written at (normal) program exit
+	struct AsyncGuard
+	{
+		~AsyncGuard
+			()
+		{
+			io::async::stop();
+		}
+	};
+	AsyncGuard const localAsyncGuard{};
+
+	//! Send message to background writer if active, else deliver directly
+	void
+	dispatch
+		( Kind const & kind
+		, std::string && msg
+		)
+	{
+		AsyncWriter * const ptAsync{ localPtAsync.load() };
+		if (! (ptAsync && ptAsync->push(kind, std::move(msg))))
+		{
+			deliver(kind, msg);
+		}
+	}
+}
+
+//
+// async
+//
+bool
+io::async :: start
+	( size_t const & ringSize
+	)
+{
+	std::lock_guard<std::mutex> lock(localAsyncMutex);
+	if (! localPtAsync.load())
+	{
+		// round up to power of two (for cheap index wrap)
+		size_t sizePow2{ 2u };
+		while (sizePow2 < ringSize)
+		{
+			sizePow2 *= 2u;
+		}
+		localAsyncWriters.emplace_back(new AsyncWriter(sizePow2));
+		localPtAsync.store(localAsyncWriters.back().get());
+	}
+	return true;
+}
+
+void
+io::async :: flush
+	()
+{
+	std::lock_guard<std::mutex> lock(localAsyncMutex);
+	AsyncWriter * const ptAsync{ localPtAsync.load() };
+	if (ptAsync)
+	{
+		ptAsync->flush();
+	}
+}
+
+void
+io::async :: stop
+	()
+{
+	std::lock_guard<std::mutex> lock(localAsyncMutex);
+	AsyncWriter * const ptAsync{ localPtAsync.load() };
+	if (ptAsync)
+	{
+		// new messages go direct - pending ones are drained by shutdown
+		localPtAsync.store(nullptr);
+		ptAsync->shutdown();
+	}
+}
+
+bool
+io::async :: isActive
+	()
+{
+	return (nullptr != localPtAsync.load());
 }
 
 //
@@ -108,26 +580,7 @@ io::err :: err
 io::err :: ~err
 	()
 {
-	std::lock_guard<std::mutex> lock(localSinkMutex);
-
-	if (localErrSinks.empty())
-	{
-		localErrSinks.push_back(&std::cerr);
-	}
-
-	for (std::vector<std::ostream*>::iterator
-		its(localErrSinks.begin()) ; its != localErrSinks.end() ; ++its)
-	{
-		std::ostream * const ostr(*its);
-
-		theOss.seekg(0);
-		std::istreambuf_iterator<char> in(theOss);
-		std::istreambuf_iterator<char> const eos;
-		std::ostreambuf_iterator<char> out(*ostr);
-		std::copy(in, eos, out);
-
-		ostr->flush();
-	}
+	dispatch(ToErr, theOss.str());
 }
 
 //
@@ -183,26 +636,7 @@ io::out :: out
 io::out :: ~out
 	()
 {
-	std::lock_guard<std::mutex> lock(localSinkMutex);
-
-	if (localOutSinks.empty())
-	{
-		localOutSinks.push_back(&std::cout);
-	}
-
-	for (std::vector<std::ostream*>::iterator
-		its(localOutSinks.begin()) ; its != localOutSinks.end() ; ++its)
-	{
-		std::ostream * const ostr(*its);
-
-		theOss.seekg(0);
-		std::istreambuf_iterator<char> in(theOss);
-		std::istreambuf_iterator<char> const eos;
-		std::ostreambuf_iterator<char> out(*ostr);
-		std::copy(in, eos, out);
-
-		ostr->flush();
-	}
+	dispatch(ToOut, theOss.str());
 }
 
 //
@@ -267,23 +701,5 @@ io::log :: log
 io::log :: ~log
 	()
 {
-	std::lock_guard<std::mutex> lock(localSinkMutex);
-
-	for (std::vector<std::pair<std::ostream*, bool>>::iterator
-		its(localLogSinks.begin()) ; its != localLogSinks.end() ; ++its)
-	{
-		std::ostream * const ostr = its->first;
-		bool const & useFlush = its->second;
-
-		theOss.seekg(0);
-		std::istreambuf_iterator<char> in(theOss);
-		std::istreambuf_iterator<char> const eos;
-		std::ostreambuf_iterator<char> out(*ostr);
-		std::copy(in, eos, out);
-
-		if (useFlush)
-		{
-			ostr->flush();
-		}
-	}
+	dispatch(ToLog, theOss.str());
 }
@@ -34,6 +34,7 @@
 */
 
 
+#include <cstddef>
 #include <sstream>
 
 
@@ -45,6 +46,44 @@
 namespace io
 {
 
+/*! \brief Optional background delivery of io::err, io::out, io::log messages.
+ *
+ * By default, each message is written to all sinks by the thread which
+ * created it (in the temporary's destructor) while holding a global
+ * sink mutex. After start(), completed messages are instead moved onto
+ * a lock-free ring and written to the sinks by a single background
+ * thread. Each message is still written as a unit and the sink
+ * registration functions (addSink/removeSink) are unchanged.
+ *
+ * start() and stop() are intended to be called at application setup
+ * and shutdown. Pending messages are delivered at stop() and at normal
+ * program exit. Use flush() e.g. before inspecting sinks or from a
+ * termination handler.
+ */
+namespace async
+{
+	//! Start background writer with ring of (at least) ringSize messages
+	bool
+	start
+		( size_t const & ringSize = 4096u
+		);
+
+	//! Block until all messages issued so far have reached the sinks
+	void
+	flush
+		();
+
+	//! Deliver pending messages, then revert to direct (synchronous) writes
+	void
+	stop
+		();
+
+	//! True if messages are currently delivered by background writer
+	bool
+	isActive
+		();
+}
+
 //! lock wrapper for std::cerr
 struct err
 {
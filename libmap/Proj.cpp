@@ -34,15 +34,62 @@
 
 #include "libmap/Proj.h"
 
+#include "libdat/cast.h"
 #include "libdat/info.h"
 #include "libdat/validity.h"
 
+#include <cmath>
 #include <sstream>
 
 
 namespace map
 {
 
+// static
+double
+Proj :: subIndexFor
+	( math::Partition const & part
+	, double const & value
+	)
+{
+	double fndx{ dat::nullValue<double>() };
+	// (part may run in either direction - i.e. not Partition::isValid())
+	double const span{ part.max() - part.min() };
+	if (dat::isValid(span) && (0. != span) && dat::isValid(value))
+	{
+		double const numParts{ static_cast<double>(part.size()) };
+		double const subNdx{ numParts * ((value - part.min()) / span) };
+		if ((! (subNdx < 0.)) && (subNdx < numParts))
+		{
+			fndx = subNdx;
+		}
+	}
+	return fndx;
+}
+
+// static
+double
+Proj :: wrappedIndexFor
+	( math::Partition const & part
+	, double const & angle
+	)
+{
+	double fndx{ dat::nullValue<double>() };
+	// (part may run in either direction - i.e. not Partition::isValid())
+	double const span{ part.max() - part.min() };
+	if (dat::isValid(span) && (0. != span) && dat::isValid(angle))
+	{
+		double const numParts{ static_cast<double>(part.size()) };
+		double const subNdx{ numParts * ((angle - part.min()) / span) };
+		fndx = subNdx - numParts * std::floor(subNdx / numParts);
+		if (! (fndx < numParts)) // roundoff just below a multiple
+		{
+			fndx = 0.;
+		}
+	}
+	return fndx;
+}
+
 // explicit
 Proj :: Proj
 	( dat::Extents const & hwSize
@@ -75,6 +122,29 @@ Proj :: gridRowColFor
 	return dat::nullValue<dat::RowCol>();
 }
 
+// virtual
+dat::Spot
+Proj :: gridSpotFor
+	( ga::Vector const & dir
+	) const
+{
+	dat::Spot spot(dat::nullValue<dat::Spot>());
+	dat::RowCol const rowcol(gridRowColFor(dir));
+	if (dat::isValid(rowcol))
+	{
+		spot = dat::cast::Spot(rowcol);
+	}
+	return spot;
+}
+
+// virtual
+bool
+Proj :: wrapsColumns
+	() const
+{
+	return false;
+}
+
 // virtual
 ga::Vector
 Proj :: directionFor
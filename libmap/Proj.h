@@ -35,8 +35,10 @@
 
 
 #include "libdat/Extents.h"
+#include "libdat/Spot.h"
 #include "libdat/types.h"
 #include "libga/ga.h"
+#include "libmath/Partition.h"
 
 #include <string>
 
@@ -56,6 +58,24 @@ class Proj
 
 	dat::Extents theGridSize{};
 
+protected: // helpers for derived classes
+
+	//! Fractional index of value in part (either direction) - or null
+	static
+	double
+	subIndexFor
+		( math::Partition const & part
+		, double const & value
+		);
+
+	//! Fractional index of angle in full circle part (wrapped into size)
+	static
+	double
+	wrappedIndexFor
+		( math::Partition const & part
+		, double const & angle
+		);
+
 public: // methods
 
 	//! Construct an invalid instance
@@ -95,6 +115,23 @@ public: // methods
 		( ga::Vector const & dir
 		) const;
 
+	/*! [Virtual] Raster location (with fractional part) for a direction
+	 *
+	 * Integral values correspond with directionFor() locations. The
+	 * default implementation is gridRowColFor() (i.e. no fraction).
+	 */
+	virtual
+	dat::Spot
+	gridSpotFor
+		( ga::Vector const & dir
+		) const;
+
+	//! [Virtual] True if last column is adjacent to first (full circle)
+	virtual
+	bool
+	wrapsColumns
+		() const;
+
 	//! [Virtual] Direction recovered from raster location
 	virtual
 	ga::Vector
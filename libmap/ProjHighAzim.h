@@ -37,6 +37,7 @@
 
 #include "libmath/Partition.h"
 
+#include "libdat/validity.h"
 #include "libgeo/sphere.h"
 
 
@@ -91,6 +92,21 @@ public: // methods
 		( ga::Vector const & dir
 		) const;
 
+	//! [Virtual] Raster location (with fraction) for a direction
+	inline
+	virtual
+	dat::Spot
+	gridSpotFor
+		( ga::Vector const & dir
+		) const;
+
+	//! [Virtual] True: azimuth columns span a full circle
+	inline
+	virtual
+	bool
+	wrapsColumns
+		() const;
+
 	//! [Virtual] Direction recovered from raster location
 	inline
 	virtual
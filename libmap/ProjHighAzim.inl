@@ -40,9 +40,10 @@ ProjHighAzim :: inRange
 	( double const & sinElv
 	) const
 {
+	// rows run from top (included) toward bottom
 	return
-		(  (theSinElvPair.first <= sinElv)
-		&& (sinElv < theSinElvPair.second)
+		(  (theSinElvPair.first < sinElv)
+		&& (sinElv <= theSinElvPair.second)
 		);
 }
 
@@ -54,21 +55,51 @@ ProjHighAzim :: gridRowColFor
 	) const
 {
 	dat::RowCol rowcol(dat::nullValue<dat::RowCol>());
-assert(! "check/test this before use");
-	// might be okay - but needs inspection testing
-	double const & sinElv = dir[3];
-	if (inRange(sinElv))
+	dat::Spot const spot(gridSpotFor(dir));
+	if (dat::isValid(spot))
 	{
-		double const azimuth{ geo::sphere::azimuthOf(dir) };
-		// TODO - use SinTable here
+		// (bin containing spot)
 		rowcol = dat::RowCol
-			{ thePartSinElv.binIndexFor(sinElv)
-			, thePartA.binIndexFor(azimuth)
-			};
+			{{ static_cast<size_t>(spot[0])
+			 , static_cast<size_t>(spot[1])
+			}};
 	}
 	return rowcol;
 }
 
+inline
+// virtual
+dat::Spot
+ProjHighAzim :: gridSpotFor
+	( ga::Vector const & dir
+	) const
+{
+	dat::Spot spot(dat::nullValue<dat::Spot>());
+	double const & sinElv = dir[2];
+	if (dir.isValid() && inRange(sinElv))
+	{
+		double const subRow{ subIndexFor(thePartSinElv, sinElv) };
+		if (dat::isValid(subRow))
+		{
+			double const azimuth{ geo::sphere::azimuthOf(dir) };
+			spot = dat::Spot
+				{{ subRow
+				 , wrappedIndexFor(thePartA, azimuth)
+				}};
+		}
+	}
+	return spot;
+}
+
+inline
+// virtual
+bool
+ProjHighAzim :: wrapsColumns
+	() const
+{
+	return true;
+}
+
 inline
 // virtual
 ga::Vector
@@ -96,6 +96,24 @@ public: // methods
 			};
 	}
 
+	//! [Virtual] Raster location (with fraction) for a direction
+	inline
+	virtual
+	dat::Spot
+	gridSpotFor
+		( ga::Vector const & dir
+		) const
+	{
+		double const azimuth{ geo::sphere::azimuthOf(dir) };
+		double const zenith{ geo::sphere::zenithOf(dir) };
+		double const lat{ math::halfPi - zenith };
+		double const xx{ (azimuth0 - azimuth)*std::cos(lat) };
+		return dat::Spot
+			{{ thePartZ.interpIndexFor(zenith)
+			 , thePartX.interpIndexFor(xx)
+			}};
+	}
+
 	//! [Virtual] Direction recovered from raster location
 	inline
 	virtual
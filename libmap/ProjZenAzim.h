@@ -82,6 +82,21 @@ public: // methods
 		( ga::Vector const & dir
 		) const;
 
+	//! [Virtual] Raster location (with fraction) for a direction
+	inline
+	virtual
+	dat::Spot
+	gridSpotFor
+		( ga::Vector const & dir
+		) const;
+
+	//! [Virtual] True: azimuth columns span a full circle
+	inline
+	virtual
+	bool
+	wrapsColumns
+		() const;
+
 	//! [Virtual] Direction recovered from raster location
 	inline
 	virtual
@@ -51,6 +51,30 @@ ProjZenAzim :: gridRowColFor
 		};
 }
 
+inline
+// virtual
+dat::Spot
+ProjZenAzim :: gridSpotFor
+	( ga::Vector const & dir
+	) const
+{
+	double const azimuth{ geo::sphere::azimuthOf(dir) };
+	double const zenith{ geo::sphere::zenithOf(dir) };
+	return dat::Spot
+		{{ thePartZ.interpIndexFor(zenith)
+		 , wrappedIndexFor(thePartA, azimuth)
+		}};
+}
+
+inline
+// virtual
+bool
+ProjZenAzim :: wrapsColumns
+	() const
+{
+	return true;
+}
+
 inline
 // virtual
 ga::Vector
@@ -0,0 +1,249 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Definitions for map::Reproject
+*/
+
+
+#include "libmap/Reproject.h"
+
+#include "libdat/info.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+
+namespace
+{
+	//! Null sample (no source data)
+	constexpr map::Reproject::Sample sNullSample
+		{ dat::nullValue<uint32_t>(), 0, 0.f, 0.f };
+
+	//! True if subNdx is within the cells about [0,size) locations
+	inline
+	bool
+	inCells
+		( double const & subNdx
+		, size_t const & size
+		)
+	{
+		return
+			(  (! (subNdx < -.5))
+			&& (subNdx < (static_cast<double>(size) - .5))
+			);
+	}
+
+	//! Upper-left index and fraction toward next for subNdx inCells()
+	std::pair<size_t, float>
+	baseFracFor
+		( double const & subNdx
+		, size_t const & size
+		)
+	{
+		// clamp outer half cells (which have no outer neighbor)
+		double const maxNdx{ static_cast<double>(size - 1u) };
+		double const useNdx{ std::max(0., std::min(subNdx, maxNdx)) };
+		size_t ndx{ static_cast<size_t>(std::floor(useNdx)) };
+		if ((1u < size) && (! (ndx < (size - 1u))))
+		{
+			ndx = size - 2u;
+		}
+		float const frac{ static_cast<float>(useNdx - double(ndx)) };
+		return { ndx, frac };
+	}
+
+	//! Table entry for (fractional) source location
+	map::Reproject::Sample
+	sampleFor
+		( dat::Spot const & srcSpot
+		, dat::Extents const & srcSize
+		, bool const & wrapCols
+		)
+	{
+		map::Reproject::Sample samp(sNullSample);
+		if (dat::isValid(srcSpot))
+		{
+			double const & subRow = srcSpot[0];
+			double subCol{ srcSpot[1] };
+			size_t const & wide = srcSize.wide();
+			if (wrapCols)
+			{
+				double const dWide{ static_cast<double>(wide) };
+				subCol -= dWide * std::floor(subCol / dWide);
+			}
+			if ( inCells(subRow, srcSize.high())
+			  && (wrapCols || inCells(subCol, wide))
+			   )
+			{
+				std::pair<size_t, float> const rowFrac
+					{ baseFracFor(subRow, srcSize.high()) };
+				std::pair<size_t, float> colFrac
+					{ baseFracFor(subCol, wide) };
+				int32_t colStep{ (1u < wide) ? 1 : 0 };
+				if (wrapCols && (1u < wide))
+				{
+					// interpolate across seam from last to first column
+					size_t const ndxCol{ static_cast<size_t>(subCol) };
+					colFrac.first = std::min(ndxCol, wide - 1u);
+					colFrac.second = static_cast<float>
+						(subCol - double(colFrac.first));
+					if ((wide - 1u) == colFrac.first)
+					{
+						colStep = -static_cast<int32_t>(wide - 1u);
+					}
+				}
+				size_t const ndx{ rowFrac.first * wide + colFrac.first };
+				samp.theNdx = static_cast<uint32_t>(ndx);
+				samp.theColStep = colStep;
+				samp.theFracRow = rowFrac.second;
+				samp.theFracCol = colFrac.second;
+			}
+		}
+		return samp;
+	}
+}
+
+namespace map
+{
+
+// explicit
+Reproject :: Reproject
+	( Proj const & srcProj
+	, Proj const & dstProj
+	, size_t const & numJobs
+	)
+	: Reproject
+		( srcProj
+		, dstProj.hwSize()
+		, [&dstProj] (dat::RowCol const & dstRC)
+			{ return dstProj.directionFor(dstRC); }
+		, numJobs
+		)
+{
+}
+
+// explicit
+Reproject :: Reproject
+	( Proj const & srcProj
+	, dat::Extents const & dstSize
+	, DirFunc const & dstDirFor
+	, size_t const & numJobs
+	)
+{
+	// table offsets must be representable in Sample::theNdx
+	dat::Extents const srcSize(srcProj.hwSize());
+	constexpr size_t maxSize{ std::numeric_limits<uint32_t>::max() };
+	if (srcProj.isValid() && dstSize.isValid() && (srcSize.size() < maxSize))
+	{
+		theSrcSize = srcSize;
+		theSamples = dat::grid<Sample>(dstSize);
+		theRowStep = (1u < srcSize.high()) ? srcSize.wide() : 0u;
+		bool const wrapCols{ srcProj.wrapsColumns() };
+
+		// evaluate projection geometry (once) for each element
+		sys::job::processRanges
+			( dstSize.high()
+			, [this, &srcProj, &dstDirFor, &srcSize, &wrapCols]
+				(size_t const & rowBeg, size_t const & rowEnd)
+				{
+					for (size_t row{rowBeg} ; row < rowEnd ; ++row)
+					{
+						Sample * itSamp{ theSamples.beginRow(row) };
+						for (size_t col{0u} ; col < theSamples.wide() ; ++col)
+						{
+							ga::Vector const dir(dstDirFor({{ row, col }}));
+							Sample samp(sNullSample);
+							if (dir.isValid())
+							{
+								samp = sampleFor
+									( srcProj.gridSpotFor(dir)
+									, srcSize, wrapCols
+									);
+							}
+							*itSamp++ = samp;
+						}
+					}
+				}
+			, numJobs
+			);
+	}
+}
+
+bool
+Reproject :: isValid
+	() const
+{
+	return
+		(  theSrcSize.isValid()
+		&& theSamples.isValid()
+		);
+}
+
+dat::Extents
+Reproject :: srcSize
+	() const
+{
+	return theSrcSize;
+}
+
+dat::Extents
+Reproject :: dstSize
+	() const
+{
+	return theSamples.hwSize();
+}
+
+std::string
+Reproject :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << std::endl;
+	}
+	if (isValid())
+	{
+		oss << dat::infoString(srcSize(), "srcSize");
+		oss << std::endl;
+		oss << dat::infoString(dstSize(), "dstSize");
+	}
+	else
+	{
+		oss << " <null>";
+	}
+	return oss.str();
+}
+
+} // map
+
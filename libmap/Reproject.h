@@ -0,0 +1,190 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef map_Reproject_INCL_
+#define map_Reproject_INCL_
+
+/*! \file
+\brief Declarations for map::Reproject
+*/
+
+
+#include "libmap/Proj.h"
+
+#include "libdat/grid.h"
+#include "libdat/validity.h"
+#include "libsys/job.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+
+namespace map
+{
+
+/*! \brief Precomputed (lookup table) resampling between map projections.
+
+Construction evaluates the (relatively expensive) projection geometry
+once for every destination element and saves the source location as a
+compact sample record. Subsequent resampling of any number of source
+images is a table driven gather (with bilinear interpolation) that is
+performed concurrently over groups of rows.
+
+Source pixels are located at integral Proj::gridSpotFor() values, and
+each one covers the half-open cell [-.5,+.5) about its location. A
+destination element has a source if its spot falls in one of these
+cells. Nearest neighbor sampling picks that pixel (i.e. halves round
+up), and bilinear sampling is clamped at the outer half cells. For
+projections which wrap their columns (Proj::wrapsColumns()), the last
+and first columns are interpolated across the seam.
+
+\par Example
+\dontinclude testmap/uReproject.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+class Reproject
+{
+
+public: // types
+
+	//! Direction associated with destination location (e.g. from camera)
+	using DirFunc = std::function<ga::Vector(dat::RowCol const & dstRC)>;
+
+	//! Source location for one destination element
+	struct Sample
+	{
+		//! Offset of upper-left source neighbor (null if no source)
+		uint32_t theNdx;
+
+		//! Offset from theNdx to next column neighbor (wraps at seam)
+		int32_t theColStep;
+		//! Fractional offset (in [0,1]) toward next source row
+		float theFracRow;
+		//! Fractional offset (in [0,1]) toward next source column
+		float theFracCol;
+	};
+
+private:
+
+	dat::Extents theSrcSize{};
+	dat::grid<Sample> theSamples{};
+	size_t theRowStep{ dat::nullValue<size_t>() };
+
+public: // methods
+
+	//! default null constructor
+	Reproject
+		() = default;
+
+	//! Table to resample images in srcProj into dstProj geometry
+	explicit
+	Reproject
+		( Proj const & srcProj
+		, Proj const & dstProj
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! Table to resample srcProj images for directions from dstDirFor
+	explicit
+	Reproject
+		( Proj const & srcProj
+		, dat::Extents const & dstSize
+		, DirFunc const & dstDirFor //!< must be safe for concurrent use
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	//! True if instance is valid
+	bool
+	isValid
+		() const;
+
+	//! Size of source images expected by resampling methods
+	dat::Extents
+	srcSize
+		() const;
+
+	//! Size of resampled images
+	dat::Extents
+	dstSize
+		() const;
+
+	//! Table entry for destination element dstRC
+	inline
+	Sample const &
+	sampleAt
+		( dat::RowCol const & dstRC
+		) const;
+
+	//! Bilinear interpolation of (floating point) srcGrid into *ptDst
+	template <typename PixType>
+	inline
+	void
+	bilinearInto
+		( dat::grid<PixType> * const & ptDst //!< must be dstSize()
+		, dat::grid<PixType> const & srcGrid
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		) const;
+
+	//! Bilinear interpolation of (floating point) srcGrid
+	template <typename PixType>
+	inline
+	dat::grid<PixType>
+	bilinear
+		( dat::grid<PixType> const & srcGrid
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		) const;
+
+	//! Nearest neighbor sampling of (any type) srcGrid into *ptDst
+	template <typename PixType>
+	inline
+	void
+	nearestInto
+		( dat::grid<PixType> * const & ptDst //!< must be dstSize()
+		, dat::grid<PixType> const & srcGrid
+		, PixType const & nullPix = dat::nullValue<PixType>()
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		) const;
+
+	//! Descriptive information about this instance.
+	std::string
+	infoString
+		( std::string const & title = std::string()
+		) const;
+
+}; // Reproject
+
+} // map
+
+// Inline definitions
+#include "libmap/Reproject.inl"
+
+#endif // map_Reproject_INCL_
+
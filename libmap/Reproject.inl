@@ -0,0 +1,186 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Inline definitions for map::Reproject
+*/
+
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+
+namespace map
+{
+
+namespace priv
+{
+	//! Bilinear interpolation from (upper-left) sample at p00
+	template <typename PixType>
+	inline
+	PixType
+	bilinearAt
+		( PixType const * const & p00
+		, size_t const & rowStep
+		, Reproject::Sample const & samp
+		)
+	{
+		std::ptrdiff_t const colStep{ samp.theColStep };
+		PixType const * const p10{ p00 + rowStep };
+		PixType const fr{ static_cast<PixType>(samp.theFracRow) };
+		PixType const fc{ static_cast<PixType>(samp.theFracCol) };
+		PixType const v0{ p00[0] + fc * (p00[colStep] - p00[0]) };
+		PixType const v1{ p10[0] + fc * (p10[colStep] - p10[0]) };
+		return (v0 + fr * (v1 - v0));
+	}
+}
+
+inline
+Reproject::Sample const &
+Reproject :: sampleAt
+	( dat::RowCol const & dstRC
+	) const
+{
+	return theSamples(dstRC);
+}
+
+template <typename PixType>
+inline
+void
+Reproject :: bilinearInto
+	( dat::grid<PixType> * const & ptDst
+	, dat::grid<PixType> const & srcGrid
+	, size_t const & numJobs
+	) const
+{
+	static_assert
+		( std::is_floating_point<PixType>::value
+		, "bilinear resampling requires floating point pixels"
+		);
+	assert(ptDst);
+	assert(ptDst->hwSize() == dstSize());
+	assert(srcGrid.hwSize() == srcSize());
+
+	PixType const * const srcData{ srcGrid.begin() };
+	size_t const & rowStep = theRowStep;
+	size_t const wide{ theSamples.wide() };
+	sys::job::processRanges
+		( theSamples.high()
+		, [this, &ptDst, &srcData, &rowStep, &wide]
+			(size_t const & rowBeg, size_t const & rowEnd)
+			{
+				Sample const * itSamp{ theSamples.beginRow(rowBeg) };
+				PixType * itOut{ ptDst->beginRow(rowBeg) };
+				PixType * const itEnd{ itOut + (rowEnd - rowBeg) * wide };
+				for ( ; itEnd != itOut ; ++itOut, ++itSamp)
+				{
+					Sample const & samp = *itSamp;
+					if (dat::isValid(samp.theNdx))
+					{
+						*itOut = priv::bilinearAt
+							(srcData + samp.theNdx, rowStep, samp);
+					}
+					else
+					{
+						*itOut = dat::nullValue<PixType>();
+					}
+				}
+			}
+		, numJobs
+		);
+}
+
+template <typename PixType>
+inline
+dat::grid<PixType>
+Reproject :: bilinear
+	( dat::grid<PixType> const & srcGrid
+	, size_t const & numJobs
+	) const
+{
+	dat::grid<PixType> dstGrid(dstSize());
+	bilinearInto(&dstGrid, srcGrid, numJobs);
+	return dstGrid;
+}
+
+template <typename PixType>
+inline
+void
+Reproject :: nearestInto
+	( dat::grid<PixType> * const & ptDst
+	, dat::grid<PixType> const & srcGrid
+	, PixType const & nullPix
+	, size_t const & numJobs
+	) const
+{
+	assert(ptDst);
+	assert(ptDst->hwSize() == dstSize());
+	assert(srcGrid.hwSize() == srcSize());
+
+	PixType const * const srcData{ srcGrid.begin() };
+	size_t const & rowStep = theRowStep;
+	size_t const wide{ theSamples.wide() };
+	sys::job::processRanges
+		( theSamples.high()
+		, [this, &ptDst, &srcData, &nullPix, &rowStep, &wide]
+			(size_t const & rowBeg, size_t const & rowEnd)
+			{
+				Sample const * itSamp{ theSamples.beginRow(rowBeg) };
+				PixType * itOut{ ptDst->beginRow(rowBeg) };
+				PixType * const itEnd{ itOut + (rowEnd - rowBeg) * wide };
+				for ( ; itEnd != itOut ; ++itOut, ++itSamp)
+				{
+					Sample const & samp = *itSamp;
+					if (dat::isValid(samp.theNdx))
+					{
+						// cell about each pixel is [-.5,+.5) - halves round up
+						PixType const * ptPix{ srcData + samp.theNdx };
+						if (! (samp.theFracRow < .5f))
+						{
+							ptPix += rowStep;
+						}
+						if (! (samp.theFracCol < .5f))
+						{
+							ptPix += samp.theColStep;
+						}
+						*itOut = *ptPix;
+					}
+					else
+					{
+						*itOut = nullPix;
+					}
+				}
+			}
+		, numJobs
+		);
+}
+
+} // map
+
@@ -104,6 +104,27 @@ public: // methods
 		( double const & principalAngle
 		) const;
 
+	//! Value linearly interpolated between (circularly) adjacent nodes
+	inline
+	Value
+	valueAt
+		( double const & principalAngle
+		) const;
+
+	//! nearestTableValue() for each of principalAngles
+	inline
+	std::vector<Value>
+	nearestTableValues
+		( std::vector<double> const & principalAngles
+		) const;
+
+	//! valueAt() for each of principalAngles
+	inline
+	std::vector<Value>
+	valuesAt
+		( std::vector<double> const & principalAngles
+		) const;
+
 	//! Descriptive information about this instance.
 	inline
 	std::string
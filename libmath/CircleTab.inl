@@ -369,6 +369,62 @@ CircleTab<Value> :: nearestTableValue
 	return theTabValues[ndxLo];
 }
 
+template <typename Value>
+inline
+Value
+CircleTab<Value> :: valueAt
+	( double const & principalAngle
+	) const
+{
+	// determine offset into table
+	double const delta(principalAngle + math::pi);
+	double const fdx(delta * theIndexPerAngle);
+
+	// bracketing nodes and fractional distance between them
+	double const fdxLo(std::floor(fdx));
+	double const frac(fdx - fdxLo);
+	size_t const numNodes(theTabValues.size());
+	size_t const ndxLo(static_cast<size_t>(fdxLo) % numNodes);
+	size_t const ndxHi((ndxLo + 1u) % numNodes);
+
+	// interpolate between adjacent table values
+	Value const & valueLo = theTabValues[ndxLo];
+	Value const & valueHi = theTabValues[ndxHi];
+	return static_cast<Value>((1. - frac) * valueLo + frac * valueHi);
+}
+
+template <typename Value>
+inline
+std::vector<Value>
+CircleTab<Value> :: nearestTableValues
+	( std::vector<double> const & principalAngles
+	) const
+{
+	std::vector<Value> values;
+	values.reserve(principalAngles.size());
+	for (double const & principalAngle : principalAngles)
+	{
+		values.emplace_back(nearestTableValue(principalAngle));
+	}
+	return values;
+}
+
+template <typename Value>
+inline
+std::vector<Value>
+CircleTab<Value> :: valuesAt
+	( std::vector<double> const & principalAngles
+	) const
+{
+	std::vector<Value> values;
+	values.reserve(principalAngles.size());
+	for (double const & principalAngle : principalAngles)
+	{
+		values.emplace_back(valueAt(principalAngle));
+	}
+	return values;
+}
+
 template <typename Value>
 inline
 std::string
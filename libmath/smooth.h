@@ -51,7 +51,12 @@ namespace math
 
 namespace smooth
 {
-	//! Smoth data using a triangle function
+	/*! Smooth data using a triangle function (with circular wrap around).
+	 *
+	 * Triangle weights are (halfSize + 1 - |offset|) normalized to unit
+	 * area. Implemented as two cascaded running box sums such that
+	 * the cost is O(data.size()) independent of halfSize.
+	 */
 	template <typename Type>
 	inline
 	std::vector<Type> // TODO generisize
@@ -32,9 +32,8 @@
 */
 
 
-#include "libmath/interp.h"
-
-#include <cassert>
+#include <cstddef>
+#include <vector>
 
 
 namespace math
@@ -46,42 +45,52 @@ namespace smooth
 //! Private utilities for math::smooth implementations
 namespace priv
 {
-	//! Weight values for a triangle shaped window
-	std::vector<double>
-	triangleWeights
-		( size_t const & halfSize
+	/*! Sums of boxSize consecutive values (with wrap around): sums[n]
+	 *
+	 * sums[n] = vals[n] + vals[n+1] + ... + vals[n+boxSize-1]
+	 *
+	 * Computed by running sum (i.e. O(N) independent of boxSize).
+	 */
+	template <typename SumType, typename SrcType>
+	inline
+	std::vector<SumType>
+	boxSumsWrapped
+		( std::vector<SrcType> const & vals
+		, size_t const & boxSize
 		)
 	{
-		std::vector<double> weights(1u + 2u*halfSize);
-
-		// configure for interpolation
-		size_t const & ndxMax(weights.size() - 1u);
-		std::pair<double, double> const ndxRange
-			{ 0., static_cast<double>(halfSize + 1u) };
-		static std::pair<double, double> const wRange(0., 1.);
-
-		// fill weights with relative values
-		weights[halfSize] = 1.;
-		for (size_t kk(0u) ; kk < halfSize ; ++kk)
+		size_t const numVals(vals.size());
+		std::vector<SumType> sums(numVals, static_cast<SumType>(0));
+		if (0u < numVals)
 		{
-			double const weight
-				(interp::linear(ndxRange, static_cast<double>(kk+1u), wRange));
-			weights[kk] = weight;
-			weights[ndxMax-kk] = weight;
+			// initial box - including any complete wraps around circle
+			SumType sumAll(static_cast<SumType>(0));
+			for (SrcType const & val : vals)
+			{
+				sumAll += val;
+			}
+			size_t const numWraps(boxSize / numVals);
+			size_t const numPart(boxSize % numVals);
+			SumType sum(static_cast<double>(numWraps) * sumAll);
+			for (size_t ndx(0u) ; ndx < numPart ; ++ndx)
+			{
+				sum += vals[ndx];
+			}
+
+			// slide box around circle - drop first, add next
+			size_t addNdx(numPart);
+			for (size_t ndx(0u) ; ndx < numVals ; ++ndx)
+			{
+				sums[ndx] = sum;
+				sum += vals[addNdx];
+				sum -= vals[ndx];
+				if (numVals == ++addNdx)
+				{
+					addNdx = 0u;
+				}
+			}
 		}
-
-		// normlize to unit area
-		double const sumW
-			(std::accumulate(weights.begin(), weights.end(), 0.));
-		assert(0. < sumW); // should be at least 1 (even for 0==halfSize)
-		double const scale(1./sumW);
-		std::transform
-			( weights.begin(), weights.end()
-			, weights.begin()
-			, [& scale] (double const & value) { return scale*value; }
-			);
-
-		return weights;
+		return sums;
 	}
 }
 
@@ -96,18 +105,29 @@ triangleWrapped
 	std::vector<Type> result(data.size(), static_cast<Type>(0));
 
 	size_t const dSize(data.size());
-	std::vector<double> const weights(priv::triangleWeights(halfSize));
-	size_t const wSize(weights.size());
-
-	// convolve data with window
-	size_t const outDelta(halfSize);
-	for (size_t datNdx(0u) ; datNdx < dSize ; ++datNdx)
+	if (0u < dSize)
 	{
-		for (size_t winNdx(0u) ; winNdx < wSize ; ++winNdx)
+		// accumulate in (at least) double precision
+		using SumType = decltype(1. * data[0]);
+
+		// triangle (weights: boxSize - |offset|) is box convolved with box
+		size_t const boxSize(halfSize + 1u);
+		std::vector<SumType> const boxOnce
+			(priv::boxSumsWrapped<SumType>(data, boxSize));
+		std::vector<SumType> const boxTwice
+			(priv::boxSumsWrapped<SumType>(boxOnce, boxSize));
+
+		// normalize to unit area and center on middle of window
+		double const boxMag(static_cast<double>(boxSize));
+		double const scale(1. / (boxMag * boxMag));
+		size_t outNdx(halfSize % dSize);
+		for (size_t datNdx(0u) ; datNdx < dSize ; ++datNdx)
 		{
-			size_t const srcNdx((datNdx + winNdx) % dSize);
-			size_t const outNdx((datNdx + outDelta) % dSize);
-			result[outNdx] += weights[winNdx] * data[srcNdx];
+			result[outNdx] = static_cast<Type>(scale * boxTwice[datNdx]);
+			if (dSize == ++outNdx)
+			{
+				outNdx = 0u;
+			}
 		}
 	}
 
@@ -0,0 +1,145 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef mem_BoundedQueue_INCL_
+#define mem_BoundedQueue_INCL_
+
+/*! \file
+\brief Declarations for mem::BoundedQueue
+*/
+
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+
+
+namespace mem
+{
+
+/*! \brief Blocking FIFO queue with bounded capacity (thread-safe).
+
+Producers block in push() while the queue is full (backpressure) and
+consumers block in pop() while it is empty. After close(), blocked
+calls return: push() fails and pop() drains remaining items then fails.
+
+\par Example
+\dontinclude testmem/uBoundedQueue.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+template <typename DataType>
+class BoundedQueue
+{
+	mutable std::mutex theMutex;
+	std::condition_variable theNotFull;
+	std::condition_variable theNotEmpty;
+	std::deque<DataType> theQ;
+	size_t const theCapacity;
+	bool theIsClosed;
+
+private: // disable
+
+	//! Disable implicit copy and assignment
+	BoundedQueue(BoundedQueue const &) = delete;
+	BoundedQueue & operator=(BoundedQueue const &) = delete;
+
+public: // methods
+
+	//! Construct to hold at most capacity items (at least 1)
+	inline
+	explicit
+	BoundedQueue
+		( size_t const & capacity
+		);
+
+	// destructor -- compiler provided
+
+	//! Maximum number of items in queue
+	inline
+	size_t
+	capacity
+		() const;
+
+	//! Number of items currently in queue
+	inline
+	size_t
+	size
+		() const;
+
+	//! True if close() has been called
+	inline
+	bool
+	isClosed
+		() const;
+
+	//! Stop accepting items and release all blocked callers
+	inline
+	void
+	close
+		();
+
+	//! Add item to back (blocks while full) - false if queue is closed
+	inline
+	bool
+	push
+		( DataType && item
+		);
+
+	//! Remove item from front (blocks while empty) - false if closed/empty
+	inline
+	bool
+	pop
+		( DataType * const & ptItem
+		);
+
+	//! Remove item from front if one is available (does not block)
+	inline
+	bool
+	tryPop
+		( DataType * const & ptItem
+		);
+
+	//! Descriptive information about this instance.
+	inline
+	std::string
+	infoString
+		( std::string const & title = std::string()
+		) const;
+
+};
+
+}
+
+// Inline definitions
+#include "libmem/BoundedQueue.inl"
+
+#endif // mem_BoundedQueue_INCL_
+
@@ -0,0 +1,200 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Inline Definitions for mem::BoundedQueue
+*/
+
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+
+template <typename DataType>
+inline
+// explicit
+mem::BoundedQueue<DataType> :: BoundedQueue
+	( size_t const & capacity
+	)
+	: theMutex()
+	, theNotFull()
+	, theNotEmpty()
+	, theQ()
+	, theCapacity(std::max(capacity, static_cast<size_t>(1u)))
+	, theIsClosed(false)
+{
+}
+
+template <typename DataType>
+inline
+size_t
+mem::BoundedQueue<DataType> :: capacity
+	() const
+{
+	return theCapacity;
+}
+
+template <typename DataType>
+inline
+size_t
+mem::BoundedQueue<DataType> :: size
+	() const
+{
+	std::lock_guard<std::mutex> lock(theMutex);
+	return theQ.size();
+}
+
+template <typename DataType>
+inline
+bool
+mem::BoundedQueue<DataType> :: isClosed
+	() const
+{
+	std::lock_guard<std::mutex> lock(theMutex);
+	return theIsClosed;
+}
+
+template <typename DataType>
+inline
+void
+mem::BoundedQueue<DataType> :: close
+	()
+{
+	{
+		std::lock_guard<std::mutex> lock(theMutex);
+		theIsClosed = true;
+	}
+	theNotFull.notify_all();
+	theNotEmpty.notify_all();
+}
+
+template <typename DataType>
+inline
+bool
+mem::BoundedQueue<DataType> :: push
+	( DataType && item
+	)
+{
+	bool added(false);
+	{
+		std::unique_lock<std::mutex> lock(theMutex);
+		theNotFull.wait
+			( lock
+			, [this] () { return (theIsClosed || (theQ.size() < theCapacity)); }
+			);
+		if (! theIsClosed)
+		{
+			theQ.push_back(std::move(item));
+			added = true;
+		}
+	}
+	if (added)
+	{
+		theNotEmpty.notify_one();
+	}
+	return added;
+}
+
+template <typename DataType>
+inline
+bool
+mem::BoundedQueue<DataType> :: pop
+	( DataType * const & ptItem
+	)
+{
+	bool removed(false);
+	{
+		std::unique_lock<std::mutex> lock(theMutex);
+		theNotEmpty.wait
+			( lock
+			, [this] () { return (theIsClosed || (! theQ.empty())); }
+			);
+		if (! theQ.empty())
+		{
+			*ptItem = std::move(theQ.front());
+			theQ.pop_front();
+			removed = true;
+		}
+	}
+	if (removed)
+	{
+		theNotFull.notify_one();
+	}
+	return removed;
+}
+
+template <typename DataType>
+inline
+bool
+mem::BoundedQueue<DataType> :: tryPop
+	( DataType * const & ptItem
+	)
+{
+	bool removed(false);
+	{
+		std::lock_guard<std::mutex> lock(theMutex);
+		if (! theQ.empty())
+		{
+			*ptItem = std::move(theQ.front());
+			theQ.pop_front();
+			removed = true;
+		}
+	}
+	if (removed)
+	{
+		theNotFull.notify_one();
+	}
+	return removed;
+}
+
+template <typename DataType>
+inline
+std::string
+mem::BoundedQueue<DataType> :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << std::endl;
+	}
+
+	std::lock_guard<std::mutex> lock(theMutex);
+	oss << "theQueue.size: " << theQ.size();
+	oss << " capacity: " << theCapacity;
+	if (theIsClosed)
+	{
+		oss << " <closed>";
+	}
+
+	return oss.str();
+}
+
@@ -39,71 +39,12 @@
 #include "libmath/interp.h"
 #include "libmodel/traits.h"
 
+#include <cassert>
 
 
-namespace model
-{
-
-	//! Functor for rejection of point from ray
-	struct Proximity
-	{
-		geo::Ray const theRay;
-		double theTolRejSq;
-
-		//! Shortest distance from absPnt to theRay
-		inline
-		double
-		operator()
-			( atom::Point const & absPnt
-			) const
-		{
-			double magRej{ dat::nullValue<double>() };
-			ga::Vector const & orig = theRay.theStart;
-			ga::Vector const & dir = theRay.theDir;
-			ga::Vector const relPnt(absPnt - orig);
-			double const magPrj{ ga::dot(relPnt, dir).theValue };
-			if (0. < magPrj) // point in front of ray
-			{
-				// magSq == sq(projection) + sq(rejection)
-				double const magVecSq
-					{ math::sq(relPnt[0])
-					+ math::sq(relPnt[1])
-					+ math::sq(relPnt[2])
-					};
-				double const magPrjSq{ math::sq(magPrj) };
-				double const magRejSq{ magVecSq - magPrjSq };
-				if (magRejSq < theTolRejSq)
-				{
-					magRej = std::sqrt(magRejSq);
-				}
-			}
-
-			return magRej;
-		}
-	};
-
 
-namespace
+namespace model
 {
-	//! True if both rnA and rnB are valid and rnA is closer than rnB
-	bool
-	isCloser
-		( std::pair<double, size_t> const & rnA
-		, std::pair<double, size_t> const & rnB
-		)
-	{
-		bool isLess{ false };
-		double const & rejA = rnA.first;
-		double const & rejB = rnB.first;
-		// only compare valid entities
-		if (dat::isValid(rejA) && dat::isValid(rejB))
-		{
-			isLess = (rejA < rejB);
-		}
-		return isLess;
-	}
-}
-
 
 ga::Vector
 PointCloud :: locationFor
@@ -112,47 +53,13 @@ PointCloud :: locationFor
 {
 	ga::Vector loc;
 
-	if (! thePoints.empty())
+	// find closest point (within tolerance)
+	size_t const ndxMin
+		{ thePointTree.indexNearestTo(thePoints, rayInModel, theProxTol) };
+	if (dat::isValid(ndxMin))
 	{
-		// find closest point
-		Proximity const prox{ rayInModel, math::sq(theProxTol) };
-
-		// TODO replace with spatial index
-
-		// TODO can be a single pass algorithm
-		std::vector<std::pair<double, size_t> > proxNdxPairs;
-		proxNdxPairs.reserve(thePoints.size());
-
-		// compute proximity of each point
-		for (size_t nn{0u} ; nn < thePoints.size() ; ++nn)
-		{
-			atom::Point const & point = thePoints[nn];
-			double const rej{ prox(point) };
-			if (dat::isValid(rej))
-			{
-				proxNdxPairs.emplace_back
-					(std::pair<double, size_t>{ rej, nn });
-			}
-		}
-
-		// find minimum valid proximity
-		if (! proxNdxPairs.empty())
-		{
-			//! find nearest valid instance
-			std::vector<std::pair<double, size_t> >::const_iterator const itMin
-				( std::min_element
-					(proxNdxPairs.begin(), proxNdxPairs.end(), isCloser)
-				);
-			double const & rejMin = itMin->first;
-			double const & ndxMin = itMin->second;
-			if (dat::isValid(rejMin))
-			{
-				if (rejMin < theProxTol)
-				{
-					loc = thePoints[ndxMin];
-				}
-			}
-		}
+		assert(ndxMin < thePoints.size());
+		loc = thePoints[ndxMin];
 	}
 
 	return loc;
@@ -276,6 +183,7 @@ PointCloud :: addAsciiCSV
 	std::vector<ga::Vector> const pnts
 		(geo::io::loadFromCSV(istrm, expectedSize));
 	thePoints.insert(thePoints.end(), pnts.begin(), pnts.end());
+	thePointTree = PointTree(thePoints);
 	return (! istrm.fail());
 }
 
@@ -38,6 +38,7 @@
 #include "libgeo/Ray.h"
 #include "libmodel/atom.h"
 #include "libmodel/Part.h"
+#include "libmodel/PointTree.h"
 
 #include <iostream>
 #include <sstream>
@@ -63,6 +64,9 @@ class PointCloud
 
 	std::vector<atom::Point> thePoints;
 
+	//! Spatial index over thePoints (rebuilt as points are added)
+	PointTree thePointTree{};
+
 private: // disable -- can be arbitrarily large
 
 	//! Disable implicit copy and assignment
@@ -71,7 +75,11 @@ private: // disable -- can be arbitrarily large
 
 public: // methods expected to be present (for generic sensing libs)
 
-	//! Geometric intersection of ray with model (e.g. surface/ray meet)
+	/*! Geometric intersection of ray with model (e.g. surface/ray meet)
+	 *
+	 * Location of point nearest to ray (within proximity tolerance).
+	 * Safe for concurrent use.
+	 */
 	ga::Vector
 	locationFor
 		( geo::Ray const & rayInModel
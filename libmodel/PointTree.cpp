@@ -0,0 +1,374 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Definitions for model::PointTree
+*/
+
+
+#include "libmodel/PointTree.h"
+
+#include "libdat/info.h"
+#include "libmath/math.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <sstream>
+
+
+namespace
+{
+	//! Null index value
+	constexpr size_t sNull{ dat::nullValue<size_t>() };
+
+	//! Shortest distance of (in front) point from ray (null if not in tol)
+	struct Proximity
+	{
+		geo::Ray const theRay;
+		double theTolRejSq;
+
+		//! Shortest distance from absPnt to theRay
+		inline
+		double
+		operator()
+			( model::atom::Point const & absPnt
+			) const
+		{
+			double magRej{ dat::nullValue<double>() };
+			ga::Vector const & orig = theRay.theStart;
+			ga::Vector const & dir = theRay.theDir;
+			ga::Vector const relPnt(absPnt - orig);
+			double const magPrj{ ga::dot(relPnt, dir).theValue };
+			if (0. < magPrj) // point in front of ray
+			{
+				// magSq == sq(projection) + sq(rejection)
+				double const magVecSq
+					{ math::sq(relPnt[0])
+					+ math::sq(relPnt[1])
+					+ math::sq(relPnt[2])
+					};
+				// (clamp roundoff for points on the ray line)
+				double const magPrjSq{ math::sq(magPrj) };
+				double const magRejSq{ std::max(0., magVecSq - magPrjSq) };
+				if (magRejSq < theTolRejSq)
+				{
+					magRej = std::sqrt(magRejSq);
+				}
+			}
+
+			return magRej;
+		}
+	};
+
+	//! Box which bounds the points indexed by [itBeg,itEnd)
+	model::PointTree::Box
+	boxFor
+		( std::vector<model::atom::Point> const & points
+		, std::vector<size_t>::const_iterator const & itBeg
+		, std::vector<size_t>::const_iterator const & itEnd
+		)
+	{
+		constexpr double big{ std::numeric_limits<double>::max() };
+		model::PointTree::Box box
+			{ {{  big,  big,  big }}
+			, {{ -big, -big, -big }}
+			};
+		for (std::vector<size_t>::const_iterator
+			iter{itBeg} ; itEnd != iter ; ++iter)
+		{
+			model::atom::Point const & point = points[*iter];
+			for (size_t kk{0u} ; kk < 3u ; ++kk)
+			{
+				box.theMins[kk] = std::min(box.theMins[kk], point[kk]);
+				box.theMaxs[kk] = std::max(box.theMaxs[kk], point[kk]);
+			}
+		}
+		return box;
+	}
+
+	/*! Ray parameter at entry into box (expanded by pad) - or null
+	 *
+	 * Only the forward portion of the ray (parameter >= 0) is
+	 * considered.
+	 */
+	double
+	entryParamFor
+		( model::PointTree::Box const & box
+		, geo::Ray const & ray
+		, double const & pad
+		)
+	{
+		double tMin{ 0. };
+		double tMax{ std::numeric_limits<double>::infinity() };
+		for (size_t kk{0u} ; kk < 3u ; ++kk)
+		{
+			double const lo{ box.theMins[kk] - pad };
+			double const hi{ box.theMaxs[kk] + pad };
+			double const & orig = ray.theStart[kk];
+			double const & dir = ray.theDir[kk];
+			if (0. != dir)
+			{
+				double const tA{ (lo - orig) / dir };
+				double const tB{ (hi - orig) / dir };
+				tMin = std::max(tMin, std::min(tA, tB));
+				tMax = std::min(tMax, std::max(tA, tB));
+				if (tMax < tMin)
+				{
+					return dat::nullValue<double>();
+				}
+			}
+			else
+			if ((orig < lo) || (hi < orig))
+			{
+				return dat::nullValue<double>();
+			}
+		}
+		return tMin;
+	}
+
+	/*! Allowance for roundoff in entryParamFor() box tests
+	 *
+	 * Boxes may be degenerate (e.g. a single point) and points lie on
+	 * box faces. Without this, rounding could prune a box holding a
+	 * point at exactly the current best distance (a tie).
+	 */
+	double
+	padTolFor
+		( model::PointTree::Box const & rootBox
+		, geo::Ray const & ray
+		)
+	{
+		double scale{ 1. };
+		for (size_t kk{0u} ; kk < 3u ; ++kk)
+		{
+			scale = std::max(scale, std::abs(ray.theStart[kk]));
+			scale = std::max(scale, std::abs(rootBox.theMins[kk]));
+			scale = std::max(scale, std::abs(rootBox.theMaxs[kk]));
+		}
+		return (64. * std::numeric_limits<double>::epsilon() * scale);
+	}
+
+	//! Recursively add nodes for points perm[beg,end) - return node index
+	size_t
+	addNodes
+		( std::vector<model::PointTree::Node> * const & ptNodes
+		, std::vector<size_t> * const & ptPerm
+		, std::vector<model::atom::Point> const & points
+		, size_t const & beg
+		, size_t const & end
+		, size_t const & maxLeafSize
+		)
+	{
+		std::vector<size_t> & perm = *ptPerm;
+
+		size_t const ndxNode{ ptNodes->size() };
+		model::PointTree::Box const box
+			{ boxFor(points, perm.begin() + beg, perm.begin() + end) };
+		ptNodes->emplace_back
+			(model::PointTree::Node{ box, beg, end, sNull, sNull });
+
+		if (maxLeafSize < (end - beg))
+		{
+			// split (at median) along axis of largest extent
+			size_t axis{ 0u };
+			double maxMag{ box.theMaxs[0] - box.theMins[0] };
+			for (size_t kk{1u} ; kk < 3u ; ++kk)
+			{
+				double const mag{ box.theMaxs[kk] - box.theMins[kk] };
+				if (maxMag < mag)
+				{
+					maxMag = mag;
+					axis = kk;
+				}
+			}
+
+			// partition (in place) point indices about median
+			size_t const mid{ beg + (end - beg) / 2u };
+			std::nth_element
+				( perm.begin() + beg, perm.begin() + mid, perm.begin() + end
+				, [&points, &axis] (size_t const & ndxA, size_t const & ndxB)
+					{ return (points[ndxA][axis] < points[ndxB][axis]); }
+				);
+
+			size_t const ndxA
+				{ addNodes(ptNodes, ptPerm, points, beg, mid, maxLeafSize) };
+			size_t const ndxB
+				{ addNodes(ptNodes, ptPerm, points, mid, end, maxLeafSize) };
+			(*ptNodes)[ndxNode].theChildA = ndxA;
+			(*ptNodes)[ndxNode].theChildB = ndxB;
+		}
+
+		return ndxNode;
+	}
+}
+
+namespace model
+{
+
+// explicit
+PointTree :: PointTree
+	( std::vector<atom::Point> const & points
+	, size_t const & maxLeafSize
+	)
+	: theNodes{}
+	, thePermNdxs(points.size())
+{
+	if (! points.empty())
+	{
+		size_t const leafSize{ std::max(maxLeafSize, size_t{ 1u }) };
+		std::iota(thePermNdxs.begin(), thePermNdxs.end(), 0u);
+		theNodes.reserve(2u * (points.size() / leafSize) + 1u);
+		addNodes
+			(&theNodes, &thePermNdxs, points, 0u, points.size(), leafSize);
+	}
+}
+
+bool
+PointTree :: isValid
+	() const
+{
+	return (! theNodes.empty());
+}
+
+size_t
+PointTree :: size
+	() const
+{
+	return thePermNdxs.size();
+}
+
+size_t
+PointTree :: indexNearestTo
+	( std::vector<atom::Point> const & points
+	, geo::Ray const & ray
+	, double const & maxDist
+	) const
+{
+	size_t bestNdx{ sNull };
+	double bestRej{ dat::nullValue<double>() };
+
+	if (isValid() && (points.size() == size()) && dat::isValid(maxDist))
+	{
+		Proximity const prox{ ray, math::sq(maxDist) };
+		double const padTol{ padTolFor(theNodes.front().theBox, ray) };
+
+		// depth first traversal (nearer child first)
+		std::vector<size_t> ndxStack;
+		ndxStack.reserve(64u);
+		ndxStack.emplace_back(0u);
+		while (! ndxStack.empty())
+		{
+			Node const & node = theNodes[ndxStack.back()];
+			ndxStack.pop_back();
+
+			// skip boxes that cannot contain a (better or tied) point
+			double const pad
+				{ padTol + (dat::isValid(bestRej) ? bestRej : maxDist) };
+			if (! dat::isValid(entryParamFor(node.theBox, ray, pad)))
+			{
+				continue;
+			}
+
+			if (! dat::isValid(node.theChildA))
+			{
+				// leaf: check each point
+				for (size_t ndx{node.theBeg} ; ndx < node.theEnd ; ++ndx)
+				{
+					size_t const & origNdx = thePermNdxs[ndx];
+					double const rej{ prox(points[origNdx]) };
+					if (dat::isValid(rej))
+					{
+						if ( (! dat::isValid(bestRej))
+						  || (rej < bestRej)
+						  || ((rej == bestRej) && (origNdx < bestNdx))
+						   )
+						{
+							bestRej = rej;
+							bestNdx = origNdx;
+						}
+					}
+				}
+			}
+			else
+			{
+				// push farther child first (so nearer one is popped next)
+				Node const & nodeA = theNodes[node.theChildA];
+				Node const & nodeB = theNodes[node.theChildB];
+				double const tA{ entryParamFor(nodeA.theBox, ray, pad) };
+				double const tB{ entryParamFor(nodeB.theBox, ray, pad) };
+				if (dat::isValid(tA) && dat::isValid(tB) && (tB < tA))
+				{
+					ndxStack.emplace_back(node.theChildA);
+					ndxStack.emplace_back(node.theChildB);
+				}
+				else
+				{
+					if (dat::isValid(tB))
+					{
+						ndxStack.emplace_back(node.theChildB);
+					}
+					if (dat::isValid(tA))
+					{
+						ndxStack.emplace_back(node.theChildA);
+					}
+				}
+			}
+		}
+	}
+
+	return bestNdx;
+}
+
+std::string
+PointTree :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << std::endl;
+	}
+	if (isValid())
+	{
+		oss << dat::infoString(thePermNdxs.size(), "numPoints");
+		oss << std::endl;
+		oss << dat::infoString(theNodes.size(), "numNodes");
+	}
+	else
+	{
+		oss << " <null>";
+	}
+	return oss.str();
+}
+
+} // model
+
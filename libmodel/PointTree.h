@@ -0,0 +1,150 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef model_PointTree_INCL_
+#define model_PointTree_INCL_
+
+/*! \file
+\brief Declarations for model::PointTree
+*/
+
+
+#include "libdat/validity.h"
+#include "libgeo/Ray.h"
+#include "libmodel/atom.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+
+namespace model
+{
+
+/*! \brief Bounding volume hierarchy over a (fixed) collection of points.
+
+Supports queries for the point nearest to a ray (within a tolerance).
+Traversal visits nearer boxes first and prunes boxes which cannot
+contain a point closer than the best one found so far. Instances are
+immutable after construction and queries are safe for concurrent use.
+
+The hierarchy does not keep a copy of the points. It holds only a
+permutation of their indices, and queries read the points from the
+(unchanged) collection used at construction.
+
+\par Example
+\dontinclude testmodel/uPointTree.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+class PointTree
+{
+
+public: // types
+
+	//! Axis aligned bounding box
+	struct Box
+	{
+		std::array<double, 3u> theMins;
+		std::array<double, 3u> theMaxs;
+	};
+
+	//! Element of hierarchy: interior (with children) or leaf (with points)
+	struct Node
+	{
+		Box theBox;
+		size_t theBeg; //!< first point (in thePermNdxs) under node
+		size_t theEnd; //!< one past last point under node
+		size_t theChildA; //!< null for leaf nodes
+		size_t theChildB; //!< null for leaf nodes
+	};
+
+private: // data
+
+	//! Hierarchy nodes (root at [0])
+	std::vector<Node> theNodes{};
+
+	//! Point indices ordered such that each node covers a contiguous range
+	std::vector<size_t> thePermNdxs{};
+
+public: // methods
+
+	//! default null constructor
+	PointTree
+		() = default;
+
+	//! Construct hierarchy over points (which are not retained)
+	explicit
+	PointTree
+		( std::vector<atom::Point> const & points
+		, size_t const & maxLeafSize = 8u
+		);
+
+	//! True if instance is valid
+	bool
+	isValid
+		() const;
+
+	//! Number of points in hierarchy
+	size_t
+	size
+		() const;
+
+	/*! Index (into points) of point nearest to ray
+	 *
+	 * The points must be those used at construction. Proximity is
+	 * the distance of point from the ray line (for points in front
+	 * of ray start), and only points closer than maxDist are
+	 * considered. Ties are resolved to the lowest index. Return is
+	 * null if no point qualifies (or points differ in size).
+	 *
+	 * NOTE: the ray direction is assumed to be a unit vector.
+	 */
+	size_t
+	indexNearestTo
+		( std::vector<atom::Point> const & points
+		, geo::Ray const & ray
+		, double const & maxDist
+		) const;
+
+	//! Descriptive information about this instance.
+	std::string
+	infoString
+		( std::string const & title = std::string()
+		) const;
+
+}; // PointTree
+
+} // model
+
+// Inline definitions
+// #include "libmodel/PointTree.inl"
+
+#endif // model_PointTree_INCL_
+
@@ -0,0 +1,138 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef prob_RemapTable_INCL_
+#define prob_RemapTable_INCL_
+
+/*! \file
+\brief Declarations for prob::RemapTable
+*/
+
+
+#include "libdat/validity.h"
+#include "libmath/Partition.h"
+
+#include <string>
+#include <vector>
+
+
+namespace prob
+{
+
+/*! \brief Dense uniformly spaced lookup table for a remapping function.
+
+The table holds function values at the (numParts+1) nodes of a
+partition of the input data range. Evaluation is by linear
+interpolation between bracketing nodes. Input values outside the
+half open data range [min,max) produce null values.
+
+Instances are normally created via prob::Remapper::lookupTable().
+
+The transform() method evaluates an entire array of values with a
+tight, branch-light loop intended for application over image rows.
+
+\par Example
+\dontinclude testprob/uRemapTable.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+class RemapTable
+{
+	double theMin{ dat::nullValue<double>() };
+	double theScale{ dat::nullValue<double>() };
+	double theNumParts{ dat::nullValue<double>() };
+	std::vector<double> theNodeValues{};
+
+public: // methods
+
+	//! default null constructor
+	RemapTable
+		() = default;
+
+	//! Value ctor: nodeValues.size() must be (1 + dataPart.size())
+	explicit
+	RemapTable
+		( math::Partition const & dataPart
+		, std::vector<double> const & nodeValues
+		);
+
+	// copy constructor -- compiler provided
+	// assignment operator -- compiler provided
+	// destructor -- compiler provided
+
+	//! Check if instance is valid
+	bool
+	isValid
+		() const;
+
+	//! Number of intervals in the table (one less than number of nodes)
+	inline
+	size_t
+	size
+		() const;
+
+	//! Interpolated remapping of inValue (null if outside data range)
+	inline
+	double
+	valueFor
+		( double const & inValue
+		) const;
+
+	//! Transform inValue via table lookup
+	template <typename DataType>
+	inline
+	DataType
+	operator()
+		( DataType const & inValue
+		) const;
+
+	//! Remap values from [inBeg,inEnd) into array starting at outBeg
+	template <typename InType, typename OutType>
+	inline
+	void
+	transform
+		( InType const * const & inBeg
+		, InType const * const & inEnd
+		, OutType * const & outBeg
+		) const;
+
+	//! Descriptive information about this instance.
+	std::string
+	infoString
+		( std::string const & title = std::string()
+		) const;
+};
+
+}
+
+// Inline definitions
+#include "libprob/RemapTable.inl"
+
+#endif // prob_RemapTable_INCL_
+
@@ -0,0 +1,116 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Inline definitions for prob::RemapTable
+*/
+
+
+namespace prob
+{
+// ======================================================================
+
+inline
+size_t
+RemapTable :: size
+	() const
+{
+	size_t numParts{ 0u };
+	if (! theNodeValues.empty())
+	{
+		numParts = theNodeValues.size() - 1u;
+	}
+	return numParts;
+}
+
+inline
+double
+RemapTable :: valueFor
+	( double const & inValue
+	) const
+{
+	double value{ dat::nullValue<double>() };
+	double const fndx{ (inValue - theMin) * theScale };
+	// comparisons are false for null (NaN) values
+	if ((0. <= fndx) && (fndx < theNumParts))
+	{
+		size_t const ndx{ static_cast<size_t>(fndx) };
+		double const frac{ fndx - static_cast<double>(ndx) };
+		double const & val0 = theNodeValues[ndx];
+		double const & val1 = theNodeValues[ndx + 1u];
+		value = val0 + frac * (val1 - val0);
+	}
+	return value;
+}
+
+template <typename DataType>
+inline
+DataType
+RemapTable :: operator()
+	( DataType const & inValue
+	) const
+{
+	double const value{ valueFor(static_cast<double>(inValue)) };
+	DataType outValue{ dat::nullValue<DataType>() };
+	if (dat::isValid(value))
+	{
+		outValue = static_cast<DataType>(value);
+	}
+	return outValue;
+}
+
+template <typename InType, typename OutType>
+inline
+void
+RemapTable :: transform
+	( InType const * const & inBeg
+	, InType const * const & inEnd
+	, OutType * const & outBeg
+	) const
+{
+	OutType const outNull{ dat::nullValue<OutType>() };
+	double const * const nodes{ theNodeValues.data() };
+	OutType * ptOut{ outBeg };
+	for (InType const * ptIn{inBeg} ; inEnd != ptIn ; ++ptIn, ++ptOut)
+	{
+		double const fndx{ (static_cast<double>(*ptIn) - theMin) * theScale };
+		bool const inside{ (0. <= fndx) && (fndx < theNumParts) };
+		// use a safe index for out of range values, then discard result
+		size_t const ndx{ inside ? static_cast<size_t>(fndx) : 0u };
+		double const frac{ fndx - static_cast<double>(ndx) };
+		double const val0{ nodes[ndx] };
+		double const val1{ nodes[ndx + 1u] };
+		double const value{ val0 + frac * (val1 - val0) };
+		*ptOut = inside ? static_cast<OutType>(value) : outNull;
+	}
+}
+
+// ======================================================================
+}
+
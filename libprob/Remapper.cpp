@@ -80,6 +80,28 @@ Remapper :: isValid
 		);
 }
 
+RemapTable
+Remapper :: lookupTable
+	( size_t const & lutSize
+	) const
+{
+	RemapTable table;
+	if (isValid() && (0u < lutSize))
+	{
+		math::Partition const dataPart(theCdfFwd.dataRange(), lutSize);
+		std::vector<double> nodeValues(lutSize + 1u);
+		for (size_t nn{0u} ; nn < lutSize ; ++nn)
+		{
+			double const inValue(dataPart.interpValueFor(double(nn)));
+			nodeValues[nn] = theCdfInv(theCdfFwd(inValue));
+		}
+		// last node is at (excluded) end of data range - use limit value
+		nodeValues[lutSize] = theCdfInv(1.);
+		table = RemapTable(dataPart, nodeValues);
+	}
+	return table;
+}
+
 std::string
 Remapper :: infoString
 	( std::string const & title
@@ -37,6 +37,7 @@
 #include "libmath/Partition.h"
 #include "libprob/CdfForward.h"
 #include "libprob/CdfInverse.h"
+#include "libprob/RemapTable.h"
 
 #include <string>
 #include <vector>
@@ -53,6 +54,11 @@ look-up-table (LUT) so that the evaluation is relatively fast. However,
 this of course means that the computed values are quantized to the
 LUT resolution.
 
+For bulk evaluation (e.g. over image pixels), the remapping function
+can be baked into a dense table via lookupTable(), or, for small
+unsigned integer data types, into a direct per-code table via
+codeValues().
+
 \par Example
 \dontinclude testprob/uRemapper.cpp
 \skip ExampleStart
@@ -94,6 +100,19 @@ public: // methods
 		( DataType const & inValue
 		) const;
 
+	//! Remapping evaluated at nodes of lutSize uniform intervals over range
+	RemapTable
+	lookupTable
+		( size_t const & lutSize
+		) const;
+
+	//! Remapped value for every possible code of unsigned type (e.g. uint8_t)
+	template <typename UType>
+	inline
+	std::vector<UType>
+	codeValues
+		() const;
+
 	//! Descriptive information about this instance.
 	std::string
 	infoString
@@ -35,6 +35,9 @@
 #include "libdat/validity.h"
 #include "libmath/interp.h"
 
+#include <limits>
+#include <type_traits>
+
 
 namespace prob
 {
@@ -50,6 +53,34 @@ Remapper :: operator()
 	return static_cast<DataType>(theCdfInv(theCdfFwd(inValue)));
 }
 
+template <typename UType>
+inline
+std::vector<UType>
+Remapper :: codeValues
+	() const
+{
+	static_assert
+		( std::is_unsigned<UType>::value && (sizeof(UType) <= 2u)
+		, "codeValues() requires small unsigned integer type"
+		);
+	constexpr size_t numCodes
+		{ 1u + static_cast<size_t>(std::numeric_limits<UType>::max()) };
+	std::vector<UType> codes(numCodes, dat::nullValue<UType>());
+	if (isValid())
+	{
+		for (size_t code{0u} ; code < numCodes ; ++code)
+		{
+			double const inValue{ static_cast<double>(code) };
+			double const outValue{ theCdfInv(theCdfFwd(inValue)) };
+			if (dat::isValid(outValue))
+			{
+				codes[code] = static_cast<UType>(outValue);
+			}
+		}
+	}
+	return codes;
+}
+
 // ======================================================================
 }
 
@@ -35,12 +35,16 @@
 #include "librecon/RayConvergence.h"
 
 #include "libgeo/intersect.h"
+#include "libgeo/si.h"
 #include "libgeo/stats.h"
 #include "libmath/math.h"
+#include "libprob/median.h"
 #include "librecon/Coordinates.h"
 
+#include <array>
 #include <cmath>
 #include <iterator>
+#include <random>
 #include <sstream>
 
 
@@ -109,6 +113,193 @@ namespace
 		return pnt;
 	}
 
+	//! Coordinate components in preallocated (reusable) buffers
+	struct CoordBuffers
+	{
+		std::array<std::vector<double>, 3u> theComps;
+
+		//! Allocate space for capacity points
+		explicit
+		CoordBuffers
+			( size_t const & capacity
+			)
+			: theComps{{}}
+		{
+			for (std::vector<double> & comps : theComps)
+			{
+				comps.reserve(capacity);
+			}
+		}
+
+		//! Incorporate intersection points of rays (if convergent enough)
+		void
+		addPairFor
+			( geo::Ray const & ray1
+			, geo::Ray const & ray2
+			, double const & maxCosMag
+			)
+		{
+			double const gotCosMag
+				{ std::abs(ga::dot(ray1.theDir, ray2.theDir).theValue) };
+			if (gotCosMag < maxCosMag)
+			{
+				std::pair<ga::Vector, ga::Vector> const pntPair
+					(geo::intersect::pointsFor(ray1, ray2));
+				addPoint(pntPair.first);
+				addPoint(pntPair.second);
+			}
+		}
+
+		//! Incorporate (valid) point coordinates
+		void
+		addPoint
+			( ga::Vector const & pnt
+			)
+		{
+			if (pnt.isValid())
+			{
+				theComps[0].emplace_back(pnt[0]);
+				theComps[1].emplace_back(pnt[1]);
+				theComps[2].emplace_back(pnt[2]);
+			}
+		}
+
+		//! Coordinate medians via selection - NOTE: reorders buffers
+		ga::Vector
+		pointAtMedians
+			()
+		{
+			ga::Vector pnt{};
+			using prob::median::valueFromNonConst;
+			double const xMed
+				(valueFromNonConst(theComps[0].begin(), theComps[0].end()));
+			double const yMed
+				(valueFromNonConst(theComps[1].begin(), theComps[1].end()));
+			double const zMed
+				(valueFromNonConst(theComps[2].begin(), theComps[2].end()));
+			if (dat::isValid(xMed) && dat::isValid(yMed) && dat::isValid(zMed))
+			{
+				pnt = ga::Vector(xMed, yMed, zMed);
+			}
+			return pnt;
+		}
+	};
+
+	//! Coordinate median point from (at most) maxNumPairs ray pairs
+	ga::Vector
+	sampledMedianFor
+		( std::vector<geo::Ray> const & rays
+		, size_t const & maxNumPairs
+		, double const & maxCosMag
+		, uint64_t const & seed
+		)
+	{
+		size_t const numRays{ rays.size() };
+		size_t const numAll{ (numRays * (numRays - 1u)) / 2u };
+		size_t const numPairs{ std::min(numAll, maxNumPairs) };
+		CoordBuffers buffers(2u * numPairs);
+		if (numAll <= maxNumPairs)
+		{
+			// few enough to use all of them
+			for (size_t ndx1{0u} ; ndx1 < numRays ; ++ndx1)
+			{
+				for (size_t ndx2{ndx1 + 1u} ; ndx2 < numRays ; ++ndx2)
+				{
+					buffers.addPairFor(rays[ndx1], rays[ndx2], maxCosMag);
+				}
+			}
+		}
+		else
+		{
+			// repeatable pseudo-random selection of distinct ray pairs
+			std::mt19937_64 gen(seed);
+			std::uniform_int_distribution<size_t> distA(0u, numRays - 1u);
+			std::uniform_int_distribution<size_t> distB(0u, numRays - 2u);
+			for (size_t nPair{0u} ; nPair < numPairs ; ++nPair)
+			{
+				size_t const ndx1{ distA(gen) };
+				size_t ndx2{ distB(gen) };
+				if (ndx1 <= ndx2)
+				{
+					++ndx2;
+				}
+				buffers.addPairFor(rays[ndx1], rays[ndx2], maxCosMag);
+			}
+		}
+		return buffers.pointAtMedians();
+	}
+
+	/*! Iteratively reweighted least squares intersection of all rays.
+	 *
+	 * Weights are Tukey biweight values for ray rejection distances
+	 * relative to a (median absolute deviation) robust scale.
+	 */
+	ga::Vector
+	reweightedPointFor
+		( std::vector<geo::Ray> const & rays
+		, ga::Vector const & startPnt
+		, size_t const & maxIterations
+		)
+	{
+		constexpr double madToSigma{ 1.4826 };
+		constexpr double tukeyC{ 4.685 };
+
+		ga::Vector pnt{ startPnt };
+		size_t const numRays{ rays.size() };
+		std::vector<double> rejMags(numRays);
+		std::vector<double> work(numRays);
+		for (size_t nIter{0u} ; nIter < maxIterations ; ++nIter)
+		{
+			if (! pnt.isValid())
+			{
+				break;
+			}
+
+			// robust scale of ray rejections
+			for (size_t ndx{0u} ; ndx < numRays ; ++ndx)
+			{
+				rejMags[ndx] = ga::magnitude(rays[ndx].rejectionTo(pnt));
+			}
+			std::copy(rejMags.begin(), rejMags.end(), work.begin());
+			double const medRej
+				{ prob::median::valueFromNonConst(work.begin(), work.end()) };
+			double const minScale{ 1.e-12 * (1. + ga::magnitude(pnt)) };
+			double const cutRej
+				{ tukeyC * std::max(madToSigma * medRej, minScale) };
+
+			// weighted intersection of (sufficiently) nearby rays
+			geo::si::PointSystem system{};
+			size_t numUsed{ 0u };
+			for (size_t ndx{0u} ; ndx < numRays ; ++ndx)
+			{
+				if (rejMags[ndx] < cutRej)
+				{
+					// PointSystem squares the weight: sqrt(biweight)
+					double const frac{ rejMags[ndx] / cutRej };
+					double const wgt{ 1. - math::sq(frac) };
+					system.addWeightedRay(geo::si::WRay{ wgt, rays[ndx] });
+					++numUsed;
+				}
+			}
+			if (numUsed < 2u)
+			{
+				break;
+			}
+			ga::Vector const next{ system.pointSolution().theLoc };
+			if (! next.isValid())
+			{
+				break;
+			}
+			double const delta{ ga::magnitude(next - pnt) };
+			pnt = next;
+			if (! (minScale < delta))
+			{
+				break;
+			}
+		}
+		return pnt;
+	}
+
 	//! Distance along ray nearest qualLoc - if rejection less than tol
 	double
 	qualifiedRange
@@ -192,6 +383,25 @@ RayConvergence :: robustPoint
 	return pnt;
 }
 
+ga::Vector
+RayConvergence :: sampledRobustPoint
+	( size_t const & maxNumPairs
+	, double const minAngle
+	, size_t const & maxIterations
+	, uint64_t const & seed
+	) const
+{
+	ga::Vector pnt;
+	if (isValid())
+	{
+		double const maxCos(std::cos(minAngle));
+		ga::Vector const medPnt
+			{ sampledMedianFor(theRays, maxNumPairs, maxCos, seed) };
+		pnt = reweightedPointFor(theRays, medPnt, maxIterations);
+	}
+	return pnt;
+}
+
 ga::Vector
 RayConvergence :: meanNearTo
 	( ga::Vector const & evalPoint
@@ -37,6 +37,7 @@
 #include "libgeo/Ray.h"
 #include "libga/ga.h"
 
+#include <cstdint>
 #include <limits>
 #include <string>
 #include <vector>
@@ -82,6 +83,22 @@ public: // methods
 		, std::vector<double> * const & ptGapMags = nullptr
 		) const;
 
+	/*! Robust intersection point at cost linear in number of rays.
+	 *
+	 * Alternative to robustPoint() for large numbers of rays. The initial
+	 * (coordinate median) estimate uses at most maxNumPairs ray pairs
+	 * (all of them if fewer, else selected pseudo-randomly from seed).
+	 * This estimate is refined by iteratively reweighted least squares
+	 * using all rays (Tukey biweight on ray rejection distances).
+	 */
+	ga::Vector
+	sampledRobustPoint
+		( size_t const & maxNumPairs = 256u
+		, double const minAngle = 1./8.
+		, size_t const & maxIterations = 10u
+		, uint64_t const & seed = 5489u
+		) const;
+
 	//! Intersection of rays that approach trialPoint within tolerance
 	ga::Vector
 	meanNearTo
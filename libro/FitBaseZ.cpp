@@ -85,6 +85,29 @@ namespace
 		return condNum;
 	}
 
+	//! Condition number (L1-norm estimate) from LU reciprocal condition
+	double
+	conditionFor
+		( Eigen::PartialPivLU<CoefMat> const & lu
+		)
+	{
+		double condNum{ std::numeric_limits<double>::infinity() };
+		double const rcond{ lu.rcond() };
+		if (std::numeric_limits<double>::min() < rcond)
+		{
+			condNum = 1. / rcond;
+		}
+		return condNum;
+	}
+
+	/*! Condition (estimate) beyond which LU result is replaced by SVD.
+	 *
+	 * The LU factorization is much cheaper than the SVD and is accurate
+	 * for all but nearly singular systems. For those, the SVD provides
+	 * a (minimum norm) solution that is well behaved in the null space.
+	 */
+	constexpr double sMaxCondLU{ 1.e+12 };
+
 	using ColVec = Eigen::Matrix<double, 5u, 1u>;
 	using CoefMat = Eigen::Matrix<double, 5u, 5u>;
 
@@ -155,15 +178,29 @@ namespace
 			CoefMat const & matA = matPair.first;
 			ColVec const & f0 = matPair.second;
 
-			// use singular value decomposition in order to assess condNum
-			Eigen::JacobiSVD<CoefMat> const svd
-				(matA, Eigen::ComputeFullU | Eigen::ComputeFullV);
+			// fast path: fixed size LU with (cheap) condition estimate
+			Eigen::PartialPivLU<CoefMat> const lu(matA);
+			double condNum{ conditionFor(lu) };
+			bool useSvd{ ! (condNum < sMaxCondLU) };
+			if (! useSvd)
+			{
+				xSoln = lu.solve(f0);
+				useSvd = (! xSoln.allFinite());
+			}
+
+			// fall back to singular value decomposition for poor conditions
+			if (useSvd)
+			{
+				Eigen::JacobiSVD<CoefMat> const svd
+					(matA, Eigen::ComputeFullU | Eigen::ComputeFullV);
+				condNum = conditionFor(svd);
+				xSoln = svd.solve(f0);
+			}
 			assert(ptCondNum);
-			*ptCondNum = conditionFor(svd);
+			*ptCondNum = condNum;
 
 			// cast to c++ return struct
 			// TODO - access Eigen data directly - e.g. create la::cast
-			xSoln = svd.solve(f0);
 			dParms[0] = math::principalAngle(xSoln(0, 0));
 			dParms[1] = math::principalAngle(xSoln(1, 0));
 			dParms[2] = math::principalAngle(xSoln(2, 0));
@@ -391,5 +428,33 @@ FitBaseZ :: infoString
 }
 
 
+std::vector<Solution>
+roSolutionsFor
+	( std::vector<FitBaseZ> const & fitters
+	, ro::PairBaseZ const & roNom
+	, FitConfig const & config
+	, size_t const & numJobs
+	)
+{
+	std::vector<Solution> solns(fitters.size());
+	// each range writes only to its own (disjoint) output elements
+	sys::job::processRanges
+		( fitters.size()
+		, [&fitters, &roNom, &config, &solns]
+			( size_t const & beg
+			, size_t const & end
+			)
+			{
+				for (size_t nn{beg} ; nn < end ; ++nn)
+				{
+					solns[nn] = fitters[nn].roSolution(roNom, config);
+				}
+			}
+		, numJobs
+		);
+	return solns;
+}
+
+
 } // ro
 
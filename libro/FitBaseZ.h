@@ -38,10 +38,12 @@
 #include "libga/ga.h"
 #include "libro/FitConfig.h"
 #include "libro/Solution.h"
+#include "libsys/job.h"
 
 #include <array>
 #include <string>
 #include <utility>
+#include <vector>
 
 
 namespace ro
@@ -117,6 +119,19 @@ public: // methods
 
 }; // FitBaseZ
 
+	/*! Solutions for many fitters (from common nominal) evaluated concurrently
+	 *
+	 * Return has one element per fitter (in same order). The per-fitter
+	 * results are identical to those from individual roSolution() calls.
+	 */
+	std::vector<Solution>
+	roSolutionsFor
+		( std::vector<FitBaseZ> const & fitters
+		, ro::PairBaseZ const & roNom
+		, FitConfig const & config = {}
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
 } // ro
 
 // Inline definitions
@@ -0,0 +1,232 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Definitions for ro::multistart
+*/
+
+
+#include "libro/multistart.h"
+
+#include "libga/groups.h"
+#include "libro/Accord.h"
+#include "libro/FitBaseZ.h"
+#include "libro/PairBaseZ.h"
+
+
+namespace ro
+{
+namespace multistart
+{
+
+namespace
+{
+	//! Nominal orientations for each spread spinor
+	std::vector<OriPair>
+	nominalsFor
+		( std::vector<ga::Spinor> const & spins
+		)
+	{
+		std::vector<OriPair> oriPairs;
+		oriPairs.reserve(spins.size());
+		for (ga::Spinor const & spin : spins)
+		{
+			oriPairs.emplace_back
+				( ga::Rigid::identity()
+				, ga::Rigid(ga::e3, ga::Pose(spin))
+				);
+		}
+		return oriPairs;
+	}
+
+	//! True if solution is (nearly) the same as any of solns
+	bool
+	isAlreadyIn
+		( std::vector<Solution> const & solns
+		, Solution const & soln
+		, double const & tolSame
+		)
+	{
+		bool same{ false };
+		ga::Rigid const ori2w1{ soln.theRoPair->rigid2w1() };
+		for (Solution const & have : solns)
+		{
+			ga::Rigid const have2w1{ have.theRoPair->rigid2w1() };
+			if (have2w1.nearlyEquals(ori2w1, tolSame, tolSame))
+			{
+				same = true;
+				break;
+			}
+		}
+		return same;
+	}
+}
+
+std::vector<OriPair>
+spreadOfNominals
+	()
+{
+	// initialized once - function-local statics are thread-safe (c++11)
+	static std::vector<OriPair> const oriPairs
+		{ nominalsFor(ga::groups::spreadOfSpinors()) };
+	return oriPairs;
+}
+
+std::vector<Solution>
+distinctSolutionsFor
+	( FiveOf<PtrPairUV> const & uvFitPtrs
+	, FitConfig const & fitConfig
+	, double const & tolSame
+	, size_t const & numJobs
+	)
+{
+	std::vector<Solution> distincts;
+
+	std::vector<OriPair> const roNoms{ spreadOfNominals() };
+	FitBaseZ const fitter(uvFitPtrs);
+	if (fitter.isValid())
+	{
+		// fit from each start - each range sets its own solution elements
+		std::vector<Solution> solns(roNoms.size());
+		sys::job::processRanges
+			( roNoms.size()
+			, [&fitter, &fitConfig, &roNoms, &solns]
+				( size_t const & beg
+				, size_t const & end
+				)
+				{
+					for (size_t nn{beg} ; nn < end ; ++nn)
+					{
+						PairBaseZ const roNom(roNoms[nn]);
+						solns[nn] = fitter.roSolution(roNom, fitConfig);
+					}
+				}
+			, numJobs
+			);
+
+		// keep first instance of each different solution (in start order)
+		for (Solution const & soln : solns)
+		{
+			if (soln.isValid() && (! isAlreadyIn(distincts, soln, tolSame)))
+			{
+				distincts.emplace_back(soln);
+			}
+		}
+	}
+
+	return distincts;
+}
+
+bool
+ranksAbove
+	( double const & prob
+	, double const & gap
+	, double const & bestProb
+	, double const & bestGap
+	)
+{
+	bool above{ false };
+	bool const okayProb{ dat::isValid(prob) };
+	bool const okayBest{ dat::isValid(bestProb) };
+	if (okayProb != okayBest)
+	{
+		above = okayProb;
+	}
+	else
+	if (okayProb && (prob != bestProb))
+	{
+		above = (bestProb < prob);
+	}
+	else // both invalid, or a tie
+	{
+		above = (gap < bestGap);
+	}
+	return above;
+}
+
+QuintSoln
+bestFor
+	( std::vector<PairUV> const & uvPairs
+	, FiveOf<size_t> const & fitNdxs
+	, FitConfig const & fitConfig
+	, double const & gapSigma
+	, size_t const & numJobs
+	)
+{
+	QuintSoln best;
+
+	size_t const numUVs{ uvPairs.size() };
+	bool okayNdxs{ true };
+	for (size_t const & fitNdx : fitNdxs)
+	{
+		okayNdxs &= (fitNdx < numUVs);
+	}
+
+	if (okayNdxs)
+	{
+		FiveOf<PtrPairUV> const uvFitPtrs
+			{{ &(uvPairs[fitNdxs[0]])
+			 , &(uvPairs[fitNdxs[1]])
+			 , &(uvPairs[fitNdxs[2]])
+			 , &(uvPairs[fitNdxs[3]])
+			 , &(uvPairs[fitNdxs[4]])
+			}};
+		constexpr double tolSame{ 1./(1024.*1024.) };
+		std::vector<Solution> const solns
+			{ distinctSolutionsFor(uvFitPtrs, fitConfig, tolSame, numJobs) };
+
+		// select by probability - else (e.g. no free UVs) by fit gap
+		double bestProb{ dat::nullValue<double>() };
+		for (Solution const & soln : solns)
+		{
+			QuintSoln const quintSoln(fitNdxs, soln);
+			double const prob
+				{ Accord::probFor(quintSoln, uvPairs, gapSigma) };
+			bool const isBetter
+				{ (! best.isValid())
+				|| ranksAbove
+					( prob, soln.theConvergeGap
+					, bestProb, best.theSoln.theConvergeGap
+					)
+				};
+			if (isBetter)
+			{
+				best = quintSoln;
+				bestProb = prob;
+			}
+		}
+	}
+
+	return best;
+}
+
+} // multistart
+
+} // ro
+
@@ -0,0 +1,124 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef ro_multistart_INCL_
+#define ro_multistart_INCL_
+
+/*! \file
+\brief Declarations for ro::multistart
+*/
+
+
+#include "libro/FitConfig.h"
+#include "libro/QuintSoln.h"
+#include "libro/ro.h"
+#include "libro/Solution.h"
+#include "libsys/job.h"
+
+#include <vector>
+
+
+namespace ro
+{
+
+/*! \brief Relative orientation fitting from many (spread) starting values.
+
+The nominal orientations are generated from ga::groups::spreadOfSpinors()
+such that a good a-priori estimate of the RO is not required.
+
+\par Example
+\dontinclude testro/umultistart.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+namespace multistart
+{
+	/*! Nominal orientations: one per ga::groups::spreadOfSpinors() value.
+	 *
+	 * The first station is at identity and the second is at unit
+	 * distance along ga::e3 with attitude from the associated spinor.
+	 */
+	std::vector<OriPair>
+	spreadOfNominals
+		();
+
+	/*! Distinct forward solutions fit to uvFitPtrs from spreadOfNominals()
+	 *
+	 * Fits are performed concurrently. Solutions that converge to the
+	 * same result (within tolSame for rigid2w1() station and attitude)
+	 * are reported once, in the order of the first start producing them.
+	 */
+	std::vector<Solution>
+	distinctSolutionsFor
+		( FiveOf<PtrPairUV> const & uvFitPtrs
+		, FitConfig const & fitConfig = {}
+		, double const & tolSame = { 1./(1024.*1024.) }
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	/*! True if candidate (prob, gap) ranks above (bestProb, bestGap)
+	 *
+	 * A valid probability ranks above an invalid one. Between valid
+	 * probabilities the higher ranks first, and the smaller convergence
+	 * gap breaks ties. Between invalid probabilities the smaller gap
+	 * ranks first.
+	 */
+	bool
+	ranksAbove
+		( double const & prob
+		, double const & gap
+		, double const & bestProb
+		, double const & bestGap
+		);
+
+	/*! Best (by Accord::probFor) of the distinctSolutionsFor() fitNdxs.
+	 *
+	 * Solutions are ordered by ranksAbove(). E.g. if uvPairs contains
+	 * no measurements other than those at fitNdxs (such that
+	 * probabilities are not available), the solution with the smallest
+	 * convergence gap is returned.
+	 */
+	QuintSoln
+	bestFor
+		( std::vector<PairUV> const & uvPairs
+		, FiveOf<size_t> const & fitNdxs
+		, FitConfig const & fitConfig = {}
+		, double const & gapSigma = { 1./1000. }
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+} // multistart
+
+} // ro
+
+// Inline definitions
+// #include "libro/multistart.inl"
+
+#endif // ro_multistart_INCL_
+
@@ -51,7 +51,7 @@
 
 #include <algorithm>
 #include <array>
-#include <array>
+#include <map>
 #include <mutex>
 #include <random>
 #include <set>
@@ -65,9 +65,7 @@ namespace sampcon
 
 namespace rand
 {
-	//
-	// TODO - factor random operations into thread-friendly pool
-	//
+	// shared generator - for callers that do not provide their own
 	static std::mutex sRandMutex;
 	static std::random_device sRandDev;
 	static std::mt19937_64 sRandGen(sRandDev());
@@ -83,18 +81,19 @@ namespace rand
 		size_t theMaxNdx{ dat::nullValue<size_t>() };
 		std::set<IndexArray> theSampHits;
 		size_t theMaxRetries{ dat::nullValue<size_t>() };
+		std::mt19937_64 * theptGen{ nullptr };
+		std::mutex * theptMutex{ nullptr };
 
+		//! Construct to draw from (mutex protected) shared generator
 		explicit
 		Sampler
 			( size_t const & fullSize
 			, size_t const & maxTrys = 3u
 			)
-			: theMaxNdx{ fullSize }
-			, theSampHits{}
-			, theMaxRetries{ maxTrys }
+			: Sampler(fullSize, maxTrys, &sRandGen)
 		{
-			// generate a sample of indices
-			if (DimSamp < theMaxNdx) // else need bound checking below
+			theptMutex = &sRandMutex;
+			if (isValid())
 			{
 				{ std::lock_guard<std::mutex> guard(sRandMutex);
 					if (! sRandSeeded)
@@ -104,12 +103,39 @@ namespace rand
 					}
 				}
 			}
-			else
+		}
+
+		//! Construct to draw from ptGen (unshared - no locking)
+		Sampler
+			( size_t const & fullSize
+			, size_t const & maxTrys
+			, std::mt19937_64 * const & ptGen
+			)
+			: theMaxNdx{ fullSize }
+			, theSampHits{}
+			, theMaxRetries{ maxTrys }
+			, theptGen{ ptGen }
+		{
+			if (! (DimSamp < theMaxNdx)) // else need bound checking below
 			{
 				theMaxNdx = dat::nullValue<size_t>();
 			}
 		}
 
+		//! Random (sorted) sample of indices from generator
+		IndexArray
+		drawIndices
+			()
+		{
+			using dat::random::index_sample;
+			if (theptMutex)
+			{
+				std::lock_guard<std::mutex> guard(*theptMutex);
+				return index_sample<DimSamp>(theMaxNdx, *theptGen);
+			}
+			return index_sample<DimSamp>(theMaxNdx, *theptGen);
+		}
+
 		//! Fill index quintuplet - true if successful
 		bool
 		setIndices
@@ -119,17 +145,9 @@ namespace rand
 			bool okay(false);
 			IndexArray & useNdxs = *ptNdxs;
 
-			//
-			// TODO - need to factor random numbers into a pool or something
-			//
-
-			using dat::random::index_sample;
-
 			// generate a sample of indices
-			{ std::lock_guard<std::mutex> guard(sRandMutex);
-				// note: returns values in sorted order
-				useNdxs = index_sample<DimSamp>(theMaxNdx, sRandGen);
-			}
+			// note: returns values in sorted order
+			useNdxs = drawIndices();
 
 			constexpr bool avoidDuplicates{ true };
 			if (avoidDuplicates)
@@ -141,9 +159,7 @@ namespace rand
 				size_t nTrys{ 0u };
 				while ((0u < numHits) && (nTrys < theMaxRetries))
 				{
-					{ std::lock_guard<std::mutex> guard(sRandMutex);
-						useNdxs = index_sample<DimSamp>(theMaxNdx, sRandGen);
-					}
+					useNdxs = drawIndices();
 					++nTrys;
 					numHits = theSampHits.count(useNdxs);
 				}
@@ -322,60 +338,109 @@ namespace
 		}
 	};
 
-	//! Combinatorial index generator
+	//! Combinatorial index generator - combinations addressed by rank
 	struct Combo5
 	{
 		using NdxQuint = FiveOf<size_t>;
 
 		size_t theNumElem;
-		std::vector<NdxQuint> theQuints;
 
+		//! Binomial coefficient (exact for modest values)
+		static
+		size_t
+		choose
+			( size_t const & nn
+			, size_t const & kk
+			)
+		{
+			size_t count{ 0u };
+			if (! (nn < kk))
+			{
+				count = 1u;
+				for (size_t ii{1u} ; ii <= kk ; ++ii)
+				{
+					// exact: product of ii consecutive values divisible by ii!
+					count = (count * (nn - kk + ii)) / ii;
+				}
+			}
+			return count;
+		}
+
+		//! Number of distinct combinations (N-choose-5)
 		static
 		size_t
 		sizeCombos
 			( size_t const & numElem
 			)
 		{
-			size_t const & max = numElem;
-			return ((max) * (max-1u) * (max-2u) * (max-3u) * (max-4u));
+			return choose(numElem, 5u);
 		}
 
-		//! Populate self with all combinations
+		//! Generator for combinations from numElem items
 		explicit
 		Combo5
 			( size_t const & numElem
 			)
 			: theNumElem{ numElem }
-			, theQuints{}
 		{
 			assert(4u < theNumElem);
-			theQuints.reserve(sizeCombos(theNumElem));
+		}
 
-			for (size_t na{   0u} ; na < theNumElem ; ++na)
-			for (size_t nb{na+1u} ; nb < theNumElem ; ++nb)
-			for (size_t nc{nb+1u} ; nc < theNumElem ; ++nc)
-			for (size_t nd{nc+1u} ; nd < theNumElem ; ++nd)
-			for (size_t ne{nd+1u} ; ne < theNumElem ; ++ne)
+		//! Number of combinations
+		size_t
+		size
+			() const
+		{
+			return sizeCombos(theNumElem);
+		}
+
+		//! Combination at rank within lexicographic order
+		NdxQuint
+		quintAt
+			( size_t const & rank
+			) const
+		{
+			NdxQuint ndxs{{}};
+			size_t remain{ rank };
+			size_t cand{ 0u };
+			for (size_t pos{0u} ; pos < 5u ; ++pos)
 			{
-				theQuints.emplace_back( NdxQuint{{ na, nb, nc, nd, ne }} );
+				// skip past all combinations starting with smaller values
+				size_t const numAfter{ 4u - pos };
+				size_t count{ choose(theNumElem - 1u - cand, numAfter) };
+				while (! (remain < count))
+				{
+					remain -= count;
+					++cand;
+					count = choose(theNumElem - 1u - cand, numAfter);
+				}
+				ndxs[pos] = cand;
+				++cand;
 			}
+			return ndxs;
 		}
 
-		//! return values associated with a combo
-		template <typename DataType, typename FwdIter>
-		std::array<DataType, 5u>
-		valuesFor
-			( NdxQuint const & ndxs
-			, FwdIter const & valueIterBeg
+		//! Advance to next combination in lexicographic order
+		void
+		advance
+			( NdxQuint * const & ptNdxs
 			) const
 		{
-			return std::array<DataType, 5u>
-				{{ *(valueIterBeg + ndxs[0])
-				 , *(valueIterBeg + ndxs[1])
-				 , *(valueIterBeg + ndxs[2])
-				 , *(valueIterBeg + ndxs[3])
-				 , *(valueIterBeg + ndxs[4])
-				}};
+			NdxQuint & ndxs = *ptNdxs;
+			size_t pos{ 5u };
+			while (0u < pos)
+			{
+				--pos;
+				if (ndxs[pos] < (theNumElem - 5u + pos))
+				{
+					++ndxs[pos];
+					for (size_t next{pos + 1u} ; next < 5u ; ++next)
+					{
+						ndxs[next] = ndxs[next - 1u] + 1u;
+					}
+					break;
+				}
+			}
 		}
 	};
 
@@ -411,11 +476,66 @@ namespace
 }
 
 
+namespace
+{
+	//! Call func(rank, quintSoln) for valid fits in combo range [beg,end)
+	template <typename Func>
+	void
+	fitComboRange
+		( Combo5 const & combo
+		, size_t const & rankBeg
+		, size_t const & rankEnd
+		, std::vector<PairUV> const & uvPairs
+		, PairBaseZ const & roNom
+		, FitConfig const & fitConfig
+		, Func const & func
+		)
+	{
+		Combo5::NdxQuint fitIndices{ combo.quintAt(rankBeg) };
+		for (size_t rank{rankBeg} ; rank < rankEnd ; ++rank)
+		{
+			// gain access to measurements for fitting
+			PtrQuint const uvFitPtrs(ptrQuintInto(&uvPairs, fitIndices));
+			assert(areValidPtrs(uvFitPtrs));
+
+			// compute RO using fit partition
+			FitBaseZ const fitter(uvFitPtrs);
+			Solution const roSoln{ fitter.roSolution(roNom, fitConfig) };
+			if (dat::isValid(roSoln))
+			{
+				func(rank, QuintSoln{ fitIndices, roSoln });
+			}
+			combo.advance(&fitIndices);
+		}
+	}
+
+	//! Solution with attributes for streaming selection
+	struct RankedSoln
+	{
+		double theProb;
+		size_t theRank;
+		QuintSoln theQuintSoln;
+
+		//! Order by probability then (as for bestOf()) by rank
+		bool
+		operator>
+			( RankedSoln const & other
+			) const
+		{
+			return
+				( std::make_pair(theProb, theRank)
+				> std::make_pair(other.theProb, other.theRank)
+				);
+		}
+	};
+}
+
 std::vector<QuintSoln>
 allByCombo
 	( std::vector<PairUV> const & uvPairs
 	, OriPair const & roPairNom
 	, FitConfig const & fitConfig
+	, size_t const & numJobs
 	)
 {
 	std::vector<QuintSoln> quintSolns;
@@ -426,24 +546,34 @@ allByCombo
 	ro::PairBaseZ const roNom(roPairNom);
 	if (roNom.isValid())
 	{
-		// try fitting all combinations
+		// try fitting all combinations - ranges of ranks concurrently
 		Combo5 const combo(uvPairs.size());
-		size_t const numQuints{ combo.theQuints.size() };
-		for (size_t nq{0u} ; nq < numQuints ; ++nq)
-		{
-			// gain access to measurements for fitting
-			Combo5::NdxQuint const & fitIndices = combo.theQuints[nq];
-			PtrQuint const uvFitPtrs(ptrQuintInto(&uvPairs, fitIndices));
-			assert(areValidPtrs(uvFitPtrs));
+		std::map<size_t, std::vector<QuintSoln> > solnsPerRange;
+		std::mutex solnMutex;
+		sys::job::processRanges
+			( combo.size()
+			, [&] (size_t const & rankBeg, size_t const & rankEnd)
+				{
+					std::vector<QuintSoln> solns;
+					fitComboRange
+						( combo, rankBeg, rankEnd
+						, uvPairs, roNom, fitConfig
+						, [&solns]
+							(size_t const &, QuintSoln const & quintSoln)
+							{ solns.emplace_back(quintSoln); }
+						);
+					std::lock_guard<std::mutex> const lock(solnMutex);
+					solnsPerRange[rankBeg].swap(solns);
+				}
+			, numJobs
+			);
 
-			// compute RO using fit partition
-			FitBaseZ const fitter(uvFitPtrs);
-			Solution const roSoln{ fitter.roSolution(roNom, fitConfig) };
-			if (dat::isValid(roSoln))
-			{
-				QuintSoln const quintSoln{ fitIndices, roSoln };
-				quintSolns.emplace_back(quintSoln);
-			}
+		// assemble in combination order
+		for (std::pair<size_t const, std::vector<QuintSoln> > const & range
+			: solnsPerRange)
+		{
+			std::vector<QuintSoln> const & solns = range.second;
+			quintSolns.insert(quintSolns.end(), solns.begin(), solns.end());
 		}
 	}
 
@@ -451,15 +581,16 @@ allByCombo
 }
 
 std::vector<QuintSoln>
-allBySample
+bestByCombo
 	( std::vector<PairUV> const & uvPairs
 	, OriPair const & roPairNom
-	, size_t const & numDraws
+	, size_t const & numBest
 	, FitConfig const & fitConfig
-	, size_t const & maxTrys
+	, double const & gapSigma
+	, size_t const & numJobs
 	)
 {
-	std::vector<QuintSoln> quintSolns;
+	std::vector<QuintSoln> best;
 
 	assert(areValidPairs(uvPairs));
 	assert(5u < uvPairs.size()); // need at least one mea redundancy for rms
@@ -467,33 +598,134 @@ allBySample
 	ro::PairBaseZ const roNom(roPairNom);
 	if (roNom.isValid())
 	{
-		Combo5::NdxQuint fitIndices{{}};
-		rand::Sampler sampler(uvPairs.size(), maxTrys);
+		// each range tracks its own best solutions
+		Combo5 const combo(uvPairs.size());
+		dat::BestOf<RankedSoln> allBest(numBest);
+		std::mutex bestMutex;
+		sys::job::processRanges
+			( combo.size()
+			, [&] (size_t const & rankBeg, size_t const & rankEnd)
+				{
+					dat::BestOf<RankedSoln> rangeBest(numBest);
+					auto const addToBest
+						= [&rangeBest, &uvPairs, &gapSigma]
+							(size_t const & rank, QuintSoln const & quintSoln)
+							{
+								double const prob{ Accord::probFor
+									(quintSoln, uvPairs, gapSigma) };
+								if (dat::isValid(prob))
+								{
+									rangeBest.addSample
+										(RankedSoln{ prob, rank, quintSoln });
+								}
+							};
+					fitComboRange
+						( combo, rankBeg, rankEnd
+						, uvPairs, roNom, fitConfig
+						, addToBest
+						);
+					std::vector<RankedSoln> const items
+						{ rangeBest.bestItems() };
+					std::lock_guard<std::mutex> const lock(bestMutex);
+					allBest.addSamples(items.begin(), items.end());
+				}
+			, numJobs
+			);
+
+		std::vector<RankedSoln> const bestItems{ allBest.bestItems() };
+		best.reserve(bestItems.size());
+		for (RankedSoln const & item : bestItems)
+		{
+			best.emplace_back(item.theQuintSoln);
+		}
+	}
+
+	return best;
+}
+
+namespace
+{
+	//! Solutions for numDraws samples with indices from ptSampler
+	std::vector<QuintSoln>
+	solnsFromSampler
+		( rand::Sampler * const & ptSampler
+		, std::vector<PairUV> const & uvPairs
+		, OriPair const & roPairNom
+		, size_t const & numDraws
+		, FitConfig const & fitConfig
+		)
+	{
+		std::vector<QuintSoln> quintSolns;
+
+		assert(areValidPairs(uvPairs));
+		assert(5u < uvPairs.size()); // need at least one redundancy for rms
 
-		for (size_t nDraw{0u} ; nDraw < numDraws ; ++nDraw)
+		ro::PairBaseZ const roNom(roPairNom);
+		if (roNom.isValid())
 		{
-			// partition samples into fit and evaluation groups
-			bool const goodSample{ sampler.setIndices(&fitIndices) };
-			if (goodSample)
+			Combo5::NdxQuint fitIndices{{}};
+
+			for (size_t nDraw{0u} ; nDraw < numDraws ; ++nDraw)
 			{
-				// access measurements to use for fitting
-				PtrQuint const uvFitPtrs(ptrQuintInto(&uvPairs, fitIndices));
-				assert(areValidPtrs(uvFitPtrs));
-
-				// compute RO using fit partition
-				FitBaseZ const fitter(uvFitPtrs);
-				Solution const roSoln{ fitter.roSolution(roNom, fitConfig) };
-				if (dat::isValid(roSoln))
+				// partition samples into fit and evaluation groups
+				bool const goodSample{ ptSampler->setIndices(&fitIndices) };
+				if (goodSample)
 				{
-					QuintSoln const quintSoln{ fitIndices, roSoln };
-					quintSolns.emplace_back(quintSoln);
+					// access measurements to use for fitting
+					PtrQuint const uvFitPtrs
+						(ptrQuintInto(&uvPairs, fitIndices));
+					assert(areValidPtrs(uvFitPtrs));
+
+					// compute RO using fit partition
+					FitBaseZ const fitter(uvFitPtrs);
+					Solution const roSoln
+						{ fitter.roSolution(roNom, fitConfig) };
+					if (dat::isValid(roSoln))
+					{
+						QuintSoln const quintSoln{ fitIndices, roSoln };
+						quintSolns.emplace_back(quintSoln);
+					}
 				}
+				// else // ignore improper (e.g. duplicate) samples
+				// io::out() << "WARNING: invalid partition" << std::endl;
 			}
-			// else // ignore improper (e.g. duplicate) samples
-			// io::out() << "WARNING: invalid partition" << std::endl;
 		}
+
+		return quintSolns;
 	}
+}
 
+std::vector<QuintSoln>
+allBySample
+	( std::vector<PairUV> const & uvPairs
+	, OriPair const & roPairNom
+	, size_t const & numDraws
+	, FitConfig const & fitConfig
+	, size_t const & maxTrys
+	)
+{
+	rand::Sampler sampler(uvPairs.size(), maxTrys);
+	return solnsFromSampler
+		(&sampler, uvPairs, roPairNom, numDraws, fitConfig);
+}
+
+std::vector<QuintSoln>
+allBySample
+	( std::mt19937_64 * const & ptRandGen
+	, std::vector<PairUV> const & uvPairs
+	, OriPair const & roPairNom
+	, size_t const & numDraws
+	, FitConfig const & fitConfig
+	, size_t const & maxTrys
+	)
+{
+	std::vector<QuintSoln> quintSolns;
+	if (ptRandGen)
+	{
+		rand::Sampler sampler(uvPairs.size(), maxTrys, ptRandGen);
+		quintSolns = solnsFromSampler
+			(&sampler, uvPairs, roPairNom, numDraws, fitConfig);
+	}
 	return quintSolns;
 }
 
@@ -559,9 +791,15 @@ byCombo
 	, double const & gapSigma
 	)
 {
-	std::vector<QuintSoln> const allQuintSolns
-		{ allByCombo(uvPairs, roPairNom, fitConfig) };
-	return bestFrom(allQuintSolns, uvPairs, gapSigma);
+	QuintSoln bestQuintSoln{};
+	constexpr size_t const numBest{ 1u };
+	std::vector<QuintSoln> const bestQuintSolns
+		{ bestByCombo(uvPairs, roPairNom, numBest, fitConfig, gapSigma) };
+	if (! bestQuintSolns.empty())
+	{
+		bestQuintSoln = bestQuintSolns[0];
+	}
+	return bestQuintSoln;
 }
 
 QuintSoln
@@ -579,6 +817,24 @@ bySample
 	return bestFrom(allQuintSolns, uvPairs, gapSigma);
 }
 
+QuintSoln
+bySample
+	( std::mt19937_64 * const & ptRandGen
+	, std::vector<PairUV> const & uvPairs
+	, OriPair const & roPairNom
+	, size_t const & numDraws
+	, FitConfig const & fitConfig
+	, double const & gapSigma
+	, size_t const & maxTrys
+	)
+{
+	std::vector<QuintSoln> const allQuintSolns
+		{ allBySample
+			(ptRandGen, uvPairs, roPairNom, numDraws, fitConfig, maxTrys)
+		};
+	return bestFrom(allQuintSolns, uvPairs, gapSigma);
+}
+
 
 } // sampcon
 
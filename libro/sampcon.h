@@ -40,7 +40,9 @@
 #include "libro/QuintSoln.h"
 #include "libro/ro.h"
 #include "libro/Solution.h"
+#include "libsys/job.h"
 
+#include <random>
 #include <vector>
 
 
@@ -57,12 +59,29 @@ namespace ro
 
 namespace sampcon
 {
-	//! All solutions (N-choose-5 of them!!)
+	//! All solutions (N-choose-5 of them!!) - fit concurrently
 	std::vector<QuintSoln>
 	allByCombo
 		( std::vector<PairUV> const & uvPairs
 		, OriPair const & roPairNom
 		, FitConfig const & fitConfig = {}
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		);
+
+	/*! Best solutions from exhaustive evaluation of all combinations.
+	 *
+	 * Same result as bestOf(allByCombo(...)) but combinations are
+	 * generated by rank (in concurrent ranges) and only the numBest
+	 * solutions (by Accord::probFor) are retained from each range.
+	 */
+	std::vector<QuintSoln>
+	bestByCombo
+		( std::vector<PairUV> const & uvPairs
+		, OriPair const & roPairNom
+		, size_t const & numBest = { 1u }
+		, FitConfig const & fitConfig = {}
+		, double const & gapSigma = { 1./1000. }
+		, size_t const & numJobs = sys::job::defaultNumJobs()
 		);
 
 	//! All solutions from random sampling
@@ -75,6 +94,21 @@ namespace sampcon
 		, size_t const & maxTrys = { 10u }
 		);
 
+	/*! All solutions from random sampling with caller's generator.
+	 *
+	 * Draws only from *ptRandGen (no locking) - e.g. for concurrent
+	 * callers that each need a reproducible sequence. Empty if null.
+	 */
+	std::vector<QuintSoln>
+	allBySample
+		( std::mt19937_64 * const & ptRandGen
+		, std::vector<PairUV> const & uvPairs
+		, OriPair const & roPairNom
+		, size_t const & numDraws = { 640u }
+		, FitConfig const & fitConfig = {}
+		, size_t const & maxTrys = { 10u }
+		);
+
 	//! Select the "best" (TODO metric?) from quintSolns
 	std::vector<QuintSoln>
 	bestOf
@@ -104,6 +138,18 @@ namespace sampcon
 		, size_t const & maxTrys = { 10u }
 		);
 
+	//! Best solution from random sampling with caller's generator
+	QuintSoln
+	bySample
+		( std::mt19937_64 * const & ptRandGen
+		, std::vector<PairUV> const & uvPairs
+		, OriPair const & roPairNom
+		, size_t const & numDraws = { 640u }
+		, FitConfig const & fitConfig = {}
+		, double const & gapSigma = { 1./1000. }
+		, size_t const & maxTrys = { 10u }
+		);
+
 } // sampcon
 
 } // ro
@@ -34,7 +34,9 @@
 */
 
 
+#include "libdat/Extents.h"
 #include "libga/Rigid.h"
+#include "libsys/job.h"
 
 
 namespace sen
@@ -50,7 +52,12 @@ namespace sen
 
 namespace render
 {
-	//! Create a sensor imprint (e.g. display, or simulated sensor record)
+	/*! Create a sensor imprint (e.g. display, or simulated sensor record)
+	 *
+	 * The imprint is rendered in (cache sized) tiles which are
+	 * distributed over numJobs threads. Const methods of modelInRef
+	 * and projOp are therefore expected to be thread safe.
+	 */
 	template 
 		< typename ImprintType
 		, typename SenseOpType
@@ -64,6 +71,7 @@ namespace render
 		, ga::Rigid const & xSenWrtRef
 		, ProjOpType const & projOp
 		, dat::Extents const & hwSize
+		, size_t const & numJobs = sys::job::defaultNumJobs()
 		);
 
 }
@@ -32,13 +32,15 @@
 */
 
 
-#include "libdat/ExtentsIterator.h"
 #include "libdat/RowCol.h"
 #include "libdat/Spot.h"
 #include "libgeo/Ray.h"
 #include "libgeo/xform.h"
 #include "libmodel/Part.h"
 
+#include <algorithm>
+#include <vector>
+
 
 namespace sen
 {
@@ -47,6 +49,92 @@ namespace render
 
 namespace
 {
+	//! Imprint rows in each render tile
+	constexpr size_t sTileHigh{ 32u };
+
+	//! Imprint columns in each render tile
+	constexpr size_t sTileWide{ 64u };
+
+	//! Frame (and sensor) quantities common to all imprint elements
+	template 
+		< typename SenseOpType
+		, typename ProjOpType
+		, typename ModelType
+		>
+	struct FrameInfo
+	{
+		ModelType const & theModelInRef;
+		ga::Rigid const & theSenWrtRef;
+		ga::Rigid const theRefWrtSen;
+		ProjOpType const & theProjOp;
+		SenseOpType const & theSenseOp;
+	};
+
+	//! Render into tile (of ptGrid) with upper left corner at (row0, col0)
+	template 
+		< typename ImprintType
+		, typename SenseOpType
+		, typename ProjOpType
+		, typename ModelType
+		>
+	inline
+	void
+	renderTile
+		( ImprintType * const & ptGrid
+		, size_t const & row0
+		, size_t const & col0
+		, FrameInfo<SenseOpType, ProjOpType, ModelType> const & frame
+		, std::vector<geo::Ray> * const & ptRaysInSen //!< scratch space
+		)
+	{
+		size_t const rowEnd{ std::min(row0 + sTileHigh, ptGrid->high()) };
+		size_t const colEnd{ std::min(col0 + sTileWide, ptGrid->wide()) };
+
+		// cast rays forward through projector (for entire tile)
+		std::vector<geo::Ray> & raysInSen = *ptRaysInSen;
+		raysInSen.clear();
+		for (size_t row{row0} ; row < rowEnd ; ++row)
+		{
+			for (size_t col{col0} ; col < colEnd ; ++col)
+			{
+				dat::RowCol const rowcol{{ row, col }};
+				dat::Spot const spot(dat::cast::Spot(rowcol));
+				raysInSen.emplace_back(frame.theProjOp(spot));
+			}
+		}
+
+		// sense model along each ray
+		std::vector<geo::Ray>::const_iterator itRay{ raysInSen.begin() };
+		for (size_t row{row0} ; row < rowEnd ; ++row)
+		{
+			for (size_t col{col0} ; col < colEnd ; ++col, ++itRay)
+			{
+				geo::Ray const & rayInSen = *itRay;
+
+				// convert ray into expression w.r.t world frame
+				geo::Ray const rayInRef
+					(geo::xform::apply(frame.theRefWrtSen, rayInSen));
+
+				// intersect ray with world model (e.g. object simulation)
+				// (to get geometric location in world)
+				ga::Vector const locPartInRef
+					(frame.theModelInRef.locationFor(rayInRef));
+
+				// get model component at this world location
+				// (to get object characteristics expressed w.r.t. world)
+				model::Part const partInRef
+					(frame.theModelInRef.partFor(locPartInRef));
+
+				// transform model components to expression w.r.t. sensor
+				model::Part const partInSen
+					(partInRef.transformedBy(frame.theSenWrtRef));
+
+				// perform sensing operation
+				(*ptGrid)(row, col) = frame.theSenseOp(partInSen, rayInSen);
+			}
+		}
+	}
+
 	//! Render into the elements of a sensor imprint
 	template 
 		< typename ImprintType
@@ -62,38 +150,39 @@ namespace
 		, ga::Rigid const & xSenWrtRef
 		, ProjOpType const & projOp
 		, SenseOpType const & atomSensing
+		, size_t const & numJobs
 		)
 	{
-		ga::Rigid const xRefWrtSen(xSenWrtRef.inverse());
-
-		dat::ExtentsIterator itRC{ptGrid->hwSize()};
-		for (typename ImprintType::iterator
-			iter{ptGrid->begin()} ; ptGrid->end() != iter ; ++iter, ++itRC)
-		{
-			// map location into which to "pull" data atoms
-			dat::RowCol const rowcol = *itRC;
-			dat::Spot const spot(dat::cast::Spot(rowcol));
-
-			// cast ray forward through projector
-			geo::Ray const rayInSen(projOp(spot));
-
-			// convert ray into expression w.r.t world frame
-			geo::Ray const rayInRef(geo::xform::apply(xRefWrtSen, rayInSen));
-
-			// intersect ray with world model (e.g. here an object simulation)
-			// (to get geometric location in world)
-			ga::Vector const locPartInRef(modelInRef.locationFor(rayInRef));
-
-			// get model component at this world location
-			// (to get object characteristics expressed w.r.t. world)
-			model::Part const partInRef(modelInRef.partFor(locPartInRef));
-
-			// transform model components to expression w.r.t. sensor space
-			model::Part const partInSen(partInRef.transformedBy(xSenWrtRef));
-
-			// perform sensing operation
-			*iter = atomSensing(partInSen, rayInSen);
-		}
+		// per-frame quantities
+		FrameInfo<SenseOpType, ProjOpType, ModelType> const frame
+			{ modelInRef, xSenWrtRef, xSenWrtRef.inverse()
+			, projOp, atomSensing
+			};
+
+		// tile layout
+		size_t const numTileRows
+			{ (ptGrid->high() + sTileHigh - 1u) / sTileHigh };
+		size_t const numTileCols
+			{ (ptGrid->wide() + sTileWide - 1u) / sTileWide };
+		size_t const numTiles{ numTileRows * numTileCols };
+
+		// render (groups of) tiles concurrently
+		sys::job::processRanges
+			( numTiles
+			, [&ptGrid, &frame, &numTileCols]
+				(size_t const & ndxBeg, size_t const & ndxEnd)
+				{
+					std::vector<geo::Ray> raysInSen;
+					raysInSen.reserve(sTileHigh * sTileWide);
+					for (size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+					{
+						size_t const row0{ (ndx / numTileCols) * sTileHigh };
+						size_t const col0{ (ndx % numTileCols) * sTileWide };
+						renderTile(ptGrid, row0, col0, frame, &raysInSen);
+					}
+				}
+			, numJobs
+			);
 	}
 }
 
@@ -110,11 +199,12 @@ imprintFrom
 	, ga::Rigid const & xSenWrtRef
 	, ProjOpType const & projOp
 	, dat::Extents const & hwSize
+	, size_t const & numJobs
 	)
 {
 	ImprintType imprint(hwSize); // allocate space
 	SenseOpType const senseOp; // create a sensor instance
-	renderInto(& imprint, modelInRef, xSenWrtRef, projOp, senseOp);
+	renderInto(& imprint, modelInRef, xSenWrtRef, projOp, senseOp, numJobs);
 	return imprint;
 }
 
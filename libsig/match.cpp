@@ -55,17 +55,18 @@
 namespace
 {
 	//! Run matching filter and return corresponding spots
+	template <typename SourceRefsType>
 	std::vector<std::pair<dat::Spot, dat::Spot> >
 	runSpotPairs
 		( std::vector<sig::FilterContext> const & fconSamps
-		, sig::match::SourceRefs const & sourceRefs
+		, SourceRefsType const & sourceRefs
 		)
 	{
 		std::vector<std::pair<dat::Spot, dat::Spot> > runPairs;
 
 		// access source data
-		dat::grid<float> const & fullGridA = sourceRefs.theFullGridA;
-		dat::grid<float> const & fullGridB = sourceRefs.theFullGridB;
+		auto const & fullGridA = sourceRefs.theFullGridA;
+		auto const & fullGridB = sourceRefs.theFullGridB;
 		std::array<float, 3u> const & rgbGains = sourceRefs.theRgbGains;
 
 		size_t runSize{ fconSamps.size() };
@@ -98,6 +99,7 @@ namespace
 	}
 
 	//! Job functor for matching a collection of filter contexts
+	template <typename SourceRefsType>
 	class JobMatch : public sys::JobBase
 	{
 
@@ -109,7 +111,7 @@ namespace
 	private:
 
 		std::vector<sig::FilterContext> const theFCons;
-		sig::match::SourceRefs const theSourceRefs;
+		SourceRefsType const theSourceRefs;
 		std::shared_ptr<std::vector<SpotPair> > const & thePtResults;
 
 	public:
@@ -118,7 +120,7 @@ namespace
 		JobMatch
 			( std::vector<sig::FilterContext>::const_iterator const & fconBeg
 			, std::vector<sig::FilterContext>::const_iterator const & fconEnd
-			, sig::match::SourceRefs const sourceRefs
+			, SourceRefsType const sourceRefs
 			, std::shared_ptr<std::vector<SpotPair> > const & ptResults
 			)
 			: JobBase{ "JobMatch" }
@@ -150,6 +152,60 @@ namespace
 				);
 		}
 	};
+
+	//! Run matching jobs over partitions of allFCons
+	template <typename SourceRefsType>
+	std::vector<std::pair<dat::Spot, dat::Spot> >
+	spotPairsForRefs
+		( std::vector<sig::FilterContext> const & allFCons
+		, SourceRefsType const sourceRefs
+		, size_t const & numJobs
+		)
+	{
+		std::vector<std::pair<dat::Spot, dat::Spot> > allPairs;
+		allPairs.reserve(allFCons.size());
+
+		// input (filter context) sample partition
+		using ItFCon = std::vector<sig::FilterContext>::const_iterator;
+		using ItPair = std::pair<ItFCon, ItFCon>;
+		std::vector<ItPair> const fconGroups
+			(dat::iter::groups(allFCons.begin(), allFCons.end(), numJobs));
+
+		// space for match results
+		using Job = JobMatch<SourceRefsType>;
+		using JobResult = typename Job::JobResult;
+		std::vector<std::shared_ptr<JobResult> > jobResults;
+		jobResults.reserve(numJobs);
+
+		// configure jobs
+		std::vector<std::shared_ptr<sys::JobBase> > allJobs;
+		for (ItPair const & fconGroup : fconGroups)
+		{
+			ItFCon const & fconBeg = fconGroup.first;
+			ItFCon const & fconEnd = fconGroup.second;
+
+			// allocate space for results - to match input size
+			size_t const sampSize
+				{ static_cast<size_t>(std::distance(fconBeg, fconEnd)) };
+			jobResults.emplace_back(std::make_shared<JobResult>(sampSize));
+
+			// setup match job
+			std::shared_ptr<JobResult> & results = jobResults.back();
+			allJobs.emplace_back
+				(std::make_shared<Job>(fconBeg, fconEnd, sourceRefs, results));
+		}
+		// run all jobs
+		sys::job::Factory factory(allJobs);
+		factory.processAll();
+
+		// gather results
+		for (std::shared_ptr<JobResult> const & results : jobResults)
+		{
+			allPairs.insert(allPairs.end(), results->begin(), results->end());
+		}
+
+		return allPairs;
+	}
 }
 
 
@@ -345,51 +401,17 @@ spotPairsFor
 	, size_t const & numJobs
 	)
 {
-	std::vector<std::pair<dat::Spot, dat::Spot> > allPairs;
-	allPairs.reserve(allFCons.size());
-
-	// input (filter context) sample partition
-	using ItFCon = std::vector<sig::FilterContext>::const_iterator;
-	using ItPair = std::pair<ItFCon, ItFCon>;
-	std::vector<ItPair> const fconGroups
-		(dat::iter::groups(allFCons.begin(), allFCons.end(), numJobs));
-
-	// space for match results
-	using JobResult = JobMatch::JobResult;
-	std::vector<std::shared_ptr<JobResult> > jobResults;
-	jobResults.reserve(numJobs);
-
-	// configure jobs
-	std::vector<std::shared_ptr<sys::JobBase> > allJobs;
-	for (ItPair const & fconGroup : fconGroups)
-	{
-		ItFCon const & fconBeg = fconGroup.first;
-		ItFCon const & fconEnd = fconGroup.second;
-
-		// allocate space for results - to match input size
-		size_t const sampSize
-			{ static_cast<size_t>(std::distance(fconBeg, fconEnd)) };
-		jobResults.emplace_back(std::make_shared<JobResult>(sampSize));
-
-		// setup match job
-		std::shared_ptr<JobResult> & results = jobResults.back();
-		allJobs.emplace_back
-			( std::make_shared<JobMatch>
-				(fconBeg, fconEnd, sourceRefs, results)
-			);
-	}
-	// run all jobs
-	sys::job::Factory factory(allJobs);
-	factory.processAll();
-
-	// gather results
-	for (size_t nj{0u} ; nj < numJobs ; ++nj)
-	{
-		std::shared_ptr<JobResult> const & results = jobResults[nj];
-		allPairs.insert(allPairs.end(), results->begin(), results->end());
-	}
+	return spotPairsForRefs(allFCons, sourceRefs, numJobs);
+}
 
-	return allPairs;
+std::vector<std::pair<dat::Spot, dat::Spot> >
+spotPairsFor
+	( std::vector<sig::FilterContext> const & allFCons
+	, SourceRefsHalf const sourceRefs
+	, size_t const & numJobs
+	)
+{
+	return spotPairsForRefs(allFCons, sourceRefs, numJobs);
 }
 
 bool
@@ -39,10 +39,12 @@
 #include "libdat/Spot.h"
 #include "libdat/SpotX.h"
 #include "libdat/SubExtents.h"
+#include "libdat/types.h"
 #include "libsig/FilterContext.h"
 #include "libsig/MatchConfig.h"
 #include "libsig/Peak.h"
 
+#include <array>
 #include <utility>
 #include <vector>
 
@@ -70,6 +72,18 @@ namespace match
 		std::array<float, 3u> const & theRgbGains;
 	};
 
+	/*! References to source data stored at half precision.
+	 *
+	 * Matching computations are performed in float (on working crops
+	 * expanded from the half precision source).
+	 */
+	struct SourceRefsHalf
+	{
+		dat::grid<dat::f16_t> const & theFullGridA;
+		dat::grid<dat::f16_t> const & theFullGridB;
+		std::array<float, 3u> const & theRgbGains;
+	};
+
 	//! Central crop area
 	dat::SubExtents
 	overlapCrop
@@ -125,6 +139,14 @@ namespace match
 		, size_t const & numJobs
 		);
 
+	//! As spotPairsFor() but for half precision source data
+	std::vector<std::pair<dat::Spot, dat::Spot> >
+	spotPairsFor
+		( std::vector<sig::FilterContext> const & allFCons
+		, SourceRefsHalf const sourceRefs
+		, size_t const & numJobs
+		);
+
 	//! Save contents to text stream (true if success)
 	bool
 	saveScoreAsText
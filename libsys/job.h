@@ -37,6 +37,7 @@
 #include "libsys/jobNotification.h"
 #include "libsys/jobCapacity.h"
 #include "libsys/jobFactory.h"
+#include "libsys/jobRange.h"
 
 namespace sys
 {
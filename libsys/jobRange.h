@@ -0,0 +1,108 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef sys_jobRange_INCL_
+#define sys_jobRange_INCL_
+
+/*! \file
+\brief Declarations for sys::jobRange
+*/
+
+
+#include "libsys/JobBase.h"
+
+#include <functional>
+#include <thread>
+
+
+namespace sys
+{
+namespace job
+{
+
+//! Function to process index values in half open interval [ndxBeg,ndxEnd)
+using RangeFunc = std::function
+	<void(size_t const & ndxBeg, size_t const & ndxEnd)>;
+
+//! Job that invokes a RangeFunc over a single index interval
+class RangeJob : public JobBase
+{
+	RangeFunc const theFunc;
+	size_t const theNdxBeg;
+	size_t const theNdxEnd;
+
+public: // methods
+
+	//! Attach to function and interval
+	inline
+	explicit
+	RangeJob
+		( RangeFunc const & func
+		, size_t const & ndxBeg
+		, size_t const & ndxEnd
+		);
+
+protected:
+
+	//! Call function for this interval
+	inline
+	virtual
+	void
+	run
+		() const;
+};
+
+//! Number of jobs to use when caller does not specify (at least 1)
+inline
+size_t
+defaultNumJobs
+	();
+
+/*! \brief Process [0,numItems) by concurrent calls to func on subranges.
+ *
+ * The index interval is split into (up to) numJobs contiguous parts
+ * of nearly equal size. Each part is handled via a RangeJob run by
+ * a Factory. If only one part is needed, func is called directly
+ * on the calling thread (e.g. no thread creation overhead).
+ */
+inline
+void
+processRanges
+	( size_t const & numItems
+	, RangeFunc const & func
+	, size_t const & numJobs = defaultNumJobs()
+	);
+
+}
+}
+
+// Inline definitions
+#include "libsys/jobRange.inl"
+
+#endif // sys_jobRange_INCL_
+
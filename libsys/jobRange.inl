@@ -0,0 +1,126 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Inline Definitions for sys::jobRange
+*/
+
+
+#include "libsys/jobFactory.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+
+namespace sys
+{
+namespace job
+{
+
+//
+// RangeJob
+//
+
+inline
+// explicit
+RangeJob :: RangeJob
+	( RangeFunc const & func
+	, size_t const & ndxBeg
+	, size_t const & ndxEnd
+	)
+	: JobBase{ "RangeJob" }
+	, theFunc(func)
+	, theNdxBeg{ ndxBeg }
+	, theNdxEnd{ ndxEnd }
+{}
+
+inline
+// virtual
+void
+RangeJob :: run
+	() const
+{
+	theFunc(theNdxBeg, theNdxEnd);
+}
+
+//
+// Functions
+//
+
+inline
+size_t
+defaultNumJobs
+	()
+{
+	size_t const numHW{ std::thread::hardware_concurrency() };
+	return std::max(numHW, static_cast<size_t>(1u));
+}
+
+inline
+void
+processRanges
+	( size_t const & numItems
+	, RangeFunc const & func
+	, size_t const & numJobs
+	)
+{
+	size_t const useJobs{ std::max(numJobs, static_cast<size_t>(1u)) };
+	size_t const numParts{ std::min(useJobs, numItems) };
+	if (1u < numParts)
+	{
+		// distribute items as evenly as possible - early parts get residual
+		size_t const minPerPart{ numItems / numParts };
+		size_t const numBigger{ numItems % numParts };
+
+		std::vector<std::shared_ptr<JobBase> > jobs;
+		jobs.reserve(numParts);
+		size_t ndxBeg{ 0u };
+		for (size_t nPart{0u} ; nPart < numParts ; ++nPart)
+		{
+			size_t const partSize
+				{ minPerPart + ((nPart < numBigger) ? 1u : 0u) };
+			size_t const ndxEnd{ ndxBeg + partSize };
+			jobs.emplace_back(std::make_shared<RangeJob>(func, ndxBeg, ndxEnd));
+			ndxBeg = ndxEnd;
+		}
+
+		Factory factory(jobs, numParts);
+		factory.processAll();
+	}
+	else
+	if (0u < numItems)
+	{
+		func(0u, numItems);
+	}
+}
+
+}
+}
+
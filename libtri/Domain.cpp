@@ -46,13 +46,6 @@ Domain :: Domain
 {
 }
 
-dat::Area<double>
-Domain :: areaBounds
-	() const
-{
-	return theAreaBounds;
-}
-
 // virtual
 bool
 Domain :: isValid
@@ -61,15 +54,6 @@ Domain :: isValid
 	return theAreaBounds.isValid();
 }
 
-// virtual
-bool
-Domain :: contains
-	( dat::Spot const & xyLoc
-	) const
-{
-	return theAreaBounds.contains(xyLoc);
-}
-
 // virtual
 std::string
 Domain :: infoString
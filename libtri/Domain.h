@@ -75,6 +75,7 @@ public: // methods
 		() = default;
 
 	//! Bounding area of valid domain region
+	inline
 	dat::Area<double>
 	areaBounds
 		() const;
@@ -87,7 +88,12 @@ public: // virtual methods
 	isValid
 		() const;
 
-	//! True if xyLoc is within valid region of domain
+	/*! True if xyLoc is within valid region of domain
+	 *
+	 * Defined inline so that calls on (by value) Domain members, as
+	 * held by tri::IsoTille and tri::NodeIterator, are devirtualized.
+	 */
+	inline
 	virtual
 	bool
 	contains
@@ -106,7 +112,7 @@ public: // virtual methods
 } // tri
 
 // Inline definitions
-// #include "libtri/Domain.inl"
+#include "libtri/Domain.inl"
 
 #endif // tri_Domain_INCL_
 
@@ -35,6 +35,8 @@
 #include "libtri/IsoTille.h"
 
 #include "libdat/MinMax.h"
+#include "libtri/NodeSpan.h"
+#include "libtri/shape.h"
 
 #include <algorithm>
 #include <sstream>
@@ -88,12 +90,8 @@ size_t
 IsoTille :: sizeValidNodes
 	() const
 {
-	size_t numValid{ 0u };
-	for (NodeIterator iter{begin()} ; iter ; ++iter)
-	{
-		++numValid;
-	}
-	return numValid;
+	return sizeOf
+		(nodeSpansFor(theTileGeo, shape::Rectangle(theDomain.areaBounds())));
 }
 
 std::vector<NodeKey>
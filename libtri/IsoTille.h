@@ -41,8 +41,10 @@
 #include "libtri/IsoGeo.h"
 #include "libtri/NodeIterator.h"
 #include "libtri/tri.h"
+#include "libsys/job.h"
 
 #include <string>
+#include <vector>
 
 
 namespace tri
@@ -107,7 +109,11 @@ public: // methods
 	begin
 		() const;
 
-	//! Number nodes associated with valid domain location (NOTE! expensive)!
+	/*! Number nodes associated with valid domain location
+	 *
+	 * Cost is proportional to the number of node rows (not nodes).
+	 * Ref tri::NodeIndex::size() for a cached value.
+	 */
 	size_t
 	sizeValidNodes
 		() const;
@@ -164,6 +170,33 @@ public: // methods
 		, SampFunc const & propSampFunc
 		) const;
 
+	/*! Interpolated values at each of refSpots (value_type{} if outside)
+	 *
+	 * Spots are processed in blocks (across numJobs threads) and,
+	 * within each block, visited in tritille face order to improve
+	 * locality of node property access. Return has same order as
+	 * refSpots. Const propSampFunc access must be thread safe (e.g.
+	 * tri::NodeStore).
+	 */
+	template <typename SampFunc>
+	inline
+	std::vector<typename SampFunc::value_type>
+	linearInterpWithCheck
+		( std::vector<dat::Spot> const & refSpots
+		, SampFunc const & propSampFunc
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		) const;
+
+	//! As linearInterpWithCheck() but all refSpots *assumed to be IN domain*
+	template <typename SampFunc>
+	inline
+	std::vector<typename SampFunc::value_type>
+	linearInterpForValid
+		( std::vector<dat::Spot> const & refSpots
+		, SampFunc const & propSampFunc
+		, size_t const & numJobs = sys::job::defaultNumJobs()
+		) const;
+
 	//! Interpolated node property via inverse-distance weighted neighbors
 	template <typename SampFunc>
 	inline
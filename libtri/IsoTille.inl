@@ -32,9 +32,111 @@
 */
 
 
+#include <algorithm>
+
+
 namespace tri
 {
 
+namespace priv
+{
+	//! Number of spots (face sorted) interpolated together within a job
+	constexpr size_t sInterpBlockSize{ 4096u };
+
+	//! Interpolate numSpots values (from spotBeg) into outBeg
+	template <typename SampFunc>
+	inline
+	void
+	interpInBlocks
+		( IsoTille const & trinet
+		, dat::Spot const * const & spotBeg
+		, size_t const & numSpots
+		, SampFunc const & propSampFunc
+		, bool const & checkDomain
+		, typename SampFunc::value_type * const & outBeg
+		)
+	{
+		using FaceNdx = std::pair<FaceVerts, size_t>;
+		std::vector<FaceNdx> faceNdxs;
+		faceNdxs.reserve(std::min(numSpots, sInterpBlockSize));
+		for (size_t blkBeg{0u} ; blkBeg < numSpots ; blkBeg += sInterpBlockSize)
+		{
+			size_t const blkEnd
+				{ std::min(numSpots, blkBeg + sInterpBlockSize) };
+
+			// determine faces (for in-domain spots)
+			faceNdxs.clear();
+			for (size_t ndx{blkBeg} ; ndx < blkEnd ; ++ndx)
+			{
+				dat::Spot const & refSpot = spotBeg[ndx];
+				if ((! checkDomain) || trinet.theDomain.contains(refSpot))
+				{
+					faceNdxs.emplace_back
+						( IsoTille::triangleFor(refSpot, trinet.theTileGeo)
+						, ndx
+						);
+				}
+				else
+				{
+					outBeg[ndx] = typename SampFunc::value_type{};
+				}
+			}
+
+			// visit faces in node order so that node values are near
+			std::sort
+				( faceNdxs.begin(), faceNdxs.end()
+				, [] (FaceNdx const & faceA, FaceNdx const & faceB)
+					{
+						return
+							(  faceA.first.theVerts[0].theNdxIJ
+							 < faceB.first.theVerts[0].theNdxIJ
+							);
+					}
+				);
+			for (FaceNdx const & faceNdx : faceNdxs)
+			{
+				FaceVerts const & triangle = faceNdx.first;
+				outBeg[faceNdx.second]
+					= triangle.valueFrom<SampFunc>(propSampFunc);
+			}
+		}
+	}
+
+	//! Interpolated values at all refSpots (partitioned over numJobs)
+	template <typename SampFunc>
+	inline
+	std::vector<typename SampFunc::value_type>
+	interpAll
+		( IsoTille const & trinet
+		, std::vector<dat::Spot> const & refSpots
+		, SampFunc const & propSampFunc
+		, bool const & checkDomain
+		, size_t const & numJobs
+		)
+	{
+		using DataType = typename SampFunc::value_type;
+		std::vector<DataType> values(refSpots.size());
+		dat::Spot const * const spotBeg{ refSpots.data() };
+		DataType * const outBeg{ values.data() };
+		sys::job::processRanges
+			( refSpots.size()
+			, [&] (size_t const & ndxBeg, size_t const & ndxEnd)
+				{
+					interpInBlocks
+						( trinet
+						, spotBeg + ndxBeg
+						, ndxEnd - ndxBeg
+						, propSampFunc
+						, checkDomain
+						, outBeg + ndxBeg
+						);
+				}
+			, numJobs
+			);
+		return values;
+	}
+}
+
 
 // static
 inline
@@ -131,6 +233,34 @@ IsoTille :: linearInterpForValid
 	return triangle.valueFrom<SampFunc>(propSampFunc);
 }
 
+template <typename SampFunc>
+inline
+std::vector<typename SampFunc::value_type>
+IsoTille :: linearInterpWithCheck
+	( std::vector<dat::Spot> const & refSpots
+	, SampFunc const & propSampFunc
+	, size_t const & numJobs
+	) const
+{
+	constexpr bool checkDomain{ true };
+	return priv::interpAll
+		(*this, refSpots, propSampFunc, checkDomain, numJobs);
+}
+
+template <typename SampFunc>
+inline
+std::vector<typename SampFunc::value_type>
+IsoTille :: linearInterpForValid
+	( std::vector<dat::Spot> const & refSpots
+	, SampFunc const & propSampFunc
+	, size_t const & numJobs
+	) const
+{
+	constexpr bool checkDomain{ false };
+	return priv::interpAll
+		(*this, refSpots, propSampFunc, checkDomain, numJobs);
+}
+
 template <typename SampFunc>
 inline
 typename SampFunc::value_type
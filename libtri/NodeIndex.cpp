@@ -34,78 +34,49 @@
 
 #include "libtri/NodeIndex.h"
 
+#include <algorithm>
 #include <sstream>
 
-#include "libio/stream.h" // TODO
-
 
 namespace
 {
 	// Area covered by tritille (I,J) index values
 	dat::Area<tri::NodeNdxType>
 	ijAreaFor
-		( tri::IsoTille const & trinet
+		( tri::IsoGeo const & trigeo
+		, dat::Area<double> const & refArea
 		)
 	{
-		tri::IsoGeo const & trigeo = trinet.theTileGeo;
-		return trigeo.ijAreaForTileArea
-			( trigeo.tileAreaForRefArea(trinet.theDomain.areaBounds())
-			);
+		return trigeo.ijAreaForTileArea(trigeo.tileAreaForRefArea(refArea));
 	}
 
 	//! Required offset to access (I,J) minimums with positive indices
 	dat::Offset2D<size_t, long>
 	offsetFor
-		( tri::IsoTille const & trinet
+		( tri::IsoGeo const & trigeo
+		, dat::Area<double> const & refArea
 		)
 	{
 		// determine extents of trinet node keys
-		return dat::Offset2D<size_t, long>(ijAreaFor(trinet).minimums());
+		return dat::Offset2D<size_t, long>
+			(ijAreaFor(trigeo, refArea).minimums());
 	}
 
 	//! High/Wide size extents which can hold *already offset* (I,J) indices
 	dat::Extents
 	hwSizeActive
-		( tri::IsoTille const & trinet
+		( tri::IsoGeo const & trigeo
+		, dat::Area<double> const & refArea
 		)
 	{
 		// determine extents of trinet node keys
-		dat::Area<tri::NodeNdxType> const ijArea{ ijAreaFor(trinet) };
+		dat::Area<tri::NodeNdxType> const ijArea
+			{ ijAreaFor(trigeo, refArea) };
 		return dat::Extents
 			( ijArea[0].magnitude() + 1u // pad to include end of interval
 			, ijArea[1].magnitude() + 1u
 			);
 	}
-
-	//! Number of valid elements in trinet (slow! requires checking each)
-	size_t
-	sizeFor
-		( tri::IsoTille const & trinet
-		, dat::grid<tri::NodeIndex::index_type> * const & ptNdxGrid
-		, dat::Offset2D<size_t, long> const & offMap
-		, std::vector<tri::NodeKey> * const & ptNodeKeys
-		)
-	{
-		assert(ptNdxGrid);
-		assert(ptNdxGrid->isValid());
-		assert(ptNodeKeys);
-		std::fill
-			( ptNdxGrid->begin(), ptNdxGrid->end()
-			, dat::nullValue<tri::NodeIndex::index_type>()
-			);
-		ptNodeKeys->reserve(ptNdxGrid->size());
-		size_t count{ 0u };
-		for (tri::NodeIterator iter(trinet.begin()) ; iter ; ++iter)
-		{
-			tri::NodeKey const keyIJ{ iter.nodeKey() };
-			dat::RowCol const rowcol(offMap(keyIJ));
-			(*ptNdxGrid)(rowcol) = count;
-			ptNodeKeys->emplace_back(keyIJ);
-			++count;
-		}
-		return count;
-	}
-
 }
 
 namespace tri
@@ -115,26 +86,47 @@ namespace tri
 NodeIndex :: NodeIndex
 	( tri::IsoTille const & trinet
 	)
-	: theRowColMap{ offsetFor(trinet) }
-	, theNdxGrid{ hwSizeActive(trinet) }
-	, theNodeKeys{}
-	, theSize{ sizeFor(trinet, &theNdxGrid, theRowColMap, &theNodeKeys) }
+	: NodeIndex
+		( trinet.theTileGeo
+		, shape::Rectangle(trinet.theDomain.areaBounds())
+		)
+{
+}
+
+void
+NodeIndex :: assignFrom
+	( tri::IsoGeo const & trigeo
+	, dat::Area<double> const & refArea
+	, std::vector<NodeSpan> const & spans
+	)
 {
-	/*
-	io::out() << dat::infoString(theRowColMap, "theRowColMap") << std::endl;
-	io::out() << dat::infoString(theSize, "theSize") << std::endl;
-	io::out() << dat::infoString(theNdxGrid, "theNdxGrid") << std::endl;
-	size_t const byteSize{ theNdxGrid.byteSize() };
-	io::out() << dat::infoString(byteSize, "byteSize") << std::endl;
-	for (size_t row{0u} ; row < theNdxGrid.high() ; ++row)
+	theRowColMap = offsetFor(trigeo, refArea);
+	theNdxGrid = dat::grid<index_type>(hwSizeActive(trigeo, refArea));
+	std::fill
+		( theNdxGrid.begin(), theNdxGrid.end()
+		, dat::nullValue<index_type>()
+		);
+
+	// assign (consecutive) indices to nodes in each span
+	theNodeKeys.clear();
+	theNodeKeys.reserve(sizeOf(spans));
+	dat::Extents const hwSize{ theNdxGrid.hwSize() };
+	size_t count{ 0u };
+	for (NodeSpan const & span : spans)
 	{
-		for (size_t col{0u} ; col < theNdxGrid.wide() ; ++col)
+		for (NodeNdxType ndxJ{span.theBegJ} ; ndxJ < span.theEndJ ; ++ndxJ)
 		{
-			io::out() << " " << dat::infoString(theNdxGrid(row, col));
+			NodeKey const keyIJ{ span.theNdxI, ndxJ };
+			dat::RowCol const rowcol(theRowColMap(keyIJ));
+			if (hwSize.includes(rowcol))
+			{
+				theNdxGrid(rowcol) = count;
+				theNodeKeys.emplace_back(keyIJ);
+				++count;
+			}
 		}
-		io::out() << std::endl;
 	}
-	*/
+	theSize = count;
 }
 
 bool
@@ -37,6 +37,8 @@
 #include "libdat/Offset2D.h"
 #include "libdat/grid.h" // NOTE: wastes ~2x index storage, but fast
 #include "libtri/IsoTille.h"
+#include "libtri/NodeSpan.h"
+#include "libtri/shape.h"
 
 #include <cassert>
 #include <string>
@@ -47,6 +49,11 @@ namespace tri
 
 /*! \brief Remap tritille (I,J) NodeKeys to scalar index
 
+The index grid also serves as a rasterized occupancy mask of the
+domain: contains() is a table lookup and size() is the (cached)
+number of in-domain nodes. Construction rasterizes the domain one
+row span at a time (ref tri::nodeSpansFor()).
+
 \par Example
 \dontinclude testtri/uNodeIndex.cpp
 \skip ExampleStart
@@ -79,6 +86,15 @@ public: // methods
 		( tri::IsoTille const & trinet
 		);
 
+	//! Index nodes of trigeo within (convex) domain (e.g. tri::shape)
+	template <typename DomainShape>
+	inline
+	explicit
+	NodeIndex
+		( tri::IsoGeo const & trigeo
+		, DomainShape const & domain
+		);
+
 	//! True if instance is valid
 	bool
 	isValid
@@ -89,6 +105,13 @@ public: // methods
 	size
 		() const;
 
+	//! True if keyIJ is a node within the (indexed) domain
+	inline
+	bool
+	contains
+		( NodeKey const & keyIJ
+		) const;
+
 	//! Index(offset) into an assumed external container
 	inline
 	index_type
@@ -109,6 +132,16 @@ public: // methods
 		( std::string const & title = std::string()
 		) const;
 
+private:
+
+	//! Allocate index grid (covering refArea) and fill from node spans
+	void
+	assignFrom
+		( tri::IsoGeo const & trigeo
+		, dat::Area<double> const & refArea
+		, std::vector<NodeSpan> const & spans
+		);
+
 }; // NodeIndex
 
 } // tri
@@ -35,6 +35,29 @@
 namespace tri
 {
 
+template <typename DomainShape>
+inline
+// explicit
+NodeIndex :: NodeIndex
+	( tri::IsoGeo const & trigeo
+	, DomainShape const & domain
+	)
+{
+	if (domain.isValid())
+	{
+		assignFrom(trigeo, domain.areaBounds(), nodeSpansFor(trigeo, domain));
+	}
+}
+
+inline
+bool
+NodeIndex :: contains
+	( NodeKey const & keyIJ
+	) const
+{
+	return dat::isValid(indexForNodeKey(keyIJ));
+}
+
 inline
 NodeIndex::index_type
 NodeIndex :: indexForNodeKey
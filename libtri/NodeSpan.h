@@ -0,0 +1,112 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef tri_NodeSpan_INCL_
+#define tri_NodeSpan_INCL_
+
+/*! \file
+\brief Declarations for tri::NodeSpan
+*/
+
+
+#include "libtri/IsoGeo.h"
+#include "libtri/tri.h"
+
+#include <string>
+#include <vector>
+
+
+namespace tri
+{
+
+/*! \brief Run of consecutive (in J) tritille nodes within a domain.
+
+Spans for an entire domain are produced by nodeSpansFor() which
+rasterizes a convex DomainShape (ref tri::shape) one row (of I) at
+a time. Only the span endpoints are evaluated via contains(), so
+cost is proportional to the number of rows rather than nodes.
+
+\par Example
+\dontinclude testtri/uNodeIndex.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+struct NodeSpan
+{
+	//! Row index (Mu direction) common to all nodes in span
+	NodeNdxType theNdxI{ sNullNdx };
+
+	//! First (Nu direction) index in span
+	NodeNdxType theBegJ{ sNullNdx };
+
+	//! One past last (Nu direction) index in span
+	NodeNdxType theEndJ{ sNullNdx };
+
+	//! Number of nodes in span
+	inline
+	size_t
+	size
+		() const;
+
+	//! Descriptive information about this instance.
+	std::string
+	infoString
+		( std::string const & title = std::string()
+		) const;
+
+}; // NodeSpan
+
+/*! Spans of (in-domain) nodes in iteration order of tri::NodeIterator
+ *
+ * Candidate nodes are those spanned by tri::NodeIterator for the
+ * same (area bounding) domain, and a node is a member if
+ * domain.contains(trigeo.refSpotForNodeKey()) is true.
+ */
+template <typename DomainShape>
+inline
+std::vector<NodeSpan>
+nodeSpansFor
+	( IsoGeo const & trigeo
+	, DomainShape const & domain
+	);
+
+//! Total number of nodes in all spans
+inline
+size_t
+sizeOf
+	( std::vector<NodeSpan> const & spans
+	);
+
+} // tri
+
+// Inline definitions
+#include "libtri/NodeSpan.inl"
+
+#endif // tri_NodeSpan_INCL_
+
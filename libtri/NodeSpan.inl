@@ -0,0 +1,200 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Inline definitions for tri::NodeSpan
+*/
+
+
+#include "libtri/NodeIterator.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+
+namespace tri
+{
+
+inline
+size_t
+NodeSpan :: size
+	() const
+{
+	return static_cast<size_t>(theEndJ - theBegJ);
+}
+
+namespace priv
+{
+	//! True if node keyIJ is within domain
+	template <typename DomainShape>
+	inline
+	bool
+	hasNode
+		( IsoGeo const & trigeo
+		, DomainShape const & domain
+		, NodeNdxType const & ndxI
+		, NodeNdxType const & ndxJ
+		)
+	{
+		return domain.contains(trigeo.refSpotForNodeKey({ ndxI, ndxJ }));
+	}
+
+	//! Index nearest to (finite or not) value clamped into [ndxMin,ndxMax]
+	inline
+	NodeNdxType
+	clampedIndex
+		( double const & value
+		, NodeNdxType const & ndxMin
+		, NodeNdxType const & ndxMax
+		)
+	{
+		double const dMin{ static_cast<double>(ndxMin) };
+		double const dMax{ static_cast<double>(ndxMax) };
+		double const useValue{ std::min(dMax, std::max(dMin, value)) };
+		return static_cast<NodeNdxType>(useValue);
+	}
+
+	/*! Refine estimated [*ptBeg,*ptLast] to exact span within [jMin,jMax]
+	 *
+	 * Domain is assumed convex (contiguous nodes along each row).
+	 * Return is false if no node qualifies.
+	 */
+	template <typename HasNodeJ>
+	inline
+	bool
+	refineSpan
+		( NodeNdxType * const & ptBeg
+		, NodeNdxType * const & ptLast
+		, NodeNdxType const & jMin
+		, NodeNdxType const & jMax
+		, HasNodeJ const & hasNodeJ
+		)
+	{
+		NodeNdxType & jBeg = *ptBeg;
+		NodeNdxType & jLast = *ptLast;
+		while ((jBeg <= jLast) && (! hasNodeJ(jBeg)))
+		{
+			++jBeg;
+		}
+		while ((jBeg <= jLast) && (! hasNodeJ(jLast)))
+		{
+			--jLast;
+		}
+		bool const hasSpan{ (jBeg <= jLast) };
+		if (hasSpan)
+		{
+			while ((jMin < jBeg) && hasNodeJ(jBeg - 1))
+			{
+				--jBeg;
+			}
+			while ((jLast < jMax) && hasNodeJ(jLast + 1))
+			{
+				++jLast;
+			}
+		}
+		return hasSpan;
+	}
+}
+
+template <typename DomainShape>
+inline
+std::vector<NodeSpan>
+nodeSpansFor
+	( IsoGeo const & trigeo
+	, DomainShape const & domain
+	)
+{
+	std::vector<NodeSpan> spans;
+	if (trigeo.isValid() && domain.isValid())
+	{
+		// same candidate nodes as visited by NodeIterator
+		NodeIterator::IndexLimits const ndxLimits
+			(trigeo, trigeo.tileAreaForRefArea(domain.areaBounds()));
+		NodeIterator::NodeNdxRange const begEndI{ ndxLimits.ndxBegEndI() };
+		NodeIterator::NodeNdxRange const begEndJ{ ndxLimits.ndxBegEndJ() };
+		NodeNdxType const & jMin = begEndJ.first;
+		NodeNdxType const & jMax = begEndJ.second; // NodeIterator inclusive
+
+		spans.reserve
+			(static_cast<size_t>(begEndI.second - begEndI.first + 1));
+		for (NodeNdxType ndxI{begEndI.first} ; ndxI <= begEndI.second ; ++ndxI)
+		{
+			// node locations along this row are origin + ndxJ*dir
+			dat::Spot const origin(trigeo.refSpotForNodeKey({ ndxI, 0 }));
+			dat::Spot const next(trigeo.refSpotForNodeKey({ ndxI, 1 }));
+			std::array<double, 2u> const dir
+				{{ next[0] - origin[0], next[1] - origin[1] }};
+			std::pair<double, double> const tRange
+				{ domain.lineParamRange(origin, dir) };
+			if (! (dat::isValid(tRange.first) && dat::isValid(tRange.second)))
+			{
+				continue;
+			}
+
+			// estimated span (padded) clamped to candidate indices
+			using priv::clampedIndex;
+			NodeNdxType jBeg
+				{ clampedIndex(std::floor(tRange.first) - 1., jMin, jMax) };
+			NodeNdxType jLast
+				{ clampedIndex(std::ceil(tRange.second) + 1., jMin, jMax) };
+
+			// refine to exact endpoints (domain assumed convex)
+			auto const hasNodeJ
+				= [&trigeo, &domain, &ndxI] (NodeNdxType const & ndxJ)
+					{ return priv::hasNode(trigeo, domain, ndxI, ndxJ); };
+			if (priv::refineSpan(&jBeg, &jLast, jMin, jMax, hasNodeJ))
+			{
+				NodeSpan span;
+				span.theNdxI = ndxI;
+				span.theBegJ = jBeg;
+				span.theEndJ = jLast + 1;
+				spans.emplace_back(span);
+			}
+		}
+	}
+	return spans;
+}
+
+inline
+size_t
+sizeOf
+	( std::vector<NodeSpan> const & spans
+	)
+{
+	size_t count{ 0u };
+	for (NodeSpan const & span : spans)
+	{
+		count += span.size();
+	}
+	return count;
+}
+
+} // tri
+
@@ -0,0 +1,191 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef tri_NodeStore_INCL_
+#define tri_NodeStore_INCL_
+
+/*! \file
+\brief Declarations for tri::NodeStore
+*/
+
+
+#include "libtri/NodeIndex.h"
+
+#include "libdat/validity.h"
+#include "libtri/IsoTille.h"
+#include "libtri/tri.h"
+
+#include <string>
+#include <vector>
+
+
+namespace tri
+{
+
+/*! \brief Dense property values for each (in domain) node of a tritille.
+
+Values are held in a contiguous array addressed through a tri::NodeIndex.
+Instances satisfy the "PropSampFunc" requirements of
+tri::FaceVerts::valueFrom() (and hence tri::IsoTille interpolation).
+Const access is safe for concurrent use (e.g. by batch interpolation).
+
+\par Example
+\dontinclude testtri/uNodeStore.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+template <typename Type>
+class NodeStore
+{
+
+public: // data types
+
+	using value_type = Type;
+	using index_type = NodeIndex::index_type;
+
+private:
+
+	NodeIndex theNodeIndex{};
+	std::vector<Type> theValues{};
+	Type theNullValue{};
+
+public: // methods
+
+	//! default null constructor
+	NodeStore
+		() = default;
+
+	//! Allocate storage for all nodes in trinet - each set to nullValue
+	explicit
+	NodeStore
+		( tri::IsoTille const & trinet
+		, Type const & nullValue = dat::nullValue<Type>()
+		);
+
+	//! True if instance is valid
+	inline
+	bool
+	isValid
+		() const;
+
+	//! Number of nodes (with storage) - same as nodeIndex().size()
+	inline
+	size_t
+	size
+		() const;
+
+	//! Index used to map NodeKey to storage offsets
+	inline
+	NodeIndex const &
+	nodeIndex
+		() const;
+
+	//! Value returned for keys which are not part of this store
+	inline
+	Type const &
+	nullValue
+		() const;
+
+	//! Property value at keyIJ (or nullValue() if not in store)
+	inline
+	Type const &
+	operator()
+		( NodeKey const & keyIJ
+		) const;
+
+	//! Property value at node (ndxI, ndxJ) (or nullValue() if not in store)
+	inline
+	Type const &
+	operator()
+		( NodeNdxType const & ndxI
+		, NodeNdxType const & ndxJ
+		) const;
+
+	//! Assign value to node keyIJ - return false if keyIJ is not in store
+	inline
+	bool
+	setValue
+		( NodeKey const & keyIJ
+		, Type const & value
+		);
+
+	//! Direct access to value at storage offset (as from nodeIndex())
+	inline
+	Type const &
+	operator[]
+		( index_type const & ndx
+		) const;
+
+	//! Direct access to value at storage offset (as from nodeIndex())
+	inline
+	Type &
+	operator[]
+		( index_type const & ndx
+		);
+
+	//! Start of contiguous storage (in nodeIndex() order)
+	inline
+	typename std::vector<Type>::const_iterator
+	begin
+		() const;
+
+	//! End of contiguous storage (in nodeIndex() order)
+	inline
+	typename std::vector<Type>::const_iterator
+	end
+		() const;
+
+	//! Start of contiguous storage (in nodeIndex() order)
+	inline
+	typename std::vector<Type>::iterator
+	begin
+		();
+
+	//! End of contiguous storage (in nodeIndex() order)
+	inline
+	typename std::vector<Type>::iterator
+	end
+		();
+
+	//! Descriptive information about this instance.
+	inline
+	std::string
+	infoString
+		( std::string const & title = std::string()
+		) const;
+
+}; // NodeStore
+
+} // tri
+
+// Inline definitions
+#include "libtri/NodeStore.inl"
+
+#endif // tri_NodeStore_INCL_
+
@@ -0,0 +1,227 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Inline definitions for tri::NodeStore
+*/
+
+
+#include <cassert>
+#include <sstream>
+
+
+namespace tri
+{
+
+template <typename Type>
+inline
+// explicit
+NodeStore<Type> :: NodeStore
+	( tri::IsoTille const & trinet
+	, Type const & nullValue
+	)
+	: theNodeIndex(trinet)
+	, theValues{}
+	, theNullValue(nullValue)
+{
+	if (theNodeIndex.isValid())
+	{
+		theValues.resize(theNodeIndex.size(), theNullValue);
+	}
+}
+
+template <typename Type>
+inline
+bool
+NodeStore<Type> :: isValid
+	() const
+{
+	return
+		(  theNodeIndex.isValid()
+		&& (theValues.size() == theNodeIndex.size())
+		);
+}
+
+template <typename Type>
+inline
+size_t
+NodeStore<Type> :: size
+	() const
+{
+	return theValues.size();
+}
+
+template <typename Type>
+inline
+NodeIndex const &
+NodeStore<Type> :: nodeIndex
+	() const
+{
+	return theNodeIndex;
+}
+
+template <typename Type>
+inline
+Type const &
+NodeStore<Type> :: nullValue
+	() const
+{
+	return theNullValue;
+}
+
+template <typename Type>
+inline
+Type const &
+NodeStore<Type> :: operator()
+	( NodeKey const & keyIJ
+	) const
+{
+	index_type const ndx{ theNodeIndex.indexForNodeKey(keyIJ) };
+	if (dat::isValid(ndx))
+	{
+		return theValues[ndx];
+	}
+	return theNullValue;
+}
+
+template <typename Type>
+inline
+Type const &
+NodeStore<Type> :: operator()
+	( NodeNdxType const & ndxI
+	, NodeNdxType const & ndxJ
+	) const
+{
+	return operator()(NodeKey{ ndxI, ndxJ });
+}
+
+template <typename Type>
+inline
+bool
+NodeStore<Type> :: setValue
+	( NodeKey const & keyIJ
+	, Type const & value
+	)
+{
+	bool okay{ false };
+	index_type const ndx{ theNodeIndex.indexForNodeKey(keyIJ) };
+	if (dat::isValid(ndx))
+	{
+		theValues[ndx] = value;
+		okay = true;
+	}
+	return okay;
+}
+
+template <typename Type>
+inline
+Type const &
+NodeStore<Type> :: operator[]
+	( index_type const & ndx
+	) const
+{
+	assert(ndx < theValues.size());
+	return theValues[ndx];
+}
+
+template <typename Type>
+inline
+Type &
+NodeStore<Type> :: operator[]
+	( index_type const & ndx
+	)
+{
+	assert(ndx < theValues.size());
+	return theValues[ndx];
+}
+
+template <typename Type>
+inline
+typename std::vector<Type>::const_iterator
+NodeStore<Type> :: begin
+	() const
+{
+	return theValues.begin();
+}
+
+template <typename Type>
+inline
+typename std::vector<Type>::const_iterator
+NodeStore<Type> :: end
+	() const
+{
+	return theValues.end();
+}
+
+template <typename Type>
+inline
+typename std::vector<Type>::iterator
+NodeStore<Type> :: begin
+	()
+{
+	return theValues.begin();
+}
+
+template <typename Type>
+inline
+typename std::vector<Type>::iterator
+NodeStore<Type> :: end
+	()
+{
+	return theValues.end();
+}
+
+template <typename Type>
+inline
+std::string
+NodeStore<Type> :: infoString
+	( std::string const & title
+	) const
+{
+	std::ostringstream oss;
+	if (! title.empty())
+	{
+		oss << title << std::endl;
+	}
+	if (isValid())
+	{
+		oss << theNodeIndex.infoString("theNodeIndex");
+
+		oss << std::endl;
+		oss << "theValues.size: " << theValues.size();
+	}
+	else
+	{
+		oss << " <null>";
+	}
+	return oss.str();
+}
+
+} // tri
+
@@ -0,0 +1,187 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+#ifndef tri_shape_INCL_
+#define tri_shape_INCL_
+
+/*! \file
+\brief Declarations for namespace tri::shape
+*/
+
+
+#include "libdat/Area.h"
+#include "libdat/Spot.h"
+#include "libdat/validity.h"
+
+#include <array>
+#include <string>
+#include <utility>
+
+
+namespace tri
+{
+
+/*! \brief Concrete (non-virtual) domain shapes for use as template policies.
+
+A "DomainShape" policy (e.g. for tri::nodeSpansFor()) provides:
+\arg areaBounds() -- bounding area of the (ref frame) region
+\arg contains(xyLoc) -- true if xyLoc is inside the region
+\arg lineParamRange(origin, dir) -- closed (min,max) interval of 't'
+	values for which (origin + t*dir) is within the region. The
+	result need only be approximate (members are re-checked with
+	contains()), but the region must be convex.
+
+\par Example
+\dontinclude testtri/uNodeIndex.cpp
+\skip ExampleStart
+\until ExampleEnd
+*/
+
+namespace shape
+{
+	//! Parameter interval along a line (null values if no intersection)
+	using ParamRange = std::pair<double, double>;
+
+	//! Direction vector (in ref frame)
+	using Vec2D = std::array<double, 2u>;
+
+	//! Rectangular region (same validity rules as dat::Area::contains())
+	class Rectangle
+	{
+		dat::Area<double> theArea{};
+
+	public: // methods
+
+		//! default null constructor
+		Rectangle
+			() = default;
+
+		//! Region within area
+		explicit
+		Rectangle
+			( dat::Area<double> const & area
+			);
+
+		//! True if instance is valid
+		inline
+		bool
+		isValid
+			() const;
+
+		//! Bounding area of region (the rectangle itself)
+		inline
+		dat::Area<double>
+		areaBounds
+			() const;
+
+		//! True if xyLoc is within region
+		inline
+		bool
+		contains
+			( dat::Spot const & xyLoc
+			) const;
+
+		//! Interval of line parameter for which line is within region
+		inline
+		ParamRange
+		lineParamRange
+			( dat::Spot const & origin
+			, Vec2D const & dir
+			) const;
+
+		//! Descriptive information about this instance.
+		std::string
+		infoString
+			( std::string const & title = std::string()
+			) const;
+
+	}; // Rectangle
+
+	//! Circular region (including boundary)
+	class Circle
+	{
+		dat::Spot theCenter{ dat::nullValue<dat::Spot>() };
+		double theRadius{ dat::nullValue<double>() };
+
+	public: // methods
+
+		//! default null constructor
+		Circle
+			() = default;
+
+		//! Region within radius of center
+		explicit
+		Circle
+			( dat::Spot const & center
+			, double const & radius
+			);
+
+		//! True if instance is valid
+		inline
+		bool
+		isValid
+			() const;
+
+		//! Bounding area of region
+		inline
+		dat::Area<double>
+		areaBounds
+			() const;
+
+		//! True if xyLoc is within region
+		inline
+		bool
+		contains
+			( dat::Spot const & xyLoc
+			) const;
+
+		//! Interval of line parameter for which line is within region
+		inline
+		ParamRange
+		lineParamRange
+			( dat::Spot const & origin
+			, Vec2D const & dir
+			) const;
+
+		//! Descriptive information about this instance.
+		std::string
+		infoString
+			( std::string const & title = std::string()
+			) const;
+
+	}; // Circle
+
+} // shape
+
+} // tri
+
+// Inline definitions
+#include "libtri/shape.inl"
+
+#endif // tri_shape_INCL_
+
@@ -0,0 +1,207 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief Inline definitions for namespace tri::shape
+*/
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+namespace tri
+{
+namespace shape
+{
+
+namespace priv
+{
+	//! Null parameter range (no intersection)
+	inline
+	ParamRange
+	nullParamRange
+		()
+	{
+		return { dat::nullValue<double>(), dat::nullValue<double>() };
+	}
+}
+
+//
+// Rectangle
+//
+
+inline
+bool
+Rectangle :: isValid
+	() const
+{
+	return theArea.isValid();
+}
+
+inline
+dat::Area<double>
+Rectangle :: areaBounds
+	() const
+{
+	return theArea;
+}
+
+inline
+bool
+Rectangle :: contains
+	( dat::Spot const & xyLoc
+	) const
+{
+	return theArea.contains(xyLoc);
+}
+
+inline
+ParamRange
+Rectangle :: lineParamRange
+	( dat::Spot const & origin
+	, Vec2D const & dir
+	) const
+{
+	// intersect parameter intervals for each (slab) dimension
+	double tMin{ -std::numeric_limits<double>::infinity() };
+	double tMax{  std::numeric_limits<double>::infinity() };
+	for (size_t nn{0u} ; nn < 2u ; ++nn)
+	{
+		dat::Range<double> const & range = theArea[nn];
+		double const & pos = origin[nn];
+		double const & delta = dir[nn];
+		if (0. != delta)
+		{
+			double const tA{ (range.min() - pos) / delta };
+			double const tB{ (range.max() - pos) / delta };
+			tMin = std::max(tMin, std::min(tA, tB));
+			tMax = std::min(tMax, std::max(tA, tB));
+		}
+		else
+		if (! ((range.min() <= pos) && (pos <= range.max())))
+		{
+			// parallel to, and outside of, this slab
+			return priv::nullParamRange();
+		}
+	}
+
+	ParamRange tRange{ priv::nullParamRange() };
+	if (tMin <= tMax)
+	{
+		tRange = { tMin, tMax };
+	}
+	return tRange;
+}
+
+//
+// Circle
+//
+
+inline
+bool
+Circle :: isValid
+	() const
+{
+	return
+		(  dat::isValid(theCenter)
+		&& dat::isValid(theRadius)
+		&& (! (theRadius < 0.))
+		);
+}
+
+inline
+dat::Area<double>
+Circle :: areaBounds
+	() const
+{
+	dat::Area<double> area;
+	if (isValid())
+	{
+		area = dat::Area<double>
+			{ dat::Range<double>
+				(theCenter[0] - theRadius, theCenter[0] + theRadius)
+			, dat::Range<double>
+				(theCenter[1] - theRadius, theCenter[1] + theRadius)
+			};
+	}
+	return area;
+}
+
+inline
+bool
+Circle :: contains
+	( dat::Spot const & xyLoc
+	) const
+{
+	double const dx{ xyLoc[0] - theCenter[0] };
+	double const dy{ xyLoc[1] - theCenter[1] };
+	return ((dx*dx + dy*dy) <= (theRadius*theRadius));
+}
+
+inline
+ParamRange
+Circle :: lineParamRange
+	( dat::Spot const & origin
+	, Vec2D const & dir
+	) const
+{
+	ParamRange tRange{ priv::nullParamRange() };
+
+	// solve |origin + t*dir - center|^2 == radius^2
+	double const px{ origin[0] - theCenter[0] };
+	double const py{ origin[1] - theCenter[1] };
+	double const aa{ dir[0]*dir[0] + dir[1]*dir[1] };
+	double const bb{ dir[0]*px + dir[1]*py };
+	double const cc{ px*px + py*py - theRadius*theRadius };
+	if (0. < aa)
+	{
+		double const disc{ bb*bb - aa*cc };
+		if (! (disc < 0.))
+		{
+			double const root{ std::sqrt(disc) };
+			tRange = { (-bb - root) / aa, (-bb + root) / aa };
+		}
+	}
+	else
+	if (! (0. < cc))
+	{
+		// degenerate direction with origin inside
+		tRange =
+			{ -std::numeric_limits<double>::infinity()
+			,  std::numeric_limits<double>::infinity()
+			};
+	}
+	return tRange;
+}
+
+} // shape
+} // tri
+
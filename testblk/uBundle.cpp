@@ -0,0 +1,297 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for blk::Bundle
+*/
+
+
+#include "libblk/Bundle.h"
+
+#include "libblk/sim.h"
+#include "libcam/XRefSpots.h"
+#include "libdat/info.h"
+#include "libdat/validity.h"
+#include "libio/stream.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+//! Check for common functions
+std::string
+blk_Bundle_test0
+	()
+{
+	std::ostringstream oss;
+	blk::Bundle aNull{};
+	if (aNull.isValid())
+	{
+		oss << "Failure of null value test" << std::endl;
+		oss << "infoString: " << aNull.infoString() << std::endl;
+	}
+	if (! aNull.adjust().empty())
+	{
+		oss << "Failure of null adjust test" << std::endl;
+	}
+	return oss.str();
+}
+
+//! Simulated strip of (downward looking) acquisitions over terrain
+struct Sim
+{
+	cam::Camera const theCamera{ 1., dat::Extents(1000u, 1000u) };
+	std::vector<ga::Rigid> theExpOris;
+	std::vector<ga::Vector> theExpPnts;
+	cam::XRefSpots theSpots;
+
+	explicit
+	Sim
+		( size_t const & numAcqs
+		)
+	{
+		for (size_t acqNdx{0u} ; acqNdx < numAcqs ; ++acqNdx)
+		{
+			double const xx{ double(acqNdx) };
+			double const ang{ .02 * double(acqNdx % 3u) };
+			theExpOris.emplace_back
+				(blk::sim::oriComps(xx, .1 * xx, 10., ang, -ang, .5 * ang));
+		}
+		for (int ix{-4} ; ix <= 4 + int(numAcqs) ; ++ix)
+		{
+			for (int iy{-4} ; iy <= 4 ; ++iy)
+			{
+				double const zz{ .05 * double((ix * iy + 7) % 5) };
+				theExpPnts.emplace_back
+					(ga::Vector(.5 * double(ix), .5 * double(iy), zz));
+			}
+		}
+
+		// observe points within a limited field of view
+		theSpots = cam::XRefSpots(theExpPnts.size(), theExpOris.size());
+		for (size_t pntNdx{0u} ; pntNdx < theExpPnts.size() ; ++pntNdx)
+		{
+			for (size_t acqNdx{0u} ; acqNdx < numAcqs ; ++acqNdx)
+			{
+				ga::Vector const pCam{ theExpOris[acqNdx](theExpPnts[pntNdx]) };
+				dat::Spot const spot{ theCamera.imageSpotFor(pCam) };
+				if (dat::isValid(spot) && (dat::magnitude(spot) < .35))
+				{
+					theSpots(pntNdx, acqNdx) = spot;
+				}
+			}
+		}
+	}
+
+	//! Starting values: perturbed except for the datum parameters
+	blk::Bundle
+	bundle
+		() const
+	{
+		std::vector<ga::Rigid> oris;
+		for (size_t acqNdx{0u} ; acqNdx < theExpOris.size() ; ++acqNdx)
+		{
+			ga::Rigid const & expOri = theExpOris[acqNdx];
+			ga::Rigid ori{ expOri };
+			if (0u < acqNdx)
+			{
+				double const dd{ .01 * double(acqNdx) };
+				ga::Vector loc{ expOri.location() + ga::Vector(0., dd, -dd) };
+				if (acqNdx + 1u < theExpOris.size())
+				{
+					loc = loc + ga::Vector(dd, 0., 0.);
+				}
+				ga::BiVector const dAng(-.5 * dd, .3 * dd, dd);
+				ori = ga::Rigid(loc, ga::Pose(dAng) * expOri.pose());
+			}
+			oris.emplace_back(ori);
+		}
+		std::vector<ga::Vector> pnts;
+		for (size_t pntNdx{0u} ; pntNdx < theExpPnts.size() ; ++pntNdx)
+		{
+			double const dd{ .02 * double(pntNdx % 7u) - .06 };
+			pnts.emplace_back(theExpPnts[pntNdx] + ga::Vector(dd, -dd, dd));
+		}
+		return blk::Bundle(theSpots, theCamera, oris, pnts);
+	}
+};
+
+//! Check that adjusted values match
+void
+checkResult
+	( std::ostream & oss
+	, blk::Bundle const & bundle
+	, Sim const & sim
+	, std::string const & name
+	)
+{
+	double const tol{ 1.e-8 };
+	std::vector<ga::Rigid> const & gotOris = bundle.oriAcqWrtRefs();
+	for (size_t acqNdx{0u} ; acqNdx < gotOris.size() ; ++acqNdx)
+	{
+		ga::Rigid const & expOri = sim.theExpOris[acqNdx];
+		ga::Rigid const & gotOri = gotOris[acqNdx];
+		if (! gotOri.nearlyEquals(expOri, tol, tol))
+		{
+			oss << "Failure of adjusted ori test: " << name << std::endl;
+			oss << dat::infoString(expOri, "expOri") << std::endl;
+			oss << dat::infoString(gotOri, "gotOri") << std::endl;
+			break;
+		}
+	}
+	std::vector<ga::Vector> const & gotPnts = bundle.pntInRefs();
+	for (size_t pntNdx{0u} ; pntNdx < gotPnts.size() ; ++pntNdx)
+	{
+		if (sim.theSpots.acqIndicesFor(pntNdx).size() < 2u)
+		{
+			continue; // not adjusted
+		}
+		ga::Vector const & expPnt = sim.theExpPnts[pntNdx];
+		ga::Vector const & gotPnt = gotPnts[pntNdx];
+		if (! gotPnt.nearlyEquals(expPnt, tol))
+		{
+			oss << "Failure of adjusted pnt test: " << name << std::endl;
+			oss << dat::infoString(expPnt, "expPnt") << std::endl;
+			oss << dat::infoString(gotPnt, "gotPnt") << std::endl;
+			break;
+		}
+	}
+}
+
+//! Check adjustment of a simulated block
+std::string
+blk_Bundle_test1
+	()
+{
+	std::ostringstream oss;
+
+	// ExampleStart
+	// spot measurements and starting values
+	Sim const sim(7u);
+	cam::XRefSpots const & spotTab = sim.theSpots;
+	std::vector<ga::Rigid> const oris{ sim.bundle().oriAcqWrtRefs() };
+	std::vector<ga::Vector> const pnts{ sim.bundle().pntInRefs() };
+
+	// bundle adjust all orientations and points together
+	blk::Bundle bundle(spotTab, sim.theCamera, oris, pnts);
+	std::vector<blk::Bundle::Iteration> const iters{ bundle.adjust() };
+
+	// adjusted values
+	std::vector<ga::Rigid> const & fitOris = bundle.oriAcqWrtRefs();
+	std::vector<ga::Vector> const & fitPnts = bundle.pntInRefs();
+	// ExampleEnd
+
+	if (! bundle.isValid())
+	{
+		oss << "Failure of valid bundle test" << std::endl;
+	}
+	else
+	if (! ((fitOris.size() == oris.size()) && (fitPnts.size() == pnts.size())))
+	{
+		oss << "Failure of result size test" << std::endl;
+	}
+	else
+	{
+		// 7 datum parameters held fixed
+		size_t const expNumPrms{ 6u * oris.size() - 7u };
+		size_t const gotNumPrms{ bundle.numOriParameters() };
+		if (! dat::nearlyEquals(gotNumPrms, expNumPrms))
+		{
+			oss << "Failure of numOriParameters test" << std::endl;
+			oss << dat::infoString(expNumPrms, "expNumPrms") << std::endl;
+			oss << dat::infoString(gotNumPrms, "gotNumPrms") << std::endl;
+		}
+
+		double const gotRms{ bundle.rmsResidual() };
+		if (iters.empty() || (! (gotRms < 1.e-10)))
+		{
+			oss << "Failure of residual test" << std::endl;
+			oss << dat::infoString(iters.size(), "numIters") << std::endl;
+			oss << dat::infoString(gotRms, "gotRms") << std::endl;
+		}
+		checkResult(oss, bundle, sim, "Cholesky");
+	}
+
+	return oss.str();
+}
+
+//! Check solution methods and job partitioning are consistent
+std::string
+blk_Bundle_test2
+	()
+{
+	std::ostringstream oss;
+
+	Sim const sim(9u);
+
+	blk::Bundle bundleA{ sim.bundle() };
+	bundleA.adjust(25u, 1.e-9, blk::Bundle::Cholesky, 1u);
+	checkResult(oss, bundleA, sim, "Cholesky:1");
+
+	blk::Bundle bundleB{ sim.bundle() };
+	bundleB.adjust(25u, 1.e-9, blk::Bundle::Cholesky, 4u);
+	checkResult(oss, bundleB, sim, "Cholesky:4");
+
+	blk::Bundle bundleC{ sim.bundle() };
+	bundleC.adjust(25u, 1.e-9, blk::Bundle::ConjGrad, 3u);
+	checkResult(oss, bundleC, sim, "ConjGrad:3");
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for blk::Bundle
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << blk_Bundle_test0();
+	oss << blk_Bundle_test1();
+	oss << blk_Bundle_test2();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,304 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief  This file contains unit test for blk::relori
+*/
+
+
+#include "libblk/relori.h"
+
+#include "libblk/sim.h"
+#include "libdat/info.h"
+#include "libdat/validity.h"
+#include "libio/stream.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+//! Check for common functions
+std::string
+blk_relori_test0
+	()
+{
+	std::ostringstream oss;
+	blk::relori::PairStats const aNull{};
+	if (aNull.isValid())
+	{
+		oss << "Failure of null value test" << std::endl;
+		oss << "infoString: " << aNull.infoString() << std::endl;
+	}
+
+	// no measurements - no solutions
+	cam::Camera const camera{ 1., dat::Extents(1000u, 1000u) };
+	ro::OriPair const roNom
+		{ ga::Rigid::identity(), ga::Rigid(ga::e1, ga::Pose::identity()) };
+	std::vector<blk::relori::PairStats> stats;
+	blk::RelOriPool const pool
+		{ blk::relori::poolFor(cam::XRefSpots{}, camera, roNom, 8u, 1.e-3
+		, &stats)
+		};
+	if (! (pool.theRelOriMap.empty() && stats.empty()))
+	{
+		oss << "Failure of empty pool test" << std::endl;
+	}
+	return oss.str();
+}
+
+//! Simulated strip of (downward looking) acquisitions over terrain
+struct Sim
+{
+	cam::Camera const theCamera{ 1., dat::Extents(1000u, 1000u) };
+	std::vector<ga::Rigid> theExpOris;
+	cam::XRefSpots theSpots;
+
+	explicit
+	Sim
+		( size_t const & numAcqs
+		)
+	{
+		for (size_t acqNdx{0u} ; acqNdx < numAcqs ; ++acqNdx)
+		{
+			double const xx{ double(acqNdx) };
+			double const ang{ .02 * double(acqNdx % 3u) };
+			theExpOris.emplace_back
+				(blk::sim::oriComps(xx, .1 * xx, 10., ang, -ang, .5 * ang));
+		}
+		std::vector<ga::Vector> pnts;
+		for (int ix{-8} ; ix <= 8 + 2 * int(numAcqs) ; ++ix)
+		{
+			for (int iy{-8} ; iy <= 8 ; ++iy)
+			{
+				double const zz{ .50 * double((ix * iy + 7) % 5) };
+				pnts.emplace_back
+					(ga::Vector(.25 * double(ix), .25 * double(iy), zz));
+			}
+		}
+
+		// observe points within a limited field of view
+		theSpots = cam::XRefSpots(pnts.size(), theExpOris.size());
+		for (size_t pntNdx{0u} ; pntNdx < pnts.size() ; ++pntNdx)
+		{
+			for (size_t acqNdx{0u} ; acqNdx < numAcqs ; ++acqNdx)
+			{
+				ga::Vector const pCam{ theExpOris[acqNdx](pnts[pntNdx]) };
+				dat::Spot const spot{ theCamera.imageSpotFor(pCam) };
+				if (dat::isValid(spot) && (dat::magnitude(spot) < .35))
+				{
+					theSpots(pntNdx, acqNdx) = spot;
+				}
+			}
+		}
+	}
+
+	//! Expected RO (with unit base) for key.second w.r.t. key.first
+	ga::Rigid
+	expRelOri
+		( blk::EdgeKey const & key
+		) const
+	{
+		ga::Rigid const & ori1 = theExpOris[key.first];
+		ga::Rigid const & ori2 = theExpOris[key.second];
+		ga::Rigid const ori2w1{ ori2 * ori1.inverse() };
+		return ga::Rigid(ga::unit(ori2w1.location()), ori2w1.pose());
+	}
+};
+
+//! Check RO of all pairs in a simulated strip
+std::string
+blk_relori_test1
+	()
+{
+	std::ostringstream oss;
+
+	Sim const sim(5u);
+
+	// ExampleStart
+	// nominal RO: base along (camera) e1 direction
+	ro::OriPair const roNom
+		{ ga::Rigid::identity(), ga::Rigid(ga::e1, ga::Pose::identity()) };
+
+	// solve all overlapping pairs concurrently
+	std::vector<blk::relori::PairStats> stats;
+	constexpr size_t minCommon{ 20u };
+	constexpr double inlierGap{ 1.e-6 };
+	blk::RelOriPool const pool
+		{ blk::relori::poolFor
+			(sim.theSpots, sim.theCamera, roNom, minCommon, inlierGap, &stats)
+		};
+	// ExampleEnd
+
+	std::vector<cam::XRefSpots::AcqOverlap> const overlaps
+		{ sim.theSpots.acqPairsWithOverlap(minCommon) };
+	if (! ((overlaps.size() == stats.size()) && (1u < stats.size())))
+	{
+		oss << "Failure of stats size test" << std::endl;
+		oss << dat::infoString(overlaps.size(), "overlaps") << std::endl;
+		oss << dat::infoString(stats.size(), "stats") << std::endl;
+	}
+	else
+	{
+		for (size_t nn{0u} ; nn < stats.size() ; ++nn)
+		{
+			blk::relori::PairStats const & stat = stats[nn];
+			blk::EdgeKey const expKey
+				{ overlaps[nn].theAcqNdx1, overlaps[nn].theAcqNdx2 };
+			if (! ((expKey == stat.theEdgeKey) && stat.isSolved()))
+			{
+				oss << "Failure of stat key/solved test" << std::endl;
+				oss << stat.infoString("stat") << std::endl;
+				continue;
+			}
+
+			// without noise all common points should be inliers
+			if (! (stat.theNumInliers == stat.theNumCommon))
+			{
+				oss << "Failure of numInliers test" << std::endl;
+				oss << stat.infoString("stat") << std::endl;
+			}
+
+			// check solution
+			blk::EdgeOri const gotEdge
+				{ pool.edgeOriFor(expKey.first, expKey.second) };
+			ga::Rigid const expOri{ sim.expRelOri(expKey) };
+			ga::Rigid const & gotOri = gotEdge.second;
+			double const tol{ 1.e-6 };
+			if (! gotOri.nearlyEquals(expOri, tol, tol))
+			{
+				oss << "Failure of relOri test" << std::endl;
+				oss << stat.infoString("stat") << std::endl;
+				oss << dat::infoString(expOri, "expOri") << std::endl;
+				oss << dat::infoString(gotOri, "gotOri") << std::endl;
+			}
+		}
+	}
+
+	// io::out() << blk::relori::infoString(stats, "stats") << std::endl;
+
+	return oss.str();
+}
+
+//! Check that results do not depend on number of concurrent jobs
+std::string
+blk_relori_test2
+	()
+{
+	std::ostringstream oss;
+
+	Sim const sim(6u);
+	ro::OriPair const roNom
+		{ ga::Rigid::identity(), ga::Rigid(ga::e1, ga::Pose::identity()) };
+	constexpr size_t minCommon{ 20u };
+	constexpr double inlierGap{ 1.e-6 };
+	constexpr size_t numDraws{ 64u };
+
+	std::vector<blk::relori::PairStats> expStats;
+	blk::RelOriPool const expPool
+		{ blk::relori::poolFor
+			( sim.theSpots, sim.theCamera, roNom, minCommon, inlierGap
+			, &expStats, numDraws, 1u
+			)
+		};
+
+	std::vector<size_t> const jobCounts{ 2u, 3u, 8u };
+	for (size_t const & numJobs : jobCounts)
+	{
+		std::vector<blk::relori::PairStats> gotStats;
+		blk::RelOriPool const gotPool
+			{ blk::relori::poolFor
+				( sim.theSpots, sim.theCamera, roNom, minCommon, inlierGap
+				, &gotStats, numDraws, numJobs
+				)
+			};
+		if (! (gotStats.size() == expStats.size()))
+		{
+			oss << "Failure of numJobs stats size test" << std::endl;
+			oss << dat::infoString(numJobs, "numJobs") << std::endl;
+			continue;
+		}
+		for (size_t nn{0u} ; nn < gotStats.size() ; ++nn)
+		{
+			blk::relori::PairStats const & expStat = expStats[nn];
+			blk::relori::PairStats const & gotStat = gotStats[nn];
+			// exact match expected - same samples drawn for each pair
+			bool const same
+				{  (gotStat.theEdgeKey == expStat.theEdgeKey)
+				&& (gotStat.theNumInliers == expStat.theNumInliers)
+				&& (gotStat.theRmsGap == expStat.theRmsGap)
+				};
+			if (! same)
+			{
+				oss << "Failure of numJobs independence test" << std::endl;
+				oss << dat::infoString(numJobs, "numJobs") << std::endl;
+				oss << expStat.infoString("expStat") << std::endl;
+				oss << gotStat.infoString("gotStat") << std::endl;
+			}
+		}
+		if (! (gotPool.theRelOriMap.size() == expPool.theRelOriMap.size()))
+		{
+			oss << "Failure of numJobs pool size test" << std::endl;
+			oss << dat::infoString(numJobs, "numJobs") << std::endl;
+		}
+	}
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for blk::relori
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << blk_relori_test0();
+	oss << blk_relori_test1();
+	oss << blk_relori_test2();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,137 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2020 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for cam::xref
+*/
+
+
+#include "libcam/xref.h"
+
+#include "libdat/info.h"
+#include "libdat/validity.h"
+#include "libio/stream.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+//! Check batched space intersection for all points
+std::string
+cam_xref_test1
+	()
+{
+	std::ostringstream oss;
+
+	// simulate rays from a few stations to a number of points
+	std::vector<ga::Vector> const stas
+		{ ga::Vector(0., 0., 10.)
+		, ga::Vector(3., 0., 10.)
+		, ga::Vector(6., 1., 11.)
+		};
+	std::vector<ga::Vector> expPnts;
+	for (size_t nn{0u} ; nn < 100u ; ++nn)
+	{
+		double const dn{ double(nn) };
+		expPnts.emplace_back(ga::Vector(.05 * dn, 2. - .03 * dn, .01 * dn));
+	}
+
+	// ExampleStart
+	cam::XRefRays rayTab(expPnts.size(), stas.size());
+	for (cam::PntNdx pntNdx{0u} ; pntNdx < expPnts.size() ; ++pntNdx)
+	{
+		for (cam::AcqNdx acqNdx{0u} ; acqNdx < stas.size() ; ++acqNdx)
+		{
+			// last point only observed once
+			if ((pntNdx + 1u < expPnts.size()) || (0u == acqNdx))
+			{
+				rayTab(pntNdx, acqNdx)
+					= geo::Ray::fromToward(stas[acqNdx], expPnts[pntNdx]);
+			}
+		}
+	}
+
+	// intersect rays for all points (in parallel)
+	std::vector<geo::si::PointSoln> const solns
+		{ cam::xref::pointSolutions(rayTab) };
+	// ExampleEnd
+
+	if (! (expPnts.size() == solns.size()))
+	{
+		oss << "Failure of solution size test" << std::endl;
+		return oss.str();
+	}
+	for (size_t pntNdx{0u} ; pntNdx + 1u < expPnts.size() ; ++pntNdx)
+	{
+		ga::Vector const & expPnt = expPnts[pntNdx];
+		ga::Vector const & gotPnt = solns[pntNdx].theLoc;
+		if (! gotPnt.nearlyEquals(expPnt, 1.e-9))
+		{
+			oss << "Failure of point solution test" << std::endl;
+			oss << dat::infoString(expPnt, "expPnt") << std::endl;
+			oss << dat::infoString(gotPnt, "gotPnt") << std::endl;
+			break;
+		}
+	}
+	if (dat::isValid(solns.back().theLoc))
+	{
+		oss << "Failure of single ray null solution test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for cam::xref
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << cam_xref_test1();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
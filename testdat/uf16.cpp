@@ -0,0 +1,182 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for dat::f16
+*/
+
+
+#include "libdat/f16.h"
+
+#include "libdat/validity.h"
+#include "libio/stream.h"
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+//! True if got is (one of) the nearest half values to value
+bool
+isNearest
+	( float const & value
+	, dat::f16_t const & got
+	)
+{
+	dat::f16_t const exp
+		{ half_float::half_cast<dat::f16_t, std::round_to_nearest>(value) };
+	float const difExp{ std::abs(static_cast<float>(exp) - value) };
+	float const difGot{ std::abs(static_cast<float>(got) - value) };
+	return (difGot == difExp); // same, or other side of an exact tie
+}
+
+//! Check batch conversions
+std::string
+dat_f16_test0
+	()
+{
+	std::ostringstream oss;
+
+	// values of various magnitude (and a length not multiple of 8)
+	std::vector<float> values;
+	for (int nn{-500} ; nn < 503 ; ++nn)
+	{
+		float const mag{ std::pow(1.0371f, float(nn % 200)) };
+		values.emplace_back(float(nn) * mag / 7.f);
+	}
+	values.emplace_back(dat::nullValue<float>());
+	values.emplace_back(0.f);
+
+	for (size_t num : { size_t(0u), size_t(1u), size_t(9u), values.size() })
+	{
+		std::vector<dat::f16_t> halfs(num, dat::f16_t(-1.f));
+		dat::f16::halfsFromFloats
+			(values.data(), values.data() + num, halfs.data());
+		std::vector<float> floats(num, -1.f);
+		dat::f16::floatsFromHalfs
+			(halfs.data(), halfs.data() + num, floats.data());
+
+		size_t errCount{ 0u };
+		for (size_t nn{0u} ; nn < num ; ++nn)
+		{
+			float const & value = values[nn];
+			if (dat::isValid(value))
+			{
+				bool const okayHalf{ isNearest(value, halfs[nn]) };
+				bool const okayFloat
+					{ static_cast<float>(halfs[nn]) == floats[nn] };
+				if (! (okayHalf && okayFloat))
+				{
+					++errCount;
+				}
+			}
+			else
+			if (dat::isValid(halfs[nn]) || dat::isValid(floats[nn]))
+			{
+				oss << "Failure of null propagation test" << std::endl;
+			}
+		}
+		if (0u < errCount)
+		{
+			oss << "Failure of batch conversion test: num = " << num
+				<< " errCount = " << errCount << std::endl;
+		}
+	}
+
+	return oss.str();
+}
+
+//! Check grid conversions
+std::string
+dat_f16_test1
+	()
+{
+	std::ostringstream oss;
+
+	// ExampleStart
+	// store float data at half precision (e.g. to save memory)
+	dat::grid<float> floatGrid(3u, 5u);
+	for (size_t nn{0u} ; nn < floatGrid.size() ; ++nn)
+	{
+		floatGrid.begin()[nn] = .25f * float(nn);
+	}
+	dat::grid<dat::f16_t> const halfGrid(dat::f16::halfGridFor(floatGrid));
+
+	// and expand back to float for computation
+	dat::grid<float> const gotGrid(dat::f16::floatGridFor(halfGrid));
+	// ExampleEnd
+
+	if (! (gotGrid.hwSize() == floatGrid.hwSize()))
+	{
+		oss << "Failure of grid size test" << std::endl;
+	}
+	else
+	if (! std::equal(gotGrid.begin(), gotGrid.end(), floatGrid.begin()))
+	{
+		// values are exactly representable
+		oss << "Failure of grid round trip test" << std::endl;
+	}
+
+	if (dat::f16::halfGridFor(dat::grid<float>{}).isValid())
+	{
+		oss << "Failure of null grid test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for dat::f16
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << dat_f16_test0();
+	oss << dat_f16_test1();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
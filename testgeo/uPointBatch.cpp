@@ -0,0 +1,236 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2020 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for geo::si::PointBatch
+*/
+
+
+#include "libgeo/PointBatch.h"
+
+#include "libdat/info.h"
+#include "libdat/validity.h"
+#include "libio/stream.h"
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+//! Check for common functions
+std::string
+geo_si_PointBatch_test0
+	()
+{
+	std::ostringstream oss;
+	geo::si::PointBatch const aNull{};
+	if (! aNull.pointSolutions().empty())
+	{
+		oss << "Failure of null solution test" << std::endl;
+		oss << "infoString: " << aNull.infoString() << std::endl;
+	}
+	return oss.str();
+}
+
+//! Semi axes agree (magnitude and direction up to sign)
+bool
+sameAxes
+	( geo::si::PointSoln const & solnA
+	, geo::si::PointSoln const & solnB
+	, double const & tol
+	)
+{
+	bool same{ true };
+	for (size_t kk{0u} ; kk < 3u ; ++kk)
+	{
+		geo::si::SemiAxis const & axisA = solnA.theSemiAxes[kk];
+		geo::si::SemiAxis const & axisB = solnB.theSemiAxes[kk];
+		double const dotAB{ ga::dot(axisA.theDir, axisB.theDir).theValue };
+		same &= dat::nearlyEquals(axisA.theMag, axisB.theMag, tol);
+		same &= dat::nearlyEquals(std::abs(dotAB), 1., tol);
+	}
+	return same;
+}
+
+//! Check batch solutions match individual PointSystem ones
+std::string
+geo_si_PointBatch_test1
+	()
+{
+	std::ostringstream oss;
+
+	// ExampleStart
+	// observations for several points
+	size_t const numPnts{ 50u };
+	std::vector<std::vector<geo::si::WRay> > wraysPerPnt(numPnts);
+	for (size_t pNdx{0u} ; pNdx < numPnts ; ++pNdx)
+	{
+		double const pp{ double(pNdx) };
+		ga::Vector const pnt(.3 * pp, 10. - .1 * pp, std::sin(pp));
+		size_t const numRays{ 2u + (pNdx % 5u) };
+		for (size_t rNdx{0u} ; rNdx < numRays ; ++rNdx)
+		{
+			double const rr{ double(rNdx) };
+			ga::Vector const sta(5. * rr, -3. + rr, 20. + .5 * pp);
+			// slightly inconsistent rays (for nonzero residuals)
+			ga::Vector const off(.01 * rr, -.02 * rr, .01 * pp / 50.);
+			double const weight{ 1. + .25 * rr };
+			geo::Ray const ray{ geo::Ray::fromToward(sta, pnt + off) };
+			wraysPerPnt[pNdx].emplace_back(geo::si::WRay{ weight, ray });
+		}
+	}
+
+	// accumulate all into batch, then solve all points concurrently
+	geo::si::PointBatch batch(numPnts);
+	for (size_t pNdx{0u} ; pNdx < numPnts ; ++pNdx)
+	{
+		for (geo::si::WRay const & wray : wraysPerPnt[pNdx])
+		{
+			batch.addWeightedRay(pNdx, wray);
+		}
+	}
+	std::vector<geo::si::PointSoln> const gotSolns{ batch.pointSolutions() };
+	// ExampleEnd
+
+	if (! (numPnts == gotSolns.size()))
+	{
+		oss << "Failure of solution size test" << std::endl;
+		return oss.str();
+	}
+
+	for (size_t pNdx{0u} ; pNdx < numPnts ; ++pNdx)
+	{
+		geo::si::PointSystem system{};
+		system.addWeightedRays(wraysPerPnt[pNdx]);
+		geo::si::PointSoln const expSoln{ system.pointSolution() };
+		geo::si::PointSoln const & gotSoln = gotSolns[pNdx];
+
+		double const tol{ 1.e-9 };
+		if (! gotSoln.theLoc.nearlyEquals(expSoln.theLoc, tol))
+		{
+			oss << "Failure of batch location test: " << pNdx << std::endl;
+			oss << dat::infoString(expSoln.theLoc, "exp") << std::endl;
+			oss << dat::infoString(gotSoln.theLoc, "got") << std::endl;
+			break;
+		}
+		if (! sameAxes(gotSoln, expSoln, tol))
+		{
+			oss << "Failure of batch semi-axes test: " << pNdx << std::endl;
+			oss << expSoln.infoString("exp") << std::endl;
+			oss << gotSoln.infoString("got") << std::endl;
+			break;
+		}
+	}
+
+	// single and concurrent solutions should agree exactly
+	std::vector<geo::si::PointSoln> const oneSolns
+		{ batch.pointSolutions(2u, 1u) };
+	for (size_t pNdx{0u} ; pNdx < numPnts ; ++pNdx)
+	{
+		ga::Vector const & expLoc = oneSolns[pNdx].theLoc;
+		ga::Vector const & gotLoc = batch.pointSolution(pNdx).theLoc;
+		if (! gotLoc.nearlyEquals(expLoc, 0.))
+		{
+			oss << "Failure of single job location test" << std::endl;
+			break;
+		}
+	}
+
+	return oss.str();
+}
+
+//! Check rays with planes and minimum observation threshold
+std::string
+geo_si_PointBatch_test2
+	()
+{
+	std::ostringstream oss;
+
+	ga::Vector const base{ 0., 300., 10. };
+	ga::Vector const raySta{ base + 50. * ga::e3 };
+	ga::Vector const expPnt{ base - 1000. * ga::e1 };
+	geo::si::WRay const wray{ .5, geo::Ray::fromToward(raySta, expPnt) };
+	geo::si::WPlane const wplane{ 1., geo::Plane(base, ga::E12) };
+
+	geo::si::PointBatch batch(3u);
+	batch.addWeightedRay(0u, wray);
+	batch.addWeightedPlane(0u, wplane);
+	batch.addWeightedRay(2u, wray); // only one observation
+
+	std::vector<geo::si::PointSoln> const solns{ batch.pointSolutions(2u) };
+	ga::Vector const & gotPnt = solns[0].theLoc;
+	double const tol{ 1.e-9 * 1000. };
+	if (! gotPnt.nearlyEquals(expPnt, tol))
+	{
+		oss << "Failure of ray/plane solution test" << std::endl;
+		oss << dat::infoString(expPnt, "expPnt") << std::endl;
+		oss << dat::infoString(gotPnt, "gotPnt") << std::endl;
+	}
+	if (dat::isValid(solns[1].theLoc) || dat::isValid(solns[2].theLoc))
+	{
+		oss << "Failure of minNumObs null solution test" << std::endl;
+	}
+	if (! (2u == batch.numObservations(0u)))
+	{
+		oss << "Failure of numObservations test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for geo::si::PointBatch
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << geo_si_PointBatch_test0();
+	oss << geo_si_PointBatch_test1();
+	oss << geo_si_PointBatch_test2();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,200 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for img::io::AsyncWriter
+*/
+
+
+#include "libimg/AsyncWriter.h"
+
+#include "libio/stream.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+
+//! Check writes and flush
+std::string
+img_AsyncWriter_test0
+	()
+{
+	std::ostringstream oss;
+
+	constexpr size_t numFiles{ 8u };
+	std::vector<std::string> fpaths;
+	std::vector<dat::grid<uint8_t> > expGrids;
+	for (size_t nn{0u} ; nn < numFiles ; ++nn)
+	{
+		fpaths.emplace_back("uAsyncWriter_" + std::to_string(nn) + ".png");
+		expGrids.emplace_back(dat::grid<uint8_t>(20u + nn, 30u, uint8_t(nn)));
+	}
+
+	// ExampleStart
+	// a writer with two threads (and at most 1 MByte pending)
+	img::io::AsyncWriter writer(2u, 1024u*1024u);
+	for (size_t nn{0u} ; nn < numFiles ; ++nn)
+	{
+		// grid is moved into writer - caller continues without waiting
+		dat::grid<uint8_t> grid(expGrids[nn]);
+		writer.savePng(std::move(grid), fpaths[nn]);
+	}
+	// wait until all files have been written
+	writer.flush();
+	// ExampleEnd
+
+	if (! ((numFiles == writer.numWritten()) && (0u == writer.numFailed())))
+	{
+		oss << "Failure of write count test" << std::endl;
+		oss << writer.infoString("writer") << std::endl;
+	}
+	for (size_t nn{0u} ; nn < numFiles ; ++nn)
+	{
+		dat::grid<uint8_t> const gotGrid(img::io::loadFromPng8(fpaths[nn]));
+		if (! ( (gotGrid.hwSize() == expGrids[nn].hwSize())
+			 && std::equal
+				(gotGrid.begin(), gotGrid.end(), expGrids[nn].begin())
+			  ))
+		{
+			oss << "Failure of written content test: nn = " << nn
+				<< std::endl;
+		}
+		std::remove(fpaths[nn].c_str());
+	}
+
+	// text and failure reporting
+	std::string const tpath("uAsyncWriter.txt");
+	writer.saveText(std::string("score 1.25\n"), tpath);
+	writer.saveToFloat(dat::grid<float>{}, "uAsyncWriter_null.dat");
+	writer.flush();
+	std::ifstream ifs(tpath);
+	std::string const gotText
+		{ std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()
+		};
+	if (! ("score 1.25\n" == gotText))
+	{
+		oss << "Failure of saveText test" << std::endl;
+	}
+	if (! (1u == writer.numFailed()))
+	{
+		oss << "Failure of failed request count test" << std::endl;
+	}
+	std::remove(tpath.c_str());
+
+	return oss.str();
+}
+
+//! Check pending bytes limit and completion at destruction
+std::string
+img_AsyncWriter_test1
+	()
+{
+	std::ostringstream oss;
+
+	constexpr size_t numTasks{ 20u };
+	constexpr size_t taskBytes{ 100u };
+	std::atomic<size_t> numRunning{ 0u };
+	std::atomic<size_t> maxRunning{ 0u };
+	std::atomic<size_t> numDone{ 0u };
+	{
+		// room for only two pending requests
+		img::io::AsyncWriter writer(4u, 2u * taskBytes);
+		for (size_t nn{0u} ; nn < numTasks ; ++nn)
+		{
+			writer.enqueue
+				( [&numRunning, &maxRunning, &numDone] ()
+					{
+						size_t const running{ ++numRunning };
+						size_t prev{ maxRunning };
+						while ( (prev < running)
+							 && (! maxRunning.compare_exchange_weak
+								(prev, running))
+							  )
+						{ }
+						std::this_thread::sleep_for
+							(std::chrono::milliseconds(2));
+						--numRunning;
+						++numDone;
+						return true;
+					}
+				, taskBytes
+				);
+		}
+		// destructor completes remaining requests
+	}
+
+	if (! (numTasks == numDone))
+	{
+		oss << "Failure of completion at destruction test" << std::endl;
+	}
+	if (2u < maxRunning)
+	{
+		oss << "Failure of pending bytes limit test" << std::endl;
+		oss << "maxRunning: " << maxRunning << std::endl;
+	}
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for img::io::AsyncWriter
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << img_AsyncWriter_test0();
+	oss << img_AsyncWriter_test1();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,257 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for img::io::SequenceLoader
+*/
+
+
+#include "libimg/SequenceLoader.h"
+
+#include "libio/stream.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+
+//! Simple (distinct) image content for index ndx
+dat::grid<uint8_t>
+simGrid
+	( size_t const & ndx
+	)
+{
+	dat::grid<uint8_t> grid(16u + ndx, 24u);
+	for (size_t row{0u} ; row < grid.high() ; ++row)
+	{
+		for (size_t col{0u} ; col < grid.wide() ; ++col)
+		{
+			size_t const value{ (7u * ndx + row + col) % 256u };
+			grid(row, col) = static_cast<uint8_t>(value);
+		}
+	}
+	return grid;
+}
+
+//! True if grids are same size and content
+bool
+sameGrids
+	( dat::grid<uint8_t> const & gridA
+	, dat::grid<uint8_t> const & gridB
+	)
+{
+	return
+		(  (gridA.hwSize() == gridB.hwSize())
+		&& std::equal(gridA.begin(), gridA.end(), gridB.begin())
+		);
+}
+
+//! Check sequence order and content from image files
+std::string
+img_SequenceLoader_test0
+	()
+{
+	std::ostringstream oss;
+
+	// save a few test images
+	constexpr size_t numImages{ 5u };
+	std::vector<std::string> fpaths;
+	for (size_t nn{0u} ; nn < numImages ; ++nn)
+	{
+		std::string const fpath
+			{ "uSequenceLoader_" + std::to_string(nn) + ".png" };
+		if (img::io::savePng(simGrid(nn), fpath))
+		{
+			fpaths.emplace_back(fpath);
+		}
+	}
+	fpaths.emplace_back("uSequenceLoader_noSuchFile.png");
+	if (! ((numImages + 1u) == fpaths.size()))
+	{
+		oss << "Failure of test image setup" << std::endl;
+		return oss.str();
+	}
+
+	// ExampleStart
+	// images are decoded in background (two ahead, with 3 threads)
+	img::io::SequenceLoader<uint8_t> loader
+		(fpaths, img::io::loadFromPng8, 2u, 1024u*1024u, 3u);
+	size_t count{ 0u };
+	dat::grid<uint8_t> grid;
+	size_t ndx{ 0u };
+	while (loader.nextGrid(&grid, &ndx)) // in same order as fpaths
+	{
+		// ... use grid
+		// ExampleEnd
+		if (! (count == ndx))
+		{
+			oss << "Failure of sequence order test" << std::endl;
+			oss << "exp: " << count << std::endl;
+			oss << "got: " << ndx << std::endl;
+		}
+		else
+		if (ndx < numImages)
+		{
+			if (! sameGrids(grid, simGrid(ndx)))
+			{
+				oss << "Failure of image content test: ndx = " << ndx
+					<< std::endl;
+			}
+		}
+		else
+		if (grid.isValid())
+		{
+			oss << "Failure of missing file (null grid) test" << std::endl;
+		}
+		++count;
+		// ExampleStart
+	}
+	// ExampleEnd
+
+	if (! (fpaths.size() == count))
+	{
+		oss << "Failure of sequence count test" << std::endl;
+		oss << "exp: " << fpaths.size() << std::endl;
+		oss << "got: " << count << std::endl;
+	}
+	if (loader.nextGrid(&grid))
+	{
+		oss << "Failure of end of sequence test" << std::endl;
+	}
+
+	for (std::string const & fpath : fpaths)
+	{
+		std::remove(fpath.c_str());
+	}
+
+	return oss.str();
+}
+
+//! Check memory limit and early termination
+std::string
+img_SequenceLoader_test1
+	()
+{
+	std::ostringstream oss;
+
+	constexpr size_t numImages{ 200u };
+	std::vector<std::string> fpaths;
+	for (size_t nn{0u} ; nn < numImages ; ++nn)
+	{
+		fpaths.emplace_back(std::to_string(nn));
+	}
+	std::atomic<size_t> numDecoded{ 0u };
+	auto const decoder
+		{ [&numDecoded] (std::string const & name)
+			{
+				++numDecoded;
+				return simGrid(std::stoul(name) % 16u);
+			}
+		};
+
+	// byte limit (about 1 image) is more restrictive than queue size
+	size_t const maxBytes{ simGrid(0u).size() };
+	constexpr size_t numThreads{ 2u };
+	{
+		img::io::SequenceLoader<uint8_t> loader
+			(fpaths, decoder, 100u, maxBytes, numThreads);
+		dat::grid<uint8_t> grid;
+		size_t ndx{ 0u };
+		for (size_t nn{0u} ; nn < 10u ; ++nn)
+		{
+			if (! (loader.nextGrid(&grid, &ndx)
+				&& (nn == ndx) && sameGrids(grid, simGrid(nn % 16u))))
+			{
+				oss << "Failure of limited sequence test: nn = " << nn
+					<< std::endl;
+			}
+		}
+		// let decoders run as far ahead as they are allowed
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		// at most one image beyond limit for each thread
+		size_t const maxDecoded{ 10u + 1u + numThreads };
+		if (maxDecoded < numDecoded)
+		{
+			oss << "Failure of memory limit test" << std::endl;
+			oss << "max: " << maxDecoded << std::endl;
+			oss << "got: " << numDecoded << std::endl;
+		}
+
+		// destructor stops with most images unconsumed
+	}
+	if (! (numDecoded < numImages))
+	{
+		oss << "Failure of early termination test" << std::endl;
+	}
+
+	// null decoder provides a null instance
+	img::io::SequenceLoader<uint8_t> const aNull
+		(fpaths, img::io::SequenceLoader<uint8_t>::Decoder{});
+	if (aNull.isValid())
+	{
+		oss << "Failure of null instance test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for img::io::SequenceLoader
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << img_SequenceLoader_test0();
+	oss << img_SequenceLoader_test1();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
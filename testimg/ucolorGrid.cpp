@@ -0,0 +1,382 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+
+/*! \file
+\brief  This file contains unit test for img::color batch conversions
+*/
+
+
+#include "libimg/colorGrid.h"
+
+#include "libdat/info.h"
+#include "libdat/validity.h"
+#include "libio/stream.h"
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+
+namespace
+{
+
+//! Convenience
+using Grid3 = dat::grid<std::array<float, 3u> >;
+
+//! XYZ values from a sampling of 8-bit (linear) RGB (with one null pixel)
+Grid3
+xyzGrid
+	()
+{
+	Grid3 grid(16u, 16u * 16u);
+	Grid3::iterator itOut(grid.begin());
+	for (size_t red{0u} ; red < 256u ; red += 17u)
+	{
+		for (size_t grn{0u} ; grn < 256u ; grn += 17u)
+		{
+			for (size_t blu{0u} ; blu < 256u ; blu += 17u)
+			{
+				img::UPix8 const rgb
+					( static_cast<uint8_t>(red)
+					, static_cast<uint8_t>(grn)
+					, static_cast<uint8_t>(blu)
+					);
+				img::FPix const xyz(img::color::toXYZfromLRGB8(rgb));
+				*itOut++ = {{ xyz[0], xyz[1], xyz[2] }};
+			}
+		}
+	}
+	grid(3u, 5u) = {{ img::fpixBad, .5f, .5f }};
+	return grid;
+}
+
+//! Planar channels from deep grid
+std::array<dat::grid<float>, 3u>
+planarFrom
+	( Grid3 const & deep
+	)
+{
+	std::array<dat::grid<float>, 3u> chans;
+	for (size_t nc{0u} ; nc < 3u ; ++nc)
+	{
+		chans[nc] = dat::grid<float>(deep.hwSize());
+		for (size_t nn{0u} ; nn < deep.size() ; ++nn)
+		{
+			chans[nc].begin()[nn] = deep.begin()[nn][nc];
+		}
+	}
+	return chans;
+}
+
+//! Single pixel conversion function
+using PixFunc = img::FPix (*)(img::FPix const &);
+
+//! Number of pixels for which batch values differ from FPix function
+size_t
+errCountFor
+	( Grid3 const & inGrid
+	, Grid3 const & gotGrid
+	, PixFunc const & pixFunc
+	, float const & tol
+	)
+{
+	size_t errCount{ 0u };
+	for (size_t nn{0u} ; nn < inGrid.size() ; ++nn)
+	{
+		std::array<float, 3u> const & inPix = inGrid.begin()[nn];
+		img::FPix const exp(pixFunc(img::FPix(inPix[0], inPix[1], inPix[2])));
+		std::array<float, 3u> const & got = gotGrid.begin()[nn];
+		for (size_t nc{0u} ; nc < 3u ; ++nc)
+		{
+			bool const same
+				{ (dat::isValid(exp[nc]) == dat::isValid(got[nc]))
+				&& ( (! dat::isValid(exp[nc]))
+				  || (std::abs(exp[nc] - got[nc]) <= tol)
+				   )
+				};
+			if (! same)
+			{
+				++errCount;
+			}
+		}
+	}
+	return errCount;
+}
+
+//! True if deep and planar grids have identical values (incl nulls)
+bool
+sameValues
+	( Grid3 const & deep
+	, std::array<dat::grid<float>, 3u> const & chans
+	)
+{
+	bool same{ deep.hwSize() == chans[0].hwSize() };
+	for (size_t nn{0u} ; same && (nn < deep.size()) ; ++nn)
+	{
+		for (size_t nc{0u} ; same && (nc < 3u) ; ++nc)
+		{
+			float const & dval = deep.begin()[nn][nc];
+			float const & pval = chans[nc].begin()[nn];
+			same = (dat::isValid(dval) == dat::isValid(pval))
+				&& ((! dat::isValid(dval)) || (dval == pval));
+		}
+	}
+	return same;
+}
+
+//! Check null cases
+std::string
+img_colorGrid_test0
+	()
+{
+	std::ostringstream oss;
+
+	Grid3 const nullGrid;
+	if (img::color::toLabFromXYZ(nullGrid).isValid())
+	{
+		oss << "Failure of null deep grid test" << std::endl;
+	}
+
+	// mismatched planar channel sizes
+	std::array<dat::grid<float>, 3u> const badChans
+		{{ dat::grid<float>(2u, 3u)
+		 , dat::grid<float>(2u, 3u)
+		 , dat::grid<float>(3u, 2u)
+		}};
+	if (img::color::toYxyFromXYZ(badChans)[0].isValid())
+	{
+		oss << "Failure of mismatched planar test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+//! Check batch values against individual pixel conversions
+std::string
+img_colorGrid_test1
+	()
+{
+	std::ostringstream oss;
+
+	// ExampleStart
+	// deep grid of (normalized) CIE XYZ values
+	Grid3 const xyzDeep(xyzGrid());
+
+	// convert all pixels (rows processed concurrently)
+	Grid3 const labDeep(img::color::toLabFromXYZ(xyzDeep));
+	Grid3 const yxyDeep(img::color::toYxyFromXYZ(xyzDeep));
+
+	// and back again
+	Grid3 const xyzFromLab(img::color::toXYZfromLab(labDeep));
+	Grid3 const xyzFromYxy(img::color::toXYZfromYxy(yxyDeep));
+	// ExampleEnd
+
+	// Lab uses approximate cube root: allow for a few epsilon
+	float const tolLab{ 1.e-5f };
+	float const tolExact{ 0.f };
+	size_t const errLab
+		{ errCountFor
+			(xyzDeep, labDeep, img::color::toLabFromXYZ, tolLab)
+		};
+	size_t const errYxy
+		{ errCountFor
+			(xyzDeep, yxyDeep, img::color::toYxyFromXYZ, tolExact)
+		};
+	size_t const errFromLab
+		{ errCountFor
+			(labDeep, xyzFromLab, img::color::toXYZfromLab, tolExact)
+		};
+	size_t const errFromYxy
+		{ errCountFor
+			(yxyDeep, xyzFromYxy, img::color::toXYZfromYxy, tolExact)
+		};
+	if (! ((0u == errLab) && (0u == errYxy)))
+	{
+		oss << "Failure of forward batch conversion test" << std::endl;
+		oss << dat::infoString(errLab, "errLab") << std::endl;
+		oss << dat::infoString(errYxy, "errYxy") << std::endl;
+	}
+	if (! ((0u == errFromLab) && (0u == errFromYxy)))
+	{
+		oss << "Failure of inverse batch conversion test" << std::endl;
+		oss << dat::infoString(errFromLab, "errFromLab") << std::endl;
+		oss << dat::infoString(errFromYxy, "errFromYxy") << std::endl;
+	}
+
+	// round trip through Lab
+	size_t errTrip{ 0u };
+	for (size_t nn{0u} ; nn < xyzDeep.size() ; ++nn)
+	{
+		std::array<float, 3u> const & exp = xyzDeep.begin()[nn];
+		std::array<float, 3u> const & got = xyzFromLab.begin()[nn];
+		for (size_t nc{0u} ; nc < 3u ; ++nc)
+		{
+			if ( dat::isValid(exp[0])
+			  && (! (std::abs(exp[nc] - got[nc]) < tolLab))
+			   )
+			{
+				++errTrip;
+			}
+		}
+	}
+	if (0u < errTrip)
+	{
+		oss << "Failure of Lab round trip test" << std::endl;
+		oss << dat::infoString(errTrip, "errTrip") << std::endl;
+	}
+
+	return oss.str();
+}
+
+//! Check planar and deep consistency (and independence from numJobs)
+std::string
+img_colorGrid_test2
+	()
+{
+	std::ostringstream oss;
+
+	Grid3 const xyzDeep(xyzGrid());
+	std::array<dat::grid<float>, 3u> const xyzChans(planarFrom(xyzDeep));
+
+	Grid3 const labDeep1(img::color::toLabFromXYZ(xyzDeep, 1u));
+	Grid3 const labDeep4(img::color::toLabFromXYZ(xyzDeep, 4u));
+	std::array<dat::grid<float>, 3u> const labChans
+		(img::color::toLabFromXYZ(xyzChans, 3u));
+	std::array<dat::grid<float>, 3u> const yxyChans
+		(img::color::toYxyFromXYZ(xyzChans, 3u));
+	std::array<dat::grid<float>, 3u> const labXyzChans
+		(img::color::toXYZfromLab(labChans, 3u));
+	std::array<dat::grid<float>, 3u> const yxyXyzChans
+		(img::color::toXYZfromYxy(yxyChans, 3u));
+
+	if (! ( sameValues(labDeep1, planarFrom(labDeep4))
+	     && sameValues(labDeep1, labChans)
+	     && sameValues(img::color::toYxyFromXYZ(xyzDeep), yxyChans)
+	     && sameValues(img::color::toXYZfromLab(labDeep1), labXyzChans)
+	     && sameValues
+	     	(img::color::toXYZfromYxy(img::color::toYxyFromXYZ(xyzDeep))
+	     	, yxyXyzChans
+	     	)
+	      ))
+	{
+		oss << "Failure of planar/deep consistency test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+//! Check handling of null channels (same as FPix functions)
+std::string
+img_colorGrid_test3
+	()
+{
+	std::ostringstream oss;
+
+	// one null channel in each position (and all null)
+	float const nan{ dat::nullValue<float>() };
+	Grid3 inGrid(1u, 4u);
+	inGrid(0u, 0u) = std::array<float, 3u>{{ nan, .3f, .4f }};
+	inGrid(0u, 1u) = std::array<float, 3u>{{ .2f, nan, .4f }};
+	inGrid(0u, 2u) = std::array<float, 3u>{{ .2f, .3f, nan }};
+	inGrid(0u, 3u) = std::array<float, 3u>{{ nan, nan, nan }};
+
+	Grid3 const labGot(img::color::toLabFromXYZ(inGrid));
+	Grid3 const xyzLabGot(img::color::toXYZfromLab(inGrid));
+	Grid3 const yxyGot(img::color::toYxyFromXYZ(inGrid));
+	Grid3 const xyzYxyGot(img::color::toXYZfromYxy(inGrid));
+
+	// L*a*b*: null in, null out
+	size_t numLabValid{ 0u };
+	for (size_t nn{0u} ; nn < inGrid.size() ; ++nn)
+	{
+		for (size_t nc{0u} ; nc < 3u ; ++nc)
+		{
+			numLabValid += (dat::isValid(labGot.begin()[nn][nc]) ? 1u : 0u);
+			numLabValid += (dat::isValid(xyzLabGot.begin()[nn][nc]) ? 1u : 0u);
+		}
+	}
+	if (! (0u == numLabValid))
+	{
+		oss << "Failure of Lab null propagation test" << std::endl;
+		oss << dat::infoString(numLabValid, "numLabValid") << std::endl;
+	}
+
+	// Yxy: null Y produces zeros (as for FPix)
+	std::array<float, 3u> const expZero{{ 0.f, 0.f, 0.f }};
+	if (! (expZero == xyzYxyGot(0u, 0u)))
+	{
+		oss << "Failure of Yxy null luminance test" << std::endl;
+	}
+
+	// all cases same as FPix functions
+	float const tolLab{ 1.e-5f };
+	float const tolExact{ 0.f };
+	size_t const errCount
+		{ errCountFor(inGrid, labGot, img::color::toLabFromXYZ, tolLab)
+		+ errCountFor(inGrid, xyzLabGot, img::color::toXYZfromLab, tolExact)
+		+ errCountFor(inGrid, yxyGot, img::color::toYxyFromXYZ, tolExact)
+		+ errCountFor(inGrid, xyzYxyGot, img::color::toXYZfromYxy, tolExact)
+		};
+	if (! (0u == errCount))
+	{
+		oss << "Failure of null vs FPix test" << std::endl;
+		oss << dat::infoString(errCount, "errCount") << std::endl;
+	}
+
+	return oss.str();
+}
+
+}
+
+//! Unit test for img::color batch conversions
+int
+main
+	( int const /*argc*/
+	, char const * const * const /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << img_colorGrid_test0();
+	oss << img_colorGrid_test1();
+	oss << img_colorGrid_test2();
+	oss << img_colorGrid_test3();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -33,8 +33,12 @@
 
 #include "libimg/convert.h"
 
+#include "libdat/f16.h"
+#include "libdat/validity.h"
 #include "libio/stream.h"
 
+#include <array>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -70,6 +74,178 @@ img_convert_test1
 	return oss.str();
 }
 
+//! Check gray crop from half precision source
+std::string
+img_convert_test2
+	()
+{
+	std::ostringstream oss;
+
+	// source values exactly representable at half precision
+	dat::grid<float> fullGrid(20u, 24u);
+	for (size_t nn{0u} ; nn < fullGrid.size() ; ++nn)
+	{
+		fullGrid.begin()[nn] = static_cast<float>((nn * 37u) % 256u);
+	}
+	dat::grid<dat::f16_t> const halfGrid(dat::f16::halfGridFor(fullGrid));
+
+	std::array<float, 3u> const rgbGains{{ .75f, 1.f, 1.5f }};
+	dat::SubExtents const crop(dat::RowCol{{ 3u, 5u }}, dat::Extents(9u, 12u));
+	dat::grid<float> const expGrid
+		(img::convert::grayGridFrom(fullGrid, crop, rgbGains));
+	dat::grid<float> const gotGrid
+		(img::convert::grayGridFrom(halfGrid, crop, rgbGains));
+
+	bool same{ gotGrid.hwSize() == expGrid.hwSize() };
+	for (size_t nn{0u} ; same && (nn < expGrid.size()) ; ++nn)
+	{
+		float const & exp = expGrid.begin()[nn];
+		float const & got = gotGrid.begin()[nn];
+		same = (dat::isValid(exp) == dat::isValid(got))
+			&& ((! dat::isValid(exp)) || (exp == got));
+	}
+	if (! same)
+	{
+		oss << "Failure of half precision grayGridFrom test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+
+//! Check concurrent tone mapping into caller provided grids
+std::string
+img_convert_test3
+	()
+{
+	std::ostringstream oss;
+
+	// ramp of values
+	dat::grid<float> inGrid(30u, 40u);
+	for (size_t nn{0u} ; nn < inGrid.size() ; ++nn)
+	{
+		inGrid.begin()[nn] = static_cast<float>(nn);
+	}
+	float const inMin{ 0.f };
+	float const inMax{ static_cast<float>(inGrid.size() - 1u) };
+
+	// statistics: extremes and (histogram interpolated) percentiles
+	img::convert::ToneRange const tone
+		(img::convert::toneRangeFor(inGrid, .25, .75, 3u));
+	dat::MinMax<float> const expMinMax(inMin, inMax);
+	size_t const expNumActive{ inGrid.size() };
+	float const tol{ 2.f * inMax / 4096.f };
+	if (! ( tone.isValid()
+	     && tone.theMinMax.nearlyEquals(expMinMax)
+	     && (expNumActive == tone.theNumActive)
+	     && dat::nearlyEquals(tone.theClipMinMax.min(), .25f * inMax, tol)
+	     && dat::nearlyEquals(tone.theClipMinMax.max(), .75f * inMax, tol)
+	      ))
+	{
+		oss << "Failure of toneRangeFor test" << std::endl;
+		oss << tone.infoString("tone") << std::endl;
+	}
+
+	// include a few special pixels
+	inGrid(0u, 1u) = img::fpixBad;
+	inGrid(0u, 2u) = img::fpixOver;
+	inGrid(0u, 3u) = img::fpixUnder;
+
+	// output storage (e.g. reused for each frame of a sequence)
+	dat::grid<uint8_t> outGrid;
+	uint8_t const useForNull{ 0u };
+	dat::MinMax<float> const noMinMax{}; // range from data
+	bool const okay1
+		{ img::convert::downMappedLinearInto
+			(&outGrid, inGrid, noMinMax, useForNull, 1u)
+		};
+	uint8_t const * const ptData1{ outGrid.begin() };
+	bool const okay3
+		{ img::convert::downMappedLinearInto
+			(&outGrid, inGrid, noMinMax, useForNull, 3u)
+		};
+	uint8_t const * const ptData3{ outGrid.begin() };
+
+	if (! (okay1 && okay3 && (ptData1 == ptData3)))
+	{
+		oss << "Failure of output grid reuse test" << std::endl;
+	}
+
+	// compare with explicit linear mapping
+	size_t errCount{ 0u };
+	for (size_t nn{0u} ; nn < inGrid.size() ; ++nn)
+	{
+		float const & inPix = inGrid.begin()[nn];
+		uint8_t expPix{ useForNull };
+		if (img::isOver(inPix))
+		{
+			expPix = img::u8pixMaxValid;
+		}
+		else
+		if (img::isUnder(inPix))
+		{
+			expPix = img::u8pixMinValid;
+		}
+		else
+		if (img::isActive(inPix))
+		{
+			double const frac((inPix - inMin) / (inMax - inMin));
+			double const span(img::u8pixMaxValid - img::u8pixMinValid);
+			expPix = static_cast<uint8_t>
+				(std::floor(img::u8pixMinValid + frac * span));
+		}
+		if (! (expPix == outGrid.begin()[nn]))
+		{
+			++errCount;
+		}
+	}
+	if (0u < errCount)
+	{
+		oss << "Failure of gray downMappedLinearInto test" << std::endl;
+		oss << dat::infoString(errCount, "errCount") << std::endl;
+	}
+
+	// color variants agree with gray mapping of each channel
+	dat::grid<std::array<float, 3u> > deepGrid(inGrid.hwSize());
+	std::array<dat::grid<float>, 3u> const bandGrids
+		{{ inGrid, inGrid, inGrid }};
+	for (size_t nn{0u} ; nn < inGrid.size() ; ++nn)
+	{
+		float const & inPix = inGrid.begin()[nn];
+		deepGrid.begin()[nn] = {{ inPix, inPix, inPix }};
+	}
+	dat::grid<std::array<uint8_t, 3u> > const deepOut
+		(img::convert::downMappedLinear(deepGrid, noMinMax, {{ 7u, 7u, 7u }}));
+	std::array<dat::grid<uint8_t>, 3u> const bandOut
+		(img::convert::downMappedLinear(bandGrids, noMinMax, 7u));
+	size_t colorErrCount{ 0u };
+	for (size_t nn{0u} ; nn < inGrid.size() ; ++nn)
+	{
+		uint8_t expPix{ outGrid.begin()[nn] };
+		if (! img::isValid(inGrid.begin()[nn]))
+		{
+			expPix = 7u;
+		}
+		std::array<uint8_t, 3u> const & deepPix = deepOut.begin()[nn];
+		for (size_t chan{0u} ; chan < 3u ; ++chan)
+		{
+			if (! ( (expPix == deepPix[chan])
+			     && (expPix == bandOut[chan].begin()[nn])
+			      ))
+			{
+				++colorErrCount;
+			}
+		}
+	}
+	if (0u < colorErrCount)
+	{
+		oss << "Failure of color downMappedLinear test" << std::endl;
+		oss << dat::infoString(colorErrCount, "colorErrCount") << std::endl;
+	}
+
+	return oss.str();
+}
+
 }
 
 //! Unit test for img::convert
@@ -84,6 +260,8 @@ main
 	// run tests
 	oss << img_convert_test0();
 	oss << img_convert_test1();
+	oss << img_convert_test2();
+	oss << img_convert_test3();
 
 	// check/report results
 	std::string const errMessages(oss.str());
@@ -159,6 +159,104 @@ img_dilate_test1
 	return oss.str();
 }
 
+	//! Fill result by repeating single passes until nothing changes
+	dat::grid<ElemType>
+	iterativeFilled
+		( dat::grid<ElemType> const & srcGrid
+		)
+	{
+		dat::grid<ElemType> fillGrid(srcGrid);
+		size_t fillCount{ fillGrid.size() };
+		while (0u < fillCount)
+		{
+			size_t currFillCount{};
+			fillGrid = img::dilate::priv::floodWithNearest
+				(fillGrid, img::dilate::priv::sFloodDelta, &currFillCount);
+			if (fillCount == currFillCount)
+			{
+				break;
+			}
+			fillCount = currFillCount;
+		}
+		return fillGrid;
+	}
+
+	//! True if grids have same size and (incl. null) values
+	bool
+	sameValues
+		( dat::grid<ElemType> const & gridA
+		, dat::grid<ElemType> const & gridB
+		)
+	{
+		bool same{ gridA.hwSize() == gridB.hwSize() };
+		for (size_t nn{0u} ; same && (nn < gridA.size()) ; ++nn)
+		{
+			ElemType const & elemA = gridA.begin()[nn];
+			ElemType const & elemB = gridB.begin()[nn];
+			same = (dat::isValid(elemA) == dat::isValid(elemB))
+				&& ((! dat::isValid(elemA)) || (elemA == elemB));
+		}
+		return same;
+	}
+
+//! Check in place fill against repeated single pass fill
+std::string
+img_dilate_test2
+	()
+{
+	std::ostringstream oss;
+
+	// sparse (pseudo random) values with ties, holes and isolated islands
+	dat::grid<ElemType> srcGrid(61u, 83u);
+	std::fill(srcGrid.begin(), srcGrid.end(), sBackElem);
+	size_t seed{ 12345u };
+	for (size_t nn{0u} ; nn < srcGrid.size() ; ++nn)
+	{
+		seed = (1103515245u * seed + 12345u) % 2147483648u;
+		if (0u == (seed % 23u))
+		{
+			srcGrid.begin()[nn] = static_cast<ElemType>(nn);
+		}
+	}
+	for (size_t row{10u} ; row < 40u ; ++row)
+	{
+		for (size_t col{20u} ; col < 70u ; ++col)
+		{
+			srcGrid(row, col) = sBackElem;
+		}
+	}
+	srcGrid(20u, 30u) = -1.f;
+	srcGrid(20u, 34u) = -2.f;
+	srcGrid(24u, 32u) = -3.f;
+
+	dat::grid<ElemType> const expGrid{ iterativeFilled(srcGrid) };
+	dat::grid<ElemType> const gotGrid1{ img::dilate::floodFilled(srcGrid, 1u) };
+	dat::grid<ElemType> const gotGrid3{ img::dilate::floodFilled(srcGrid, 3u) };
+	if (! (sameValues(gotGrid1, expGrid) && sameValues(gotGrid3, expGrid)))
+	{
+		oss << "Failure of fill equivalence test" << std::endl;
+	}
+
+	// in place fill reports number of elements filled
+	size_t expNumFilled{ 0u };
+	for (ElemType const & elem : srcGrid)
+	{
+		if (! dat::isValid(elem))
+		{
+			++expNumFilled;
+		}
+	}
+	dat::grid<ElemType> fillGrid(srcGrid);
+	size_t const gotNumFilled{ img::dilate::floodFill(&fillGrid) };
+	if (! ((expNumFilled == gotNumFilled) && sameValues(fillGrid, expGrid)))
+	{
+		oss << "Failure of in place fill test" << std::endl;
+		oss << dat::infoString(expNumFilled, "expNumFilled") << std::endl;
+		oss << dat::infoString(gotNumFilled, "gotNumFilled") << std::endl;
+	}
+
+	return oss.str();
+}
 
 }
 
@@ -174,6 +272,7 @@ main
 	// run tests
 	oss << img_dilate_test0();
 	oss << img_dilate_test1();
+	oss << img_dilate_test2();
 
 	// check/report results
 	std::string const errMessages(oss.str());
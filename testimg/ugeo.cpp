@@ -38,9 +38,11 @@
 #include "libimg/io.h"
 #include "libio/stream.h"
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 
 namespace
@@ -301,6 +303,122 @@ img_geo_test2
 	return oss.str();
 }
 
+	//! True if grids are same size with same values
+	template <typename PixType>
+	bool
+	sameGrids
+		( dat::grid<PixType> const & gridA
+		, dat::grid<PixType> const & gridB
+		)
+	{
+		return
+			(  (gridA.hwSize() == gridB.hwSize())
+			&& std::equal(gridA.begin(), gridA.end(), gridB.begin())
+			);
+	}
+
+//! Check batch crops, clipped insertion and concurrent montage
+std::string
+img_geo_test3
+	()
+{
+	std::ostringstream oss;
+
+	// source with unique values
+	dat::grid<uint16_t> srcGrid(40u, 50u);
+	for (size_t nn{0u} ; nn < srcGrid.size() ; ++nn)
+	{
+		srcGrid.begin()[nn] = static_cast<uint16_t>(nn);
+	}
+
+	// extract many chips from one source in a single (concurrent) call
+	std::vector<dat::SubExtents> const cropSubs
+		{ dat::SubExtents(dat::RowCol{{  0u,  0u }}, dat::Extents( 5u,  7u))
+		, dat::SubExtents(dat::RowCol{{ 10u, 20u }}, dat::Extents(30u, 30u))
+		, dat::SubExtents(dat::RowCol{{ 33u, 41u }}, dat::Extents( 7u,  9u))
+		};
+	std::vector<dat::grid<float> > chips; // reused for each call
+	bool const okay
+		{ img::geo::croppedGridsInto<float>(&chips, srcGrid, cropSubs, 3u) };
+
+	bool sameCrops{ okay && (cropSubs.size() == chips.size()) };
+	for (size_t nn{0u} ; sameCrops && (nn < cropSubs.size()) ; ++nn)
+	{
+		dat::grid<float> const expChip
+			{ img::geo::croppedGrid<float>(srcGrid, cropSubs[nn]) };
+		sameCrops = sameGrids(chips[nn], expChip);
+		if (sameCrops)
+		{
+			dat::RowCol const & ul = cropSubs[nn].theUL;
+			sameCrops = (chips[nn](0u, 0u) == float(srcGrid(ul[0], ul[1])));
+		}
+	}
+	float const * const ptChip0{ chips[0].begin() };
+	img::geo::croppedGridsInto<float>(&chips, srcGrid, cropSubs, 1u);
+	if (! (sameCrops && (ptChip0 == chips[0].begin())))
+	{
+		oss << "Failure of batch crop test" << std::endl;
+	}
+
+	// insertion which extends past output edges is clipped
+	dat::grid<uint16_t> outGrid(12u, 15u, 7u);
+	dat::SubExtents const fillSub(dat::RowCol{{ 8u, 10u }}, srcGrid.hwSize());
+	img::geo::insertSubGrid(&outGrid, fillSub, srcGrid);
+	size_t errCount{ 0u };
+	for (size_t row{0u} ; row < outGrid.high() ; ++row)
+	{
+		for (size_t col{0u} ; col < outGrid.wide() ; ++col)
+		{
+			uint16_t expPix{ 7u };
+			if ((! (row < 8u)) && (! (col < 10u)))
+			{
+				expPix = srcGrid(row - 8u, col - 10u);
+			}
+			if (! (expPix == outGrid(row, col)))
+			{
+				++errCount;
+			}
+		}
+	}
+	if (0u < errCount)
+	{
+		oss << "Failure of clipped insertSubGrid test" << std::endl;
+		oss << dat::infoString(errCount, "errCount") << std::endl;
+	}
+
+	// montage content is independent of number of jobs
+	std::vector<dat::grid<uint16_t> > const tiles
+		(img::geo::croppedGrids<uint16_t>(srcGrid, cropSubs));
+	constexpr size_t numPerRow{ 2u };
+	constexpr size_t pad{ 1u };
+	constexpr uint16_t backVal{ 0u };
+	constexpr uint16_t foreVal{ 0u };
+	dat::grid<uint16_t> const montage1
+		{ img::geo::montageOf
+			( tiles.begin(), tiles.end()
+			, numPerRow, backVal, pad, foreVal, 1u
+			)
+		};
+	dat::grid<uint16_t> const montage3
+		{ img::geo::montageOf
+			( tiles.begin(), tiles.end()
+			, numPerRow, backVal, pad, foreVal, 3u
+			)
+		};
+	// last tile is in second row (of 30+2 high) and first column
+	bool const okayTile
+		{ (montage1.isValid())
+		&& (montage1(32u + pad, pad) == tiles[2](0u, 0u))
+		&& (montage1(32u + pad + 6u, pad + 8u) == tiles[2](6u, 8u))
+		};
+	if (! (okayTile && sameGrids(montage1, montage3)))
+	{
+		oss << "Failure of concurrent montage test" << std::endl;
+	}
+
+	return oss.str();
+}
+
 
 }
 
@@ -317,6 +435,7 @@ main
 	oss << img_geo_test0();
 	oss << img_geo_test1();
 	oss << img_geo_test2();
+	oss << img_geo_test3();
 
 	// check/report results
 	std::string const errMessages(oss.str());
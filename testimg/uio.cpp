@@ -33,15 +33,20 @@
 
 #include "libimg/io.h"
 
+#include "libdat/f16.h"
 #include "libdat/info.h"
 #include "libdat/validity.h"
 #include "libio/stream.h"
+#include "libsys/job.h"
 
 #include "teststb/testfunc.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 
 namespace
@@ -218,6 +223,148 @@ img_io_test2
 	return oss.str();
 }
 
+//! Check concurrent decoding from memory
+std::string
+img_io_test3
+	()
+{
+	std::ostringstream oss;
+
+	using PixRGB = stb::testfunc::PixRGB;
+
+	// simulate a few images of different content
+	constexpr size_t numImages{ 6u };
+	std::vector<dat::grid<PixRGB> > expGrids;
+	std::vector<std::vector<uint8_t> > encodeds;
+	for (size_t nn{0u} ; nn < numImages ; ++nn)
+	{
+		size_t const high{ 64u + 8u * nn };
+		size_t const wide{ 48u + 4u * (nn % 2u) };
+		dat::grid<PixRGB> const grid{ stb::testfunc::simRGB(high, wide) };
+		std::string const fpath{ "uio_seq.png" };
+		if (img::io::savePng(grid, fpath))
+		{
+			expGrids.emplace_back(grid);
+			encodeds.emplace_back(img::io::fileBytes(fpath));
+		}
+		std::remove(fpath.c_str());
+	}
+	if (! (numImages == encodeds.size()))
+	{
+		oss << "Failure of test image setup" << std::endl;
+		return oss.str();
+	}
+
+	// ExampleStart
+	// decode concurrently - each job reuses its own grid storage
+	std::vector<dat::grid<PixRGB> > gotGrids(numImages);
+	std::vector<size_t> okays(numImages, 0u);
+	sys::job::processRanges
+		( numImages
+		, [&encodeds, &gotGrids, &okays]
+			( size_t const & beg
+			, size_t const & end
+			)
+			{
+				dat::grid<PixRGB> work;
+				for (size_t nn{beg} ; nn < end ; ++nn)
+				{
+					if (img::io::decodeRgb8Into(&work, encodeds[nn]))
+					{
+						gotGrids[nn] = work;
+						okays[nn] = 1u;
+					}
+				}
+			}
+		, 3u
+		);
+	// ExampleEnd
+
+	for (size_t nn{0u} ; nn < numImages ; ++nn)
+	{
+		if (! (1u == okays[nn]))
+		{
+			oss << "Failure of concurrent decode test: nn = " << nn
+				<< std::endl;
+			continue;
+		}
+		std::ostringstream tmp;
+		stb::testfunc::checkGrids
+			(tmp, expGrids[nn], gotGrids[nn], "png seq pix dif", 0u);
+		oss << tmp.str();
+	}
+
+	// gray decode from same (rgb) content is rejected: deep is 3
+	dat::grid<uint8_t> gray;
+	if (img::io::decodeGray8Into(&gray, encodeds[0]) || gray.isValid())
+	{
+		oss << "Failure of gray from rgb rejection test" << std::endl;
+	}
+
+	// invalid content
+	dat::grid<PixRGB> bad;
+	std::vector<uint8_t> const junk(100u, 7u);
+	if (img::io::decodeRgb8Into(&bad, junk) || bad.isValid())
+	{
+		oss << "Failure of junk data test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+//! Check half precision save/load
+std::string
+img_io_test4
+	()
+{
+	std::ostringstream oss;
+
+	// distinct values (exactly representable) in each cell
+	dat::grid<float> floatGrid(7u, 11u);
+	for (size_t row{0u} ; row < floatGrid.high() ; ++row)
+	{
+		for (size_t col{0u} ; col < floatGrid.wide() ; ++col)
+		{
+			floatGrid(row, col) = .125f * float(16u * row + col) - 3.f;
+		}
+	}
+	dat::grid<dat::f16_t> const expGrid(dat::f16::halfGridFor(floatGrid));
+
+	std::string const fpath{ "uio_half.dat" };
+	bool const okaySave{ img::io::saveToHalf(expGrid, fpath) };
+	dat::grid<dat::f16_t> const gotGrid(img::io::loadFromHalf(fpath));
+
+	// files without type tag are distinguished by their (data) size
+	std::string const floatPath{ "uio_float.dat" };
+	bool const okayFloat{ img::io::saveToFloat(floatGrid, floatPath) };
+	if (! okayFloat)
+	{
+		oss << "Failure of float save test" << std::endl;
+	}
+	if (img::io::loadFromFloat(fpath).isValid())
+	{
+		oss << "Failure of half file as float test" << std::endl;
+	}
+	if (img::io::loadFromHalf(floatPath).isValid())
+	{
+		oss << "Failure of float file as half test" << std::endl;
+	}
+	std::remove(fpath.c_str());
+	std::remove(floatPath.c_str());
+
+	if (! (okaySave && (gotGrid.hwSize() == expGrid.hwSize())))
+	{
+		oss << "Failure of half save/load size test" << std::endl;
+	}
+	else
+	if (! std::equal(gotGrid.begin(), gotGrid.end(), expGrid.begin()))
+	{
+		oss << "Failure of half save/load value test" << std::endl;
+	}
+
+	return oss.str();
+}
+
 
 }
 
@@ -234,6 +381,8 @@ main
 	oss << img_io_test0();
 	oss << img_io_test1();
 	oss << img_io_test2();
+	oss << img_io_test3();
+	oss << img_io_test4();
 
 	// check/report results
 	std::string const errMessages(oss.str());
@@ -0,0 +1,262 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for img::pnm
+*/
+
+
+#include "libimg/pnm.h"
+
+#include "libimg/io.h"
+#include "libio/stream.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+//! Grid with values covering (most of) the sample range
+template <typename PixType, typename Func>
+dat::grid<PixType>
+simGrid
+	( dat::Extents const & hwSize
+	, Func const & func
+	)
+{
+	dat::grid<PixType> grid(hwSize);
+	for (size_t nn{0u} ; nn < grid.size() ; ++nn)
+	{
+		grid.begin()[nn] = func(nn);
+	}
+	return grid;
+}
+
+//! True if same size and values
+template <typename PixType>
+bool
+sameGrids
+	( dat::grid<PixType> const & gridA
+	, dat::grid<PixType> const & gridB
+	)
+{
+	return
+		(  gridA.isValid()
+		&& (gridA.hwSize() == gridB.hwSize())
+		&& std::equal(gridA.begin(), gridA.end(), gridB.begin())
+		);
+}
+
+//! Check round trip for each pixel type
+std::string
+img_pnm_test0
+	()
+{
+	std::ostringstream oss;
+
+	dat::Extents const hwSize(17u, 23u);
+	using Rgb8 = std::array<uint8_t, 3u>;
+	using Rgb16 = std::array<uint16_t, 3u>;
+	dat::grid<uint8_t> const expG8
+		{ simGrid<uint8_t>
+			(hwSize, [] (size_t const & nn) { return uint8_t(nn % 256u); })
+		};
+	dat::grid<uint16_t> const expG16
+		{ simGrid<uint16_t>
+			(hwSize, [] (size_t const & nn) { return uint16_t(nn * 167u); })
+		};
+	dat::grid<Rgb8> const expC8
+		{ simGrid<Rgb8>
+			( hwSize
+			, [] (size_t const & nn)
+				{
+					return Rgb8
+						{{ uint8_t(nn), uint8_t(3u*nn), uint8_t(7u*nn) }};
+				}
+			)
+		};
+	dat::grid<Rgb16> const expC16
+		{ simGrid<Rgb16>
+			( hwSize
+			, [] (size_t const & nn)
+				{
+					return Rgb16
+						{{ uint16_t(nn), uint16_t(301u*nn), uint16_t(~nn) }};
+				}
+			)
+		};
+
+	std::string const fpath("upnm_test0.pnm");
+
+	// ExampleStart
+	// save and load e.g. 16-bit color directly from/to pixel grids
+	bool const okay{ img::pnm::save(expC16, fpath) };
+	dat::grid<std::array<uint16_t, 3u> > const gotC16
+		(img::pnm::loadRgb16(fpath));
+	// ExampleEnd
+
+	if (! (okay && sameGrids(gotC16, expC16)))
+	{
+		oss << "Failure of rgb16 round trip test" << std::endl;
+	}
+	// content has wrong format for other types
+	if ( img::pnm::loadGray8(fpath).isValid()
+	  || img::pnm::loadGray16(fpath).isValid()
+	  || img::pnm::loadRgb8(fpath).isValid()
+	   )
+	{
+		oss << "Failure of format mismatch test" << std::endl;
+	}
+
+	if (! (img::pnm::save(expC8, fpath)
+		&& sameGrids(img::pnm::loadRgb8(fpath), expC8)))
+	{
+		oss << "Failure of rgb8 round trip test" << std::endl;
+	}
+	if (! (img::pnm::save(expG16, fpath)
+		&& sameGrids(img::pnm::loadGray16(fpath), expG16)))
+	{
+		oss << "Failure of gray16 round trip test" << std::endl;
+	}
+	if (! (img::pnm::save(expG8, fpath)
+		&& sameGrids(img::pnm::loadGray8(fpath), expG8)))
+	{
+		oss << "Failure of gray8 round trip test" << std::endl;
+	}
+
+	// existing interface uses same format
+	if (! (img::io::savePgm(expG8, fpath)
+		&& sameGrids(img::io::loadFromPgm8(fpath), expG8)))
+	{
+		oss << "Failure of io::loadFromPgm8 test" << std::endl;
+	}
+
+	std::remove(fpath.c_str());
+	return oss.str();
+}
+
+//! Check header parsing
+std::string
+img_pnm_test1
+	()
+{
+	std::ostringstream oss;
+
+	// comments, and arbitrary whitespace, big-endian 16-bit samples
+	char const raw[]
+		{ "P5 # comment 123\n\t3   # another\n2\r\n1023\n"
+		  "\x00\x01" "\x00\x02" "\x03\xff"
+		  "\x01\x00" "\x02\x00" "\x00\x00"
+		};
+	std::string const text(raw, sizeof(raw) - 1u); // includes nulls
+	std::string const fpath("upnm_test1.pgm");
+	{
+		std::ofstream ofs(fpath, std::ios::binary);
+		ofs.write(text.data(), static_cast<std::streamsize>(text.size()));
+	}
+
+	img::pnm::Header const header(img::pnm::headerFor(fpath));
+	if (! ( header.isValid()
+		 && (1u == header.theNumChan)
+		 && (3u == header.theWide)
+		 && (2u == header.theHigh)
+		 && (1023u == header.theMaxVal)
+		 && ((text.size() - 12u) == header.theDataOffset)
+		  ))
+	{
+		oss << "Failure of header parse test" << std::endl;
+		oss << header.infoString("header") << std::endl;
+	}
+
+	std::vector<uint16_t> const expValues{ 1u, 2u, 1023u, 256u, 512u, 0u };
+	dat::grid<uint16_t> const grid(img::pnm::loadGray16(fpath));
+	if (! ( (dat::Extents(2u, 3u) == grid.hwSize())
+		 && std::equal(grid.begin(), grid.end(), expValues.begin())
+		  ))
+	{
+		oss << "Failure of 16-bit sample value test" << std::endl;
+	}
+
+	// truncated data
+	{
+		std::ofstream ofs(fpath, std::ios::binary);
+		ofs.write(text.data(), static_cast<std::streamsize>(text.size() - 1u));
+	}
+	if (img::pnm::loadGray16(fpath).isValid())
+	{
+		oss << "Failure of truncated file test" << std::endl;
+	}
+	std::remove(fpath.c_str());
+
+	// bad headers
+	for (std::string const bad : { "P4 3 2 255\n", "P53 2 255\n", "P5 3 x 255\n"
+		, "P5 3 2\n", "P6 3 2 65536\n", "" })
+	{
+		uint8_t const * const beg
+			{ reinterpret_cast<uint8_t const *>(bad.data()) };
+		if (img::pnm::Header::from(beg, beg + bad.size()).isValid())
+		{
+			oss << "Failure of bad header test: '" << bad << "'" << std::endl;
+		}
+	}
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for img::pnm
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << img_pnm_test0();
+	oss << img_pnm_test1();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
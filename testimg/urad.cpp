@@ -165,6 +165,57 @@ img_rad_test1
 }
 
 
+//! Check equalization of float grid against per-pixel remapping
+std::string
+img_rad_test2
+	()
+{
+	std::ostringstream oss;
+
+	// populate image with samples from a "triangle" pdf
+	dat::Range<double> const dataRange{ 100., 4100. };
+	constexpr dat::Extents const hwSize{ 123u, 97u };
+	prob::SampleGen const generator
+		( prob::CdfInverse::generateFor
+			(prob::distro::unitTriangle, dataRange, 1024u)
+		);
+	std::vector<double> const samps(generator.samples(hwSize.size()));
+	dat::grid<float> srcImage(hwSize);
+	std::copy(samps.begin(), samps.end(), srcImage.begin());
+
+	// equalize with several jobs
+	math::Partition const part(dataRange, 100u);
+	constexpr size_t numJobs{ 3u };
+	dat::grid<float> const gotImage
+		(img::rad::equalized(srcImage, part, numJobs));
+
+	// compare with direct (per pixel) remapping
+	std::vector<float> const actSamps
+		( img::sample::activeValuesFrom<float>
+			(srcImage.begin(), srcImage.end())
+		);
+	std::vector<size_t> const hist
+		(prob::histo::countsFromSamps(actSamps, part));
+	prob::Remapper const rem
+		( prob::CdfForward::fromFreqs(hist.begin(), hist.end(), part.range())
+		, prob::CdfInverse::uniform(part.range())
+		);
+	dat::grid<float> expImage(hwSize);
+	std::transform(srcImage.begin(), srcImage.end(), expImage.begin(), rem);
+
+	double const tol{ 1.e-4 * dataRange.magnitude() };
+	if (! dat::nearlyEquals
+		( gotImage.begin(), gotImage.end()
+		, expImage.begin(), expImage.end()
+		, tol
+		))
+	{
+		oss << "Failure of float grid equalization test" << std::endl;
+	}
+
+	return oss.str();
+}
+
 }
 
 //! Unit test for img::rad
@@ -179,6 +230,7 @@ main
 	// run tests
 	oss << img_rad_test0();
 	oss << img_rad_test1();
+	oss << img_rad_test2();
 
 	// check/report results
 	std::string const errMessages(oss.str());
@@ -0,0 +1,395 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for img::tiled
+*/
+
+
+#include "libimg/tiled.h"
+
+#include "libio/stream.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+//! Grid with distinct (and not very compressible) values
+template <typename PixType>
+dat::grid<PixType>
+simGrid
+	( dat::Extents const & hwSize
+	)
+{
+	dat::grid<PixType> grid(hwSize);
+	size_t value{ 0u };
+	for (PixType & pix : grid)
+	{
+		value = (value * 1103515245u + 12345u) % 2147483648u;
+		pix = static_cast<PixType>(float(value % 4096u) / 8.f);
+	}
+	return grid;
+}
+
+//! True if grids are same size and content (bitwise)
+template <typename PixType>
+bool
+sameGrids
+	( dat::grid<PixType> const & gridA
+	, dat::grid<PixType> const & gridB
+	)
+{
+	return
+		(  gridA.isValid()
+		&& (gridA.hwSize() == gridB.hwSize())
+		&& std::equal
+			( reinterpret_cast<uint8_t const *>(gridA.begin())
+			, reinterpret_cast<uint8_t const *>(gridA.end())
+			, reinterpret_cast<uint8_t const *>(gridB.begin())
+			)
+		);
+}
+
+//! Values from grid within crop
+template <typename PixType>
+dat::grid<PixType>
+cropOf
+	( dat::grid<PixType> const & full
+	, dat::SubExtents const & crop
+	)
+{
+	dat::grid<PixType> sub(crop.theSize);
+	for (size_t row{0u} ; row < sub.high() ; ++row)
+	{
+		for (size_t col{0u} ; col < sub.wide() ; ++col)
+		{
+			sub(row, col) = full(crop.fullRowColFor(dat::RowCol{{ row, col }}));
+		}
+	}
+	return sub;
+}
+
+//! Check save/read round trip (full and regions) for PixType
+template <typename PixType>
+void
+checkRoundTrip
+	( std::ostream & oss
+	, bool const & compress
+	, bool const & useMmap
+	, std::string const & tname
+	)
+{
+	dat::Extents const hwSize(101u, 150u);
+	dat::Extents const hwTile(32u, 48u);
+	dat::grid<PixType> const expGrid(simGrid<PixType>(hwSize));
+
+	std::string const fpath("utiled_" + tname + ".tile");
+	constexpr size_t numJobs{ 3u };
+	if (! img::tiled::save(expGrid, fpath, compress, hwTile, numJobs))
+	{
+		oss << "Failure of save test: " << tname << std::endl;
+		return;
+	}
+
+	img::tiled::Reader const reader(fpath, useMmap);
+	if (! reader.isValid())
+	{
+		oss << "Failure of reader validity test: " << tname << std::endl;
+		return;
+	}
+	bool const expMapped{ (! compress) && useMmap };
+	if (! (expMapped == reader.isMapped()))
+	{
+		oss << "Failure of isMapped test: " << tname << std::endl;
+	}
+	img::tiled::Layout const & layout = reader.layout();
+	if (! ((16u == layout.numTiles()) && (compress == layout.theIsCompressed)))
+	{
+		oss << "Failure of layout test: " << tname << std::endl;
+		oss << layout.infoString("layout") << std::endl;
+	}
+
+	// full image
+	dat::grid<PixType> const gotGrid(reader.readAll<PixType>(numJobs));
+	if (! sameGrids(gotGrid, expGrid))
+	{
+		oss << "Failure of full read test: " << tname << std::endl;
+	}
+
+	// various regions, including edge tiles and single tile interiors
+	std::vector<dat::SubExtents> const crops
+		{ dat::SubExtents(dat::RowCol{{ 0u, 0u }}, dat::Extents(1u, 1u))
+		, dat::SubExtents(dat::RowCol{{ 5u, 7u }}, dat::Extents(20u, 30u))
+		, dat::SubExtents(dat::RowCol{{ 31u, 47u }}, dat::Extents(2u, 2u))
+		, dat::SubExtents(dat::RowCol{{ 17u, 3u }}, dat::Extents(80u, 140u))
+		, dat::SubExtents(dat::RowCol{{ 96u, 144u }}, dat::Extents(5u, 6u))
+		};
+	for (dat::SubExtents const & crop : crops)
+	{
+		dat::grid<PixType> const gotCrop
+			(reader.readRegion<PixType>(crop, numJobs));
+		if (! sameGrids(gotCrop, cropOf(expGrid, crop)))
+		{
+			oss << "Failure of region read test: " << tname << std::endl;
+			oss << crop.infoString("crop") << std::endl;
+		}
+	}
+
+	// region outside of image
+	dat::SubExtents const badCrop
+		(dat::RowCol{{ 90u, 140u }}, dat::Extents(20u, 20u));
+	if (reader.readRegion<PixType>(badCrop).isValid())
+	{
+		oss << "Failure of outside region test: " << tname << std::endl;
+	}
+
+	std::remove(fpath.c_str());
+}
+
+//! Check round trip for all pixel types and storage options
+std::string
+img_tiled_test0
+	()
+{
+	std::ostringstream oss;
+
+	for (bool const compress : { false, true })
+	{
+		for (bool const useMmap : { true, false })
+		{
+			std::string const tag
+				{ (compress ? "zip" : "raw") + std::string(useMmap ? "M" : "")
+				};
+			checkRoundTrip<uint8_t>(oss, compress, useMmap, "u8" + tag);
+			checkRoundTrip<uint16_t>(oss, compress, useMmap, "u16" + tag);
+			checkRoundTrip<dat::f16_t>(oss, compress, useMmap, "f16" + tag);
+			checkRoundTrip<float>(oss, compress, useMmap, "f32" + tag);
+		}
+	}
+
+	return oss.str();
+}
+
+//! Check layout geometry and example use
+std::string
+img_tiled_test1
+	()
+{
+	std::ostringstream oss;
+
+	img::tiled::Layout const layout
+		( dat::Extents(100u, 200u)
+		, dat::Extents(64u, 64u)
+		, img::tiled::PixCode::F32
+		, false
+		);
+	if (! (dat::Extents(2u, 4u) == layout.hwTileCounts()))
+	{
+		oss << "Failure of hwTileCounts test" << std::endl;
+	}
+	dat::SubExtents const expLast
+		(dat::RowCol{{ 64u, 192u }}, dat::Extents(36u, 8u));
+	if (! layout.tileArea(7u).nearlyEquals(expLast))
+	{
+		oss << "Failure of edge tileArea test" << std::endl;
+	}
+	std::vector<size_t> const expNdxs{ 1u, 2u, 5u, 6u };
+	std::vector<size_t> const gotNdxs
+		{ layout.tilesFor
+			(dat::SubExtents(dat::RowCol{{ 63u, 64u }}, dat::Extents(2u, 65u)))
+		};
+	if (! (expNdxs == gotNdxs))
+	{
+		oss << "Failure of tilesFor test" << std::endl;
+	}
+
+	dat::grid<float> const bigGrid(simGrid<float>(dat::Extents(600u, 700u)));
+	std::string const fpath("utiled_example.tile");
+
+	// ExampleStart
+	// save grid as tiles (here compressed and with default 256x256 tiles)
+	bool const okay{ img::tiled::save(bigGrid, fpath, true) };
+
+	// read a small area - only the overlapping tiles are accessed
+	img::tiled::Reader const reader(fpath);
+	dat::SubExtents const crop
+		(dat::RowCol{{ 250u, 500u }}, dat::Extents(20u, 30u));
+	dat::grid<float> const gotCrop(reader.readRegion<float>(crop));
+	// ExampleEnd
+
+	if (! (okay && sameGrids(gotCrop, cropOf(bigGrid, crop))))
+	{
+		oss << "Failure of example test" << std::endl;
+		oss << reader.infoString("reader") << std::endl;
+	}
+	if (reader.readRegion<uint16_t>(crop).isValid())
+	{
+		oss << "Failure of pixel type mismatch test" << std::endl;
+	}
+	std::remove(fpath.c_str());
+
+	img::tiled::Reader const aNull("utiled_noSuchFile.tile");
+	if (aNull.isValid())
+	{
+		oss << "Failure of null reader test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+//! File content as bytes
+std::vector<char>
+fileBytes
+	( std::string const & fpath
+	)
+{
+	std::ifstream ifs(fpath, std::ios::binary);
+	return std::vector<char>
+		( (std::istreambuf_iterator<char>(ifs))
+		, std::istreambuf_iterator<char>()
+		);
+}
+
+//! Write bytes to file
+void
+saveBytes
+	( std::vector<char> const & bytes
+	, std::string const & fpath
+	)
+{
+	std::ofstream ofs(fpath, std::ios::binary);
+	ofs.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+//! Set (little endian) 64-bit value at byte offset
+void
+setU64
+	( std::vector<char> * const & ptBytes
+	, size_t const & offset
+	, uint64_t const & value
+	)
+{
+	std::memcpy(ptBytes->data() + offset, &value, sizeof(value));
+}
+
+//! Check that tile index entries are validated against file
+std::string
+img_tiled_test2
+	()
+{
+	std::ostringstream oss;
+
+	dat::grid<uint16_t> const grid(simGrid<uint16_t>(dat::Extents(40u, 50u)));
+	std::string const fpath("utiled_index.tile");
+	std::string const badPath("utiled_indexBad.tile");
+
+	// header (8+4*8+2*4 bytes) is followed by (offset, numBytes) entries
+	constexpr size_t ndxBeg{ 48u };
+	constexpr size_t lastEntry{ ndxBeg + 3u * 16u }; // 2x2 tiles
+	for (bool const compress : { false, true })
+	{
+		if (! img::tiled::save(grid, fpath, compress, dat::Extents(32u, 32u)))
+		{
+			oss << "Failure of index save test" << std::endl;
+			continue;
+		}
+		std::vector<char> const good(fileBytes(fpath));
+		uint64_t const fileSize{ good.size() };
+
+		// corrupt copies of file
+		std::vector<std::vector<char> > bads(5u, good);
+		setU64(&bads[0], lastEntry, fileSize); // start past data
+		setU64(&bads[1], lastEntry, 0u); // start within header
+		setU64(&bads[2], lastEntry + 8u, fileSize); // too many bytes
+		setU64(&bads[3], lastEntry + 8u, ~uint64_t{0u}); // wraps offset
+		bads[4].pop_back(); // truncated last tile
+
+		for (bool const useMmap : { false, true })
+		{
+			img::tiled::Reader const reader(fpath, useMmap);
+			if (! sameGrids(reader.readAll<uint16_t>(), grid))
+			{
+				oss << "Failure of index good file test" << std::endl;
+			}
+			for (size_t nn{0u} ; nn < bads.size() ; ++nn)
+			{
+				saveBytes(bads[nn], badPath);
+				img::tiled::Reader const badReader(badPath, useMmap);
+				if (badReader.isValid())
+				{
+					oss << "Failure of bad index entry test"
+						<< " compress: " << compress
+						<< " useMmap: " << useMmap
+						<< " case: " << nn
+						<< std::endl;
+				}
+			}
+		}
+	}
+	std::remove(fpath.c_str());
+	std::remove(badPath.c_str());
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for img::tiled
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << img_tiled_test0();
+	oss << img_tiled_test1();
+	oss << img_tiled_test2();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -40,6 +40,8 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 
 namespace
@@ -87,10 +89,166 @@ io_Log_test1
 		oss << "Failure of log message test" << std::endl;
 	}
 
+	io::log::removeSink(ptSink);
 	return oss.str();
 }
 
 
+//! Check background delivery from several threads
+std::string
+io_Log_test2
+	()
+{
+	std::ostringstream oss;
+
+	std::ostringstream sink;
+	std::ostream * const ptSink = &sink;
+	io::log::addSink(ptSink, false);
+
+	// use a small ring to exercise producer wait on full ring
+	io::async::start(16u);
+	if (! io::async::isActive())
+	{
+		oss << "Failure of async start test" << std::endl;
+	}
+
+	constexpr size_t numThreads{ 4u };
+	constexpr size_t numPerThread{ 250u };
+	std::string const expBody("abcdefghijklmnopqrstuvwxyz");
+	std::vector<std::thread> threads;
+	for (size_t nt{0u} ; nt < numThreads ; ++nt)
+	{
+		threads.emplace_back
+			( std::thread
+				( [&expBody] ()
+					{
+						for (size_t nn{0u} ; nn < numPerThread ; ++nn)
+						{
+							io::log() << "<" << expBody << ">" << '\n';
+						}
+					}
+				)
+			);
+	}
+	for (std::thread & thread : threads)
+	{
+		thread.join();
+	}
+	io::async::flush();
+
+	// every message should be present and intact
+	std::istringstream iss(sink.str());
+	std::string line;
+	size_t numGood{ 0u };
+	size_t numBad{ 0u };
+	std::string const expTail("<" + expBody + ">");
+	while (std::getline(iss, line))
+	{
+		if (io::string::contains(line, expTail))
+		{
+			++numGood;
+		}
+		else
+		{
+			++numBad;
+		}
+	}
+	size_t const expGood{ numThreads * numPerThread };
+	if (! ((expGood == numGood) && (0u == numBad)))
+	{
+		oss << "Failure of async message count test" << std::endl;
+		oss << "expGood: " << expGood << std::endl;
+		oss << "numGood: " << numGood << std::endl;
+		oss << " numBad: " << numBad << std::endl;
+	}
+
+	// direct delivery after stop
+	io::async::stop();
+	if (io::async::isActive())
+	{
+		oss << "Failure of async stop test" << std::endl;
+	}
+	std::string const expLast("last message");
+	io::log() << expLast << std::endl;
+	if (! io::string::contains(sink.str(), expLast))
+	{
+		oss << "Failure of post-async message test" << std::endl;
+	}
+
+	io::log::removeSink(ptSink);
+	return oss.str();
+}
+
+
+//! Check restart of background writer while producers are active
+std::string
+io_Log_test3
+	()
+{
+	std::ostringstream oss;
+
+	std::ostringstream sink;
+	std::ostream * const ptSink = &sink;
+	io::log::addSink(ptSink, false);
+
+	// producers run across several stop/start cycles
+	constexpr size_t numThreads{ 3u };
+	constexpr size_t numPerThread{ 400u };
+	std::vector<std::thread> threads;
+	for (size_t nt{0u} ; nt < numThreads ; ++nt)
+	{
+		threads.emplace_back
+			( std::thread
+				( [] ()
+					{
+						for (size_t nn{0u} ; nn < numPerThread ; ++nn)
+						{
+							io::log() << "<restart>" << '\n';
+							if (0u == (nn % 64u))
+							{
+								std::this_thread::yield();
+							}
+						}
+					}
+				)
+			);
+	}
+	constexpr size_t numCycles{ 20u };
+	for (size_t nc{0u} ; nc < numCycles ; ++nc)
+	{
+		io::async::start(8u);
+		io::log() << "<restart>" << '\n';
+		io::async::flush(); // waits on writer wakeup (no polling)
+		io::async::stop();
+	}
+	for (std::thread & thread : threads)
+	{
+		thread.join();
+	}
+
+	// every message should have arrived (directly or via a writer)
+	std::istringstream iss(sink.str());
+	std::string line;
+	size_t numGood{ 0u };
+	while (std::getline(iss, line))
+	{
+		if (io::string::contains(line, "<restart>"))
+		{
+			++numGood;
+		}
+	}
+	size_t const expGood{ numThreads * numPerThread + numCycles };
+	if (! (expGood == numGood))
+	{
+		oss << "Failure of async restart message count test" << std::endl;
+		oss << "expGood: " << expGood << std::endl;
+		oss << "numGood: " << numGood << std::endl;
+	}
+
+	io::log::removeSink(ptSink);
+	return oss.str();
+}
+
 }
 
 //! Unit test for io::Log
@@ -105,6 +263,8 @@ main
 	// run tests
 	oss << io_Log_test0();
 	oss << io_Log_test1();
+	oss << io_Log_test2();
+	oss << io_Log_test3();
 
 	// check/report results
 	std::string const errMessages(oss.str());
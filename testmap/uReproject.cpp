@@ -0,0 +1,350 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for map::Reproject
+*/
+
+
+#include "libmap/Reproject.h"
+
+#include "libdat/info.h"
+#include "libdat/validity.h"
+#include "libio/stream.h"
+#include "libmap/ProjHighAzim.h"
+#include "libmap/ProjSinu.h"
+#include "libmap/ProjZenAzim.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+//! Check for common functions
+std::string
+map_Reproject_test0
+	()
+{
+	std::ostringstream oss;
+	map::Reproject const aNull;
+	if (dat::isValid(aNull))
+	{
+		oss << "Failure of null value test" << std::endl;
+		oss << "infoString: " << dat::infoString(aNull) << std::endl;
+	}
+	return oss.str();
+}
+
+//! A (smooth) property which varies with direction
+float
+valueFor
+	( ga::Vector const & dir
+	)
+{
+	return static_cast<float>(dir[2] + .25 * dir[0] * dir[1]);
+}
+
+//! Check resampling between projections
+std::string
+map_Reproject_test1
+	()
+{
+	std::ostringstream oss;
+
+	map::ProjSinu const srcProj(dat::Extents{ 180u, 360u });
+	map::ProjZenAzim const dstProj(dat::Extents{ 45u, 90u });
+
+	// generate a source image
+	dat::grid<float> srcGrid(srcProj.hwSize());
+	for (size_t row{0u} ; row < srcGrid.high() ; ++row)
+	{
+		for (size_t col{0u} ; col < srcGrid.wide() ; ++col)
+		{
+			ga::Vector const dir(srcProj.directionFor({{ row, col }}));
+			srcGrid(row, col) = dir.isValid()
+				? valueFor(dir) : dat::nullValue<float>();
+		}
+	}
+
+	// ExampleStart
+
+	// evaluate projection geometry once
+	map::Reproject const reproj(srcProj, dstProj);
+
+	// resample any number of (same size) source images
+	dat::grid<float> const dstGrid{ reproj.bilinear(srcGrid) };
+
+	// ExampleEnd
+
+	// check interpolated values
+	size_t numValid{ 0u };
+	size_t numBad{ 0u };
+	for (size_t row{0u} ; row < dstGrid.high() ; ++row)
+	{
+		for (size_t col{0u} ; col < dstGrid.wide() ; ++col)
+		{
+			float const & gotValue = dstGrid(row, col);
+			if (dat::isValid(gotValue))
+			{
+				++numValid;
+				ga::Vector const dir(dstProj.directionFor({{ row, col }}));
+				float const expValue{ valueFor(dir) };
+				if (! (std::abs(gotValue - expValue) < .05f))
+				{
+					++numBad;
+				}
+			}
+		}
+	}
+	if (! (dstGrid.size() / 2u < numValid))
+	{
+		oss << "Failure of resample valid count test" << std::endl;
+		oss << dat::infoString(numValid, "numValid") << std::endl;
+	}
+	if (! (0u == numBad))
+	{
+		oss << "Failure of resample value test" << std::endl;
+		oss << dat::infoString(numBad, "numBad") << std::endl;
+	}
+
+	// check (partitioned) processing is independent of job count
+	dat::grid<float> const oneGrid{ reproj.bilinear(srcGrid, 1u) };
+	dat::grid<float> const fewGrid{ reproj.bilinear(srcGrid, 3u) };
+	bool const sameJobs
+		{ std::equal
+			( oneGrid.begin(), oneGrid.end(), fewGrid.begin()
+			, [] (float const & valA, float const & valB)
+				{
+					return
+						(  (valA == valB)
+						|| (std::isnan(valA) && std::isnan(valB))
+						);
+				}
+			)
+		};
+	if (! sameJobs)
+	{
+		oss << "Failure of job count consistency test" << std::endl;
+	}
+
+	// nearest neighbor sampling should be valid at same locations
+	dat::grid<float> nearGrid(reproj.dstSize());
+	reproj.nearestInto(&nearGrid, srcGrid);
+	size_t numNear{ 0u };
+	for (float const & value : nearGrid)
+	{
+		if (dat::isValid(value))
+		{
+			++numNear;
+		}
+	}
+	if (! (numValid <= numNear))
+	{
+		oss << "Failure of nearest neighbor test" << std::endl;
+		oss << dat::infoString(numNear, "numNear") << std::endl;
+	}
+
+	return oss.str();
+}
+
+//! Check bilinear resampling from ProjHighAzim source
+std::string
+map_Reproject_test2
+	()
+{
+	std::ostringstream oss;
+
+	map::ProjHighAzim const srcProj(dat::Extents{ 90u, 180u });
+	map::ProjHighAzim const dstProj(dat::Extents{ 33u, 77u });
+
+	// fractional locations should be consistent with directions
+	size_t numBadSpot{ 0u };
+	for (size_t row{0u} ; row < srcProj.hwSize().high() ; row += 7u)
+	{
+		for (size_t col{0u} ; col < srcProj.hwSize().wide() ; col += 11u)
+		{
+			ga::Vector const dir(srcProj.directionFor({{ row, col }}));
+			dat::Spot const spot(srcProj.gridSpotFor(dir));
+			if (! ( (std::abs(spot[0] - double(row)) < 1.e-6)
+			     && (std::abs(spot[1] - double(col)) < 1.e-6)
+			      )
+			   )
+			{
+				++numBadSpot;
+			}
+		}
+	}
+	if (! (0u == numBadSpot))
+	{
+		oss << "Failure of HighAzim spot/direction test" << std::endl;
+		oss << dat::infoString(numBadSpot, "numBadSpot") << std::endl;
+	}
+
+	dat::grid<float> srcGrid(srcProj.hwSize());
+	for (size_t row{0u} ; row < srcGrid.high() ; ++row)
+	{
+		for (size_t col{0u} ; col < srcGrid.wide() ; ++col)
+		{
+			ga::Vector const dir(srcProj.directionFor({{ row, col }}));
+			srcGrid(row, col) = valueFor(dir);
+		}
+	}
+
+	map::Reproject const reproj(srcProj, dstProj);
+	dat::grid<float> const linGrid{ reproj.bilinear(srcGrid) };
+	dat::grid<float> nearGrid(reproj.dstSize());
+	reproj.nearestInto(&nearGrid, srcGrid);
+
+	// bilinear should be (much) closer than nearest neighbor
+	size_t numValid{ 0u };
+	double sumLin{ 0. };
+	double sumNear{ 0. };
+	for (size_t row{0u} ; row < linGrid.high() ; ++row)
+	{
+		for (size_t col{0u} ; col < linGrid.wide() ; ++col)
+		{
+			if (dat::isValid(linGrid(row, col)))
+			{
+				++numValid;
+				ga::Vector const dir(dstProj.directionFor({{ row, col }}));
+				float const expValue{ valueFor(dir) };
+				sumLin += std::abs(linGrid(row, col) - expValue);
+				sumNear += std::abs(nearGrid(row, col) - expValue);
+			}
+		}
+	}
+	if (! ((linGrid.size() / 2u < numValid) && (sumLin < .25 * sumNear)))
+	{
+		oss << "Failure of HighAzim bilinear test" << std::endl;
+		oss << dat::infoString(numValid, "numValid") << std::endl;
+		oss << dat::infoString(sumLin, "sumLin") << std::endl;
+		oss << dat::infoString(sumNear, "sumNear") << std::endl;
+	}
+
+	return oss.str();
+}
+
+//! Check azimuth seam wrap and (nearest) rounding convention
+std::string
+map_Reproject_test3
+	()
+{
+	std::ostringstream oss;
+
+	// source value encodes pixel location
+	map::ProjZenAzim const srcProj(dat::Extents{ 20u, 36u });
+	dat::grid<float> srcGrid(srcProj.hwSize());
+	for (size_t row{0u} ; row < srcGrid.high() ; ++row)
+	{
+		for (size_t col{0u} ; col < srcGrid.wide() ; ++col)
+		{
+			srcGrid(row, col) = static_cast<float>(100u * row + col);
+		}
+	}
+
+	// destination directions at fractional source locations
+	double const daz{ math::twoPi / double(srcProj.hwSize().wide()) };
+	double const dzen{ math::pi / double(srcProj.hwSize().high()) };
+	std::vector<dat::Spot> const srcSpots
+		{ dat::Spot{{ 10., 35.5 }} // across seam
+		, dat::Spot{{ 10., 35.2 }} // across seam (nearest last column)
+		, dat::Spot{{ 2.45, 4.3 }} // rounds down
+		, dat::Spot{{ 2.55, 4.7 }} // rounds up
+		};
+	auto const dirFor
+		= [&srcSpots, &daz, &dzen] (dat::RowCol const & dstRC)
+		{
+			dat::Spot const & spot = srcSpots[dstRC[1]];
+			return geo::sphere::directionFromAZ
+				(math::twoPi - spot[1] * daz, spot[0] * dzen);
+		};
+	map::Reproject const reproj
+		(srcProj, dat::Extents{ 1u, srcSpots.size() }, dirFor);
+	dat::grid<float> const linGrid{ reproj.bilinear(srcGrid) };
+	dat::grid<float> nearGrid(reproj.dstSize());
+	reproj.nearestInto(&nearGrid, srcGrid);
+
+	std::vector<float> const expLins
+		{ 1000.f + .5f * 35.f // halfway between column 35 and 0
+		, 1000.f + .8f * 35.f
+		, 245.f + 4.3f
+		, 255.f + 4.7f
+		};
+	std::vector<float> const expNears{ 1000.f, 1035.f, 204.f, 305.f };
+	for (size_t nn{0u} ; nn < srcSpots.size() ; ++nn)
+	{
+		float const & gotLin = linGrid(0u, nn);
+		float const & gotNear = nearGrid(0u, nn);
+		if (! ( (std::abs(gotLin - expLins[nn]) < .01f)
+		     && (gotNear == expNears[nn])
+		      )
+		   )
+		{
+			oss << "Failure of seam/rounding test: nn = " << nn << std::endl;
+			oss << dat::infoString(expLins[nn], "expLin") << std::endl;
+			oss << dat::infoString(gotLin, "gotLin") << std::endl;
+			oss << dat::infoString(expNears[nn], "expNear") << std::endl;
+			oss << dat::infoString(gotNear, "gotNear") << std::endl;
+		}
+	}
+
+	return oss.str();
+}
+
+}
+
+//! Unit test for map::Reproject
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << map_Reproject_test0();
+	oss << map_Reproject_test1();
+	oss << map_Reproject_test2();
+	oss << map_Reproject_test3();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -44,6 +44,7 @@
 #include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <numeric>
 #include <sstream>
 #include <string>
 
@@ -154,7 +155,6 @@ math_CircleTab_test1b
 			break;
 		}
 
-		/*
 		// check results of interpolation
 		double const gotInterp(fitter.valueAt(angle));
 		if (! dat::nearlyEquals(gotInterp, expValue, expDataQuant))
@@ -164,7 +164,6 @@ math_CircleTab_test1b
 			oss << dat::infoString(gotInterp, "gotInterp") << std::endl;
 			break;
 		}
-		*/
 	}
 
 	return oss.str();
@@ -264,6 +263,102 @@ math_CircleTab_test3
 	return oss.str();
 }
 
+//! Check interpolation, batch queries and smoothing
+std::string
+math_CircleTab_test4
+	()
+{
+	std::ostringstream oss;
+
+	using math::pi;
+	typedef std::pair<double, double> av;
+	std::vector<std::pair<double, double> > const avPairs
+		{ av{ -2., 10. }
+		, av{  0., 20. }
+		, av{  2., 40. }
+		};
+	size_t const numNodes(360u);
+	math::CircleTab<double> const tab(avPairs, numNodes);
+
+	// interpolated values should be exact at nodes and between neighbors
+	double const da(math::twoPi / static_cast<double>(numNodes));
+	std::vector<double> angles;
+	for (size_t nn(0u) ; nn < numNodes ; ++nn)
+	{
+		angles.emplace_back(-pi + static_cast<double>(nn) * da);
+		angles.emplace_back(-pi + (static_cast<double>(nn) + .25) * da);
+	}
+	std::vector<double> const gotNears(tab.nearestTableValues(angles));
+	std::vector<double> const gotInterps(tab.valuesAt(angles));
+	if (! ( (angles.size() == gotNears.size())
+	     && (angles.size() == gotInterps.size())
+	      ))
+	{
+		oss << "Failure of batch size test" << std::endl;
+	}
+	else
+	{
+		for (size_t nn(0u) ; nn < numNodes ; ++nn)
+		{
+			double const & angNode = angles[2u*nn];
+			double const & angQtr = angles[2u*nn + 1u];
+			double const valNode(tab.nearestTableValue(angNode));
+			double const valNext
+				(tab.nearestTableValue(math::principalAngle(angNode + da)));
+			double const expQtr(.75 * valNode + .25 * valNext);
+
+			if (! ( (gotNears[2u*nn] == valNode)
+			     && (gotNears[2u*nn + 1u] == tab.nearestTableValue(angQtr))
+			      ))
+			{
+				oss << "Failure of batch nearest test: nn = " << nn
+					<< std::endl;
+				break;
+			}
+			if (! ( dat::nearlyEquals(gotInterps[2u*nn], valNode)
+			     && dat::nearlyEquals(gotInterps[2u*nn + 1u], expQtr)
+			      ))
+			{
+				oss << "Failure of valuesAt test: nn = " << nn << std::endl;
+				oss << dat::infoString(expQtr, "expQtr") << std::endl;
+				oss << dat::infoString(gotInterps[2u*nn + 1u], "gotQtr")
+					<< std::endl;
+				break;
+			}
+		}
+	}
+
+	// smoothing retains the mean value and reduces the spread
+	math::CircleTab<double> const smooth
+		(math::CircleTab<double>::smoothed(tab, .5));
+	std::vector<double> const origVals(tab.nearestTableValues(angles));
+	std::vector<double> const smoothVals(smooth.nearestTableValues(angles));
+	double const origSum
+		(std::accumulate(origVals.begin(), origVals.end(), 0.));
+	double const smoothSum
+		(std::accumulate(smoothVals.begin(), smoothVals.end(), 0.));
+	std::pair<std::vector<double>::const_iterator
+		, std::vector<double>::const_iterator> const origMinMax
+		(std::minmax_element(origVals.begin(), origVals.end()));
+	std::pair<std::vector<double>::const_iterator
+		, std::vector<double>::const_iterator> const smoothMinMax
+		(std::minmax_element(smoothVals.begin(), smoothVals.end()));
+	if (! dat::nearlyEquals(smoothSum, origSum, 1.e-9 * origSum))
+	{
+		oss << "Failure of smoothed mean test" << std::endl;
+		oss << dat::infoString(origSum, "origSum") << std::endl;
+		oss << dat::infoString(smoothSum, "smoothSum") << std::endl;
+	}
+	if (! ( (*origMinMax.first < *smoothMinMax.first)
+	     && (*smoothMinMax.second < *origMinMax.second)
+	      ))
+	{
+		oss << "Failure of smoothed spread test" << std::endl;
+	}
+
+	return oss.str();
+}
+
 
 }
 
@@ -282,6 +377,7 @@ main
 	oss << math_CircleTab_test1b();
 	oss << math_CircleTab_test2();
 	oss << math_CircleTab_test3();
+	oss << math_CircleTab_test4();
 
 	// check/report results
 	std::string const errMessages(oss.str());
@@ -33,13 +33,17 @@
 
 #include "libmath/smooth.h"
 
+#include "libdat/compare.h"
 #include "libdat/info.h"
 #include "libio/stream.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 
 namespace
@@ -113,6 +117,79 @@ math_smooth_test1
 	return oss.str();
 }
 
+	//! Direct (brute force) convolution with triangle weights
+	std::vector<double>
+	triangleDirect
+		( std::vector<double> const & data
+		, size_t const & halfSize
+		)
+	{
+		std::vector<double> result(data.size(), 0.);
+		size_t const dSize(data.size());
+		double const boxMag(static_cast<double>(halfSize + 1u));
+		for (size_t datNdx(0u) ; datNdx < dSize ; ++datNdx)
+		{
+			for (size_t winNdx(0u) ; winNdx < (2u*halfSize + 1u) ; ++winNdx)
+			{
+				double const offset
+					(std::abs(double(winNdx) - double(halfSize)));
+				double const weight((boxMag - offset) / (boxMag * boxMag));
+				size_t const srcNdx((datNdx + winNdx) % dSize);
+				size_t const outNdx((datNdx + halfSize) % dSize);
+				result[outNdx] += weight * data[srcNdx];
+			}
+		}
+		return result;
+	}
+
+//! Check running sum result against direct convolution
+std::string
+math_smooth_test2
+	()
+{
+	std::ostringstream oss;
+
+	std::vector<double> data;
+	for (size_t nn(0u) ; nn < 37u ; ++nn)
+	{
+		data.emplace_back(double((nn * 7u) % 11u) - 3.25);
+	}
+
+	// include windows wider than the data (multiple wraps)
+	std::vector<size_t> const halfSizes{ 1u, 2u, 5u, 18u, 36u, 50u, 100u };
+	for (size_t const & halfSize : halfSizes)
+	{
+		std::vector<double> const expValues(triangleDirect(data, halfSize));
+		std::vector<double> const gotValues
+			(math::smooth::triangleWrapped<double>(data, halfSize));
+		bool okay(expValues.size() == gotValues.size());
+		for (size_t nn(0u) ; okay && (nn < expValues.size()) ; ++nn)
+		{
+			okay = dat::nearlyEquals(gotValues[nn], expValues[nn], 1.e-12);
+		}
+		if (! okay)
+		{
+			oss << "Failure of running sum test: halfSize = " << halfSize
+				<< std::endl;
+			oss << dat::infoString
+				(expValues.begin(), expValues.end(), "expValues") << std::endl;
+			oss << dat::infoString
+				(gotValues.begin(), gotValues.end(), "gotValues") << std::endl;
+		}
+	}
+
+	// integer data accumulated without overflow or truncation
+	std::vector<uint8_t> const bytes(64u, 200u);
+	std::vector<uint8_t> const gotBytes
+		(math::smooth::triangleWrapped<uint8_t>(bytes, 7u));
+	if (! std::equal(bytes.begin(), bytes.end(), gotBytes.begin()))
+	{
+		oss << "Failure of uint8_t constant data test" << std::endl;
+	}
+
+	return oss.str();
+}
+
 
 }
 
@@ -128,6 +205,7 @@ main
 	// run tests
 	oss << math_smooth_test0();
 	oss << math_smooth_test1();
+	oss << math_smooth_test2();
 
 	// check/report results
 	std::string const errMessages(oss.str());
@@ -0,0 +1,211 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief  This file contains unit test for mem::BoundedQueue
+*/
+
+
+#include "libmem/BoundedQueue.h"
+
+#include "libio/stream.h"
+
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+
+//! Check basic operations
+std::string
+mem_BoundedQueue_test0
+	()
+{
+	std::ostringstream oss;
+
+	mem::BoundedQueue<int> queue(2u);
+	(void)queue.infoString("queue");
+
+	int got{ 0 };
+	if (queue.tryPop(&got))
+	{
+		oss << "Failure of empty tryPop test" << std::endl;
+	}
+	if (! (queue.push(7) && queue.push(8) && (2u == queue.size())))
+	{
+		oss << "Failure of push test" << std::endl;
+	}
+	if (! (queue.pop(&got) && (7 == got)))
+	{
+		oss << "Failure of pop order test" << std::endl;
+	}
+
+	// after close: no additions, but remaining items are available
+	queue.close();
+	if (queue.push(9))
+	{
+		oss << "Failure of push after close test" << std::endl;
+	}
+	if (! (queue.pop(&got) && (8 == got)))
+	{
+		oss << "Failure of drain after close test" << std::endl;
+	}
+	if (queue.pop(&got))
+	{
+		oss << "Failure of pop after close/empty test" << std::endl;
+	}
+
+	// zero capacity treated as one
+	mem::BoundedQueue<int> const tiny(0u);
+	if (! (1u == tiny.capacity()))
+	{
+		oss << "Failure of min capacity test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+//! Check producer/consumer operation with backpressure
+std::string
+mem_BoundedQueue_test1
+	()
+{
+	std::ostringstream oss;
+
+	constexpr size_t numItems{ 10u * 1000u };
+	constexpr size_t capacity{ 4u };
+
+	// ExampleStart
+	mem::BoundedQueue<size_t> queue(capacity);
+	std::atomic<size_t> maxSize{ 0u };
+
+	// producer blocks whenever consumer falls behind
+	std::thread producer
+		( [&queue, &maxSize] ()
+			{
+				for (size_t nn{0u} ; nn < numItems ; ++nn)
+				{
+					size_t item{ nn };
+					queue.push(std::move(item));
+					size_t const currSize{ queue.size() };
+					if (maxSize < currSize)
+					{
+						maxSize = currSize;
+					}
+				}
+				queue.close();
+			}
+		);
+
+	// consumer receives all items in order (until closed and empty)
+	std::vector<size_t> gots;
+	size_t item{};
+	while (queue.pop(&item))
+	{
+		gots.emplace_back(item);
+	}
+	producer.join();
+	// ExampleEnd
+
+	bool okay{ numItems == gots.size() };
+	for (size_t nn{0u} ; okay && (nn < gots.size()) ; ++nn)
+	{
+		okay = (nn == gots[nn]);
+	}
+	if (! okay)
+	{
+		oss << "Failure of producer/consumer order test" << std::endl;
+		oss << "gots.size: " << gots.size() << std::endl;
+	}
+	if (capacity < maxSize)
+	{
+		oss << "Failure of capacity bound test" << std::endl;
+		oss << "maxSize: " << maxSize << std::endl;
+	}
+
+	return oss.str();
+}
+
+//! Check that close releases blocked producer
+std::string
+mem_BoundedQueue_test2
+	()
+{
+	std::ostringstream oss;
+
+	mem::BoundedQueue<int> queue(1u);
+	queue.push(1);
+	std::atomic<bool> pushResult{ true };
+	std::thread producer
+		( [&queue, &pushResult] ()
+			{
+				pushResult = queue.push(2); // blocks until closed
+			}
+		);
+	queue.close();
+	producer.join();
+	if (pushResult)
+	{
+		oss << "Failure of blocked push release test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for mem::BoundedQueue
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << mem_BoundedQueue_test0();
+	oss << mem_BoundedQueue_test1();
+	oss << mem_BoundedQueue_test2();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,358 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for model::PointTree
+*/
+
+
+#include "libmodel/PointTree.h"
+
+#include "libdat/info.h"
+#include "libdat/validity.h"
+#include "libio/stream.h"
+#include "libmath/math.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+
+//! Index of point nearest to ray by exhaustive search (lowest on ties)
+size_t
+bruteNearestTo
+	( std::vector<model::atom::Point> const & points
+	, geo::Ray const & ray
+	, double const & maxDist
+	)
+{
+	size_t bestNdx{ dat::nullValue<size_t>() };
+	double bestRej{ dat::nullValue<double>() };
+	double const tolRejSq{ math::sq(maxDist) };
+	for (size_t ndx{0u} ; ndx < points.size() ; ++ndx)
+	{
+		ga::Vector const relPnt(points[ndx] - ray.theStart);
+		double const magPrj{ ga::dot(relPnt, ray.theDir).theValue };
+		if (0. < magPrj)
+		{
+			double const magVecSq
+				{ math::sq(relPnt[0])
+				+ math::sq(relPnt[1])
+				+ math::sq(relPnt[2])
+				};
+			double const magRejSq
+				{ std::max(0., magVecSq - math::sq(magPrj)) };
+			if (magRejSq < tolRejSq)
+			{
+				double const rej{ std::sqrt(magRejSq) };
+				if ((! dat::isValid(bestRej)) || (rej < bestRej))
+				{
+					bestRej = rej;
+					bestNdx = ndx;
+				}
+			}
+		}
+	}
+	return bestNdx;
+}
+
+//! Random points in a cube - with duplicates (of earlier points) at end
+std::vector<model::atom::Point>
+randomCloud
+	( std::mt19937_64 * const & ptGen
+	, size_t const & numUnique
+	, size_t const & numDups
+	)
+{
+	std::vector<model::atom::Point> points;
+	points.reserve(numUnique + numDups);
+	std::uniform_real_distribution<double> distro(-1., 1.);
+	for (size_t nn{0u} ; nn < numUnique ; ++nn)
+	{
+		points.emplace_back
+			(ga::Vector(distro(*ptGen), distro(*ptGen), distro(*ptGen)));
+	}
+	std::uniform_int_distribution<size_t> ndxDistro(0u, numUnique - 1u);
+	for (size_t nn{0u} ; nn < numDups ; ++nn)
+	{
+		points.emplace_back(points[ndxDistro(*ptGen)]);
+	}
+	return points;
+}
+
+//! Random unit direction
+ga::Vector
+randomDir
+	( std::mt19937_64 * const & ptGen
+	)
+{
+	std::uniform_real_distribution<double> distro(-1., 1.);
+	ga::Vector dir;
+	double mag{ 0. };
+	while (! ((.125 < mag) && (mag < 1.)))
+	{
+		dir = ga::Vector(distro(*ptGen), distro(*ptGen), distro(*ptGen));
+		mag = ga::magnitude(dir);
+	}
+	return ga::unit(dir);
+}
+
+//! Rays aimed at points, random rays, and rays pointing away from cloud
+std::vector<geo::Ray>
+randomRays
+	( std::mt19937_64 * const & ptGen
+	, std::vector<model::atom::Point> const & points
+	, size_t const & numEach
+	)
+{
+	std::vector<geo::Ray> rays;
+	rays.reserve(3u * numEach);
+	std::uniform_int_distribution<size_t> ndxDistro(0u, points.size() - 1u);
+	for (size_t nn{0u} ; nn < numEach ; ++nn)
+	{
+		// aimed at a point (often one which is duplicated)
+		size_t const ndx
+			{ (0u == (nn % 2u)) ? (points.size() - 1u - (nn % 16u))
+			: ndxDistro(*ptGen)
+			};
+		ga::Vector const start(3. * randomDir(ptGen));
+		rays.emplace_back(geo::Ray::fromToward(start, points[ndx]));
+
+		// random ray from inside cloud
+		ga::Vector const inStart(.5 * randomDir(ptGen));
+		rays.emplace_back(geo::Ray(inStart, randomDir(ptGen)));
+
+		// ray from outside pointing away (a miss)
+		ga::Vector const outDir(randomDir(ptGen));
+		rays.emplace_back(geo::Ray(3. * outDir, outDir));
+	}
+	return rays;
+}
+
+//! Check for common functions
+std::string
+model_PointTree_test0
+	()
+{
+	std::ostringstream oss;
+	model::PointTree const aNull;
+	if (aNull.isValid())
+	{
+		oss << "Failure of null value test" << std::endl;
+		oss << "infoString: " << aNull.infoString("aNull") << std::endl;
+	}
+	geo::Ray const ray(ga::vZero, ga::e1);
+	size_t const gotNdx
+		{ aNull.indexNearestTo(std::vector<model::atom::Point>{}, ray, 1.) };
+	if (dat::isValid(gotNdx))
+	{
+		oss << "Failure of null query test" << std::endl;
+	}
+	return oss.str();
+}
+
+//! Check tree queries against exhaustive search
+std::string
+model_PointTree_test1
+	()
+{
+	std::ostringstream oss;
+
+	std::mt19937_64 gen(47u);
+	std::vector<model::atom::Point> const points
+		(randomCloud(&gen, 1000u, 100u));
+	std::vector<geo::Ray> const rays(randomRays(&gen, points, 200u));
+	std::vector<double> const maxDists{ 1.e-6, .01, .1, 2. };
+
+	// ExampleStart
+	// construct (index only) hierarchy over points
+	model::PointTree const tree(points);
+
+	// index of point nearest a ray (within tolerance) - or null
+	geo::Ray const ray
+		(geo::Ray::fromToward(ga::Vector(3., 0., 0.), ga::vZero));
+	size_t const ndxNear{ tree.indexNearestTo(points, ray, .1) };
+	// ExampleEnd
+
+	if (! (tree.isValid() && (points.size() == tree.size())))
+	{
+		oss << "Failure of valid tree test" << std::endl;
+		oss << tree.infoString("tree") << std::endl;
+	}
+	if (! (bruteNearestTo(points, ray, .1) == ndxNear))
+	{
+		oss << "Failure of example query test" << std::endl;
+	}
+
+	// mismatched points are rejected
+	std::vector<model::atom::Point> const fewer
+		(points.begin(), points.begin() + 10u);
+	if (dat::isValid(tree.indexNearestTo(fewer, ray, .1)))
+	{
+		oss << "Failure of mismatched points test" << std::endl;
+	}
+
+	size_t numMiss{ 0u };
+	size_t numDupHit{ 0u };
+	size_t numBad{ 0u };
+	for (size_t const & leafSize : std::vector<size_t>{ 1u, 3u, 8u, 64u })
+	{
+		model::PointTree const leafTree(points, leafSize);
+		for (double const & maxDist : maxDists)
+		{
+			for (geo::Ray const & aRay : rays)
+			{
+				size_t const expNdx{ bruteNearestTo(points, aRay, maxDist) };
+				size_t const gotNdx
+					{ leafTree.indexNearestTo(points, aRay, maxDist) };
+				if (! dat::isValid(expNdx))
+				{
+					++numMiss;
+				}
+				else
+				{
+					// nearest point also present later in collection
+					for (size_t ndx{1000u} ; ndx < points.size() ; ++ndx)
+					{
+						if (points[ndx].theValues == points[expNdx].theValues)
+						{
+							++numDupHit;
+							break;
+						}
+					}
+				}
+				if (! (gotNdx == expNdx))
+				{
+					++numBad;
+				}
+			}
+		}
+	}
+
+	if (! (0u == numBad))
+	{
+		oss << "Failure of tree/brute force index test" << std::endl;
+		oss << dat::infoString(numBad, "numBad") << std::endl;
+	}
+	if (! ((0u < numMiss) && (0u < numDupHit)))
+	{
+		oss << "Failure of test coverage (miss/tie) test" << std::endl;
+		oss << dat::infoString(numMiss, "numMiss") << std::endl;
+		oss << dat::infoString(numDupHit, "numDupHit") << std::endl;
+	}
+
+	return oss.str();
+}
+
+//! Check concurrent queries against exhaustive search
+std::string
+model_PointTree_test2
+	()
+{
+	std::ostringstream oss;
+
+	std::mt19937_64 gen(53u);
+	std::vector<model::atom::Point> const points
+		(randomCloud(&gen, 2000u, 200u));
+	std::vector<geo::Ray> const rays(randomRays(&gen, points, 400u));
+	double const maxDist{ .05 };
+
+	std::vector<size_t> expNdxs;
+	expNdxs.reserve(rays.size());
+	for (geo::Ray const & ray : rays)
+	{
+		expNdxs.emplace_back(bruteNearestTo(points, ray, maxDist));
+	}
+
+	// each thread queries an interleaved subset of rays
+	model::PointTree const tree(points);
+	constexpr size_t numThreads{ 4u };
+	std::vector<size_t> gotNdxs(rays.size(), dat::nullValue<size_t>());
+	std::vector<std::thread> threads;
+	for (size_t nt{0u} ; nt < numThreads ; ++nt)
+	{
+		threads.emplace_back
+			( std::thread
+				( [&tree, &points, &rays, &maxDist, &gotNdxs, nt] ()
+					{
+						size_t const numRays{ rays.size() };
+						for (size_t nr{nt} ; nr < numRays ; nr += numThreads)
+						{
+							gotNdxs[nr] = tree.indexNearestTo
+								(points, rays[nr], maxDist);
+						}
+					}
+				)
+			);
+	}
+	for (std::thread & thread : threads)
+	{
+		thread.join();
+	}
+
+	if (! (gotNdxs == expNdxs))
+	{
+		oss << "Failure of concurrent query test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+}
+
+//! Unit test for model::PointTree
+int
+main
+	( int const /*argc*/
+	, char const * const * const /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << model_PointTree_test0();
+	oss << model_PointTree_test1();
+	oss << model_PointTree_test2();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
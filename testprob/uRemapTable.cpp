@@ -0,0 +1,246 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for prob::RemapTable
+*/
+
+
+#include "libprob/RemapTable.h"
+
+#include "libdat/info.h"
+#include "libio/stream.h"
+#include "libprob/distro.h"
+#include "libprob/Remapper.h"
+
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+//! Check for common functions
+std::string
+prob_RemapTable_test0
+	()
+{
+	std::ostringstream oss;
+	prob::RemapTable const aNull;
+	if (aNull.isValid())
+	{
+		oss << "Failure of null value test" << std::endl;
+		oss << "infoString: " << aNull.infoString("aNull") << std::endl;
+	}
+	return oss.str();
+}
+
+//! Check table evaluation against direct remapper evaluation
+std::string
+prob_RemapTable_test1
+	()
+{
+	std::ostringstream oss;
+
+	// remap from a uniform distribution to a 'hump' one
+	dat::Range<double> const dataRange{ -17., 245. };
+	prob::CdfForward const uniFwd(prob::CdfForward::uniform(dataRange));
+	prob::CdfInverse const humpInv
+		( prob::CdfInverse::generateFor
+			(prob::distro::unitHumpProb, dataRange, 4u*1024u)
+		);
+	prob::Remapper const remHump(uniFwd, humpInv);
+
+	// remap that (nearly) reproduces input
+	prob::Remapper const remSame
+		(uniFwd, prob::CdfInverse::fromCdfForward(uniFwd, 4u*1024u));
+
+	// ExampleStart
+	// bake remapping into a dense table
+	constexpr size_t lutSize{ 8u * 1024u };
+	prob::RemapTable const table(remHump.lookupTable(lutSize));
+
+	// evaluate individual values
+	double const inValue{ 100.25 };
+	double const outValue{ table(inValue) };
+
+	// or transform an entire array (e.g. a row of pixels)
+	std::vector<float> const inData{ -17.f, 0.f, 100.25f, 244.f };
+	std::vector<float> outData(inData.size());
+	table.transform
+		(inData.data(), inData.data() + inData.size(), outData.data());
+	// ExampleEnd
+
+	if (! (lutSize == table.size()))
+	{
+		oss << "Failure of table size test" << std::endl;
+	}
+
+	// table values should be close to direct evaluation
+	double const tol{ dataRange.magnitude() / double(lutSize) };
+	double const expValue{ remHump(inValue) };
+	if (! dat::nearlyEquals(outValue, expValue, tol))
+	{
+		oss << "Failure of table single value test" << std::endl;
+		oss << dat::infoString(expValue, "expValue") << std::endl;
+		oss << dat::infoString(outValue, "outValue") << std::endl;
+	}
+	for (size_t nn{0u} ; nn < inData.size() ; ++nn)
+	{
+		float const expData{ remHump(inData[nn]) };
+		float const & gotData = outData[nn];
+		if (! dat::nearlyEquals(gotData, expData, float(tol)))
+		{
+			oss << "Failure of table transform test" << std::endl;
+			oss << dat::infoString(expData, "expData") << std::endl;
+			oss << dat::infoString(gotData, "gotData") << std::endl;
+		}
+	}
+
+	// identity-like remapping should be (nearly) exact
+	math::Partition const testPart(dataRange, 1000u);
+	constexpr size_t numBins{ 64u };
+	prob::RemapTable const idTable(remSame.lookupTable(numBins));
+	for (size_t nn{0u} ; nn < testPart.size() ; ++nn)
+	{
+		double const value{ testPart.interpValueFor(double(nn) + .5) };
+		double const expId{ remSame(value) };
+		double const gotId{ idTable(value) };
+		if (! dat::nearlyEquals(gotId, expId, 1.e-6))
+		{
+			oss << "Failure of identity table test" << std::endl;
+			oss << dat::infoString(expId, "expId") << std::endl;
+			oss << dat::infoString(gotId, "gotId") << std::endl;
+			break;
+		}
+	}
+
+	return oss.str();
+}
+
+//! Check handling of values outside table domain
+std::string
+prob_RemapTable_test2
+	()
+{
+	std::ostringstream oss;
+
+	dat::Range<double> const dataRange{ 2000., 2400. };
+	prob::Remapper const rem
+		( prob::CdfForward::uniform(dataRange)
+		, prob::CdfInverse::uniform(dataRange)
+		);
+	prob::RemapTable const table(rem.lookupTable(16u));
+
+	std::vector<double> const inData
+		{ 1999., 2000., 2200., 2399.5, 2400., 2401., dat::nullValue<double>() };
+	std::vector<bool> const expValid
+		{ false, true, true, true, false, false, false };
+	std::vector<double> outData(inData.size());
+	table.transform
+		(inData.data(), inData.data() + inData.size(), outData.data());
+	for (size_t nn{0u} ; nn < inData.size() ; ++nn)
+	{
+		bool const gotOne{ dat::isValid(table(inData[nn])) };
+		bool const gotAll{ dat::isValid(outData[nn]) };
+		if ((! (expValid[nn] == gotOne)) || (! (expValid[nn] == gotAll)))
+		{
+			oss << "Failure of out of range validity test" << std::endl;
+			oss << dat::infoString(inData[nn], "inData") << std::endl;
+		}
+	}
+
+	return oss.str();
+}
+
+//! Check direct code lookup tables
+std::string
+prob_RemapTable_test3
+	()
+{
+	std::ostringstream oss;
+
+	dat::Range<double> const dataRange{ 0., 256. };
+	prob::Remapper const rem
+		( prob::CdfForward::uniform(dataRange)
+		, prob::CdfInverse::generateFor
+			(prob::distro::unitHumpProb, dataRange, 1024u)
+		);
+	std::vector<uint8_t> const codes(rem.codeValues<uint8_t>());
+	if (! (256u == codes.size()))
+	{
+		oss << "Failure of code table size test" << std::endl;
+	}
+	else
+	{
+		for (size_t code{0u} ; code < codes.size() ; ++code)
+		{
+			uint8_t const expCode{ rem(static_cast<uint8_t>(code)) };
+			uint8_t const & gotCode = codes[code];
+			if (! (gotCode == expCode))
+			{
+				oss << "Failure of code table value test" << std::endl;
+				oss << dat::infoString(code, "code") << std::endl;
+				break;
+			}
+		}
+	}
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for prob::RemapTable
+int
+main
+	( int const /*argc*/
+	, char const * const * const /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << prob_RemapTable_test0();
+	oss << prob_RemapTable_test1();
+	oss << prob_RemapTable_test2();
+	oss << prob_RemapTable_test3();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -37,6 +37,7 @@
 #include "libdat/validity.h"
 #include "libio/stream.h"
 
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -150,6 +151,7 @@ recon_RayConvergence_test1
 	// exercise class
 	recon::RayConvergence const bundle(rays);
 	ga::Vector const gotRobust(bundle.robustPoint());
+	ga::Vector const gotSampled(bundle.sampledRobustPoint());
 	ga::Vector const gotFit(bundle.meanNearTo(gotRobust, rejTol));
 
 	/*
@@ -172,6 +174,71 @@ recon_RayConvergence_test1
 		oss << dat::infoString(expFit, "expFit") << std::endl;
 		oss << dat::infoString(gotFit, "gotFit") << std::endl;
 	}
+	if (! gotSampled.nearlyEquals(expFit, tolFit))
+	{
+		oss << "Failure of sampledRobustPoint test" << std::endl;
+		oss << dat::infoString(expFit, "expFit") << std::endl;
+		oss << dat::infoString(gotSampled, "gotSampled") << std::endl;
+	}
+
+	return oss.str();
+}
+
+//! Check sampled estimation for many rays with outliers
+std::string
+recon_RayConvergence_test2
+	()
+{
+	std::ostringstream oss;
+
+	// rays from stations on a hemisphere toward (noisy) expPnt
+	ga::Vector const expPnt(3., -2., 1.);
+	std::vector<geo::Ray> rays;
+	size_t const numRays{ 600u };
+	for (size_t nn{0u} ; nn < numRays ; ++nn)
+	{
+		double const dn{ double(nn) };
+		double const azim{ .7 * dn };
+		double const elev{ .2 + 1.2 * double(nn % 17u) / 17. };
+		ga::Vector const sta
+			{ expPnt + 50. * ga::Vector
+				( std::cos(elev) * std::cos(azim)
+				, std::cos(elev) * std::sin(azim)
+				, std::sin(elev)
+				)
+			};
+		// small deterministic "noise" - and every fourth an outlier
+		double const noise{ .01 * std::sin(3.1 * dn) };
+		ga::Vector aim{ expPnt + ga::Vector(noise, -noise, .5 * noise) };
+		if (0u == (nn % 4u))
+		{
+			aim = aim + ga::Vector(4. * std::cos(dn), 3., -2.);
+		}
+		rays.emplace_back(geo::Ray::fromToward(sta, aim));
+	}
+
+	// ExampleStart
+	recon::RayConvergence const bundle(rays);
+	// cost linear in number of rays (vs quadratic for robustPoint())
+	ga::Vector const gotPnt(bundle.sampledRobustPoint());
+	// ExampleEnd
+
+	double const tol{ .02 };
+	if (! gotPnt.nearlyEquals(expPnt, tol))
+	{
+		oss << "Failure of sampled many ray test" << std::endl;
+		oss << dat::infoString(expPnt, "expPnt") << std::endl;
+		oss << dat::infoString(gotPnt, "gotPnt") << std::endl;
+	}
+
+	// repeatable result
+	ga::Vector const againPnt(bundle.sampledRobustPoint());
+	if (! againPnt.nearlyEquals(gotPnt, 0.))
+	{
+		oss << "Failure of sampled repeatability test" << std::endl;
+		oss << dat::infoString(gotPnt, "gotPnt") << std::endl;
+		oss << dat::infoString(againPnt, "againPnt") << std::endl;
+	}
 
 	return oss.str();
 }
@@ -191,6 +258,7 @@ main
 	// run tests
 	oss << recon_RayConvergence_test0();
 	oss << recon_RayConvergence_test1();
+	oss << recon_RayConvergence_test2();
 
 	// check/report results
 	std::string const errMessages(oss.str());
@@ -449,6 +449,108 @@ ro_FitBaseZ_test2
 	return oss.str();
 }
 
+//! Check batch evaluation of many fitters
+std::string
+ro_FitBaseZ_test3
+	()
+{
+	std::ostringstream oss;
+
+	// define test configuration
+	ga::Vector const base2w1{ ga::unit(ga::Vector( -.2, 0.1, .80)) };
+	ga::BiVector const angle2w1( .02, -.04, .03);
+	ro::PairBaseZ const roExp
+		( ga::Rigid::identity()
+		, ga::Rigid(base2w1, ga::Pose(angle2w1))
+		);
+	ro::PairBaseZ const roNom
+		( ga::Rigid::identity()
+		, ga::Rigid(ga::e3, ga::Pose::identity())
+		);
+
+	// several independent quintuples of measurements
+	constexpr size_t numFits{ 16u };
+	std::vector<PairUV> const uvs{ simUVs(roExp, 5u * numFits) };
+	std::vector<ro::FitBaseZ> fitters;
+	fitters.reserve(numFits);
+	for (size_t nf{0u} ; nf < numFits ; ++nf)
+	{
+		PairUV const * const uv0 = &(uvs[5u * nf]);
+		std::array<PtrPairUV, 5u> const uvPtrs
+			{{ uv0, uv0 + 1u, uv0 + 2u, uv0 + 3u, uv0 + 4u }};
+		fitters.emplace_back(ro::FitBaseZ(uvPtrs));
+	}
+
+	// evaluate as a batch (serial and concurrent)
+	std::vector<ro::Solution> const solnOnes
+		{ ro::roSolutionsFor(fitters, roNom, {}, 1u) };
+	std::vector<ro::Solution> const solnMany
+		{ ro::roSolutionsFor(fitters, roNom, {}, 4u) };
+
+	if (! ((numFits == solnOnes.size()) && (numFits == solnMany.size())))
+	{
+		oss << "Failure of roSolutionsFor size test" << std::endl;
+	}
+	else
+	{
+		size_t numValid{ 0u };
+		size_t numFit{ 0u };
+		for (size_t nf{0u} ; nf < numFits ; ++nf)
+		{
+			// batch results should match individual evaluation
+			ro::Solution const expSoln{ fitters[nf].roSolution(roNom) };
+			ro::Solution const & gotOne = solnOnes[nf];
+			ro::Solution const & gotMany = solnMany[nf];
+			if (! ( (expSoln.isValid() == gotOne.isValid())
+			     && (expSoln.isValid() == gotMany.isValid())
+			      ))
+			{
+				oss << "Failure of batch validity test: nf = " << nf
+					<< std::endl;
+				continue;
+			}
+			if (! expSoln.isValid())
+			{
+				continue;
+			}
+			++numValid;
+			ro::PairBaseZ const expRO(expSoln.pair());
+			ro::PairBaseZ const gotRO1(gotOne.pair());
+			ro::PairBaseZ const gotRO4(gotMany.pair());
+			if (! (gotRO1.nearlyEquals(expRO) && gotRO4.nearlyEquals(expRO)))
+			{
+				oss << "Failure of batch solution test: nf = " << nf
+					<< std::endl;
+				oss << expRO.infoString("expRO") << std::endl;
+				oss << gotRO4.infoString("gotRO4") << std::endl;
+			}
+			if (! (gotOne.theItCount == expSoln.theItCount))
+			{
+				oss << "Failure of batch itCount test: nf = " << nf
+					<< std::endl;
+			}
+
+			// count solutions that fit their own data
+			// (others may stall in a local minimum - same as individually)
+			double const gotGap{ fitters[nf].rmsGapFor(gotRO4) };
+			if (dat::nearlyEquals(gotGap, 0.))
+			{
+				++numFit;
+			}
+		}
+
+		// with good data and a reasonable start most fits should succeed
+		if (! ((numFits/2u < numValid) && (numFits/2u < numFit)))
+		{
+			oss << "Failure of batch numValid/numFit test" << std::endl;
+			oss << dat::infoString(numValid, "numValid") << std::endl;
+			oss << dat::infoString(numFit, "numFit") << std::endl;
+		}
+	}
+
+	return oss.str();
+}
+
 
 }
 
@@ -466,6 +568,7 @@ main
 	oss << ro_FitBaseZ_test1a();
 	oss << ro_FitBaseZ_test1b();
 	oss << ro_FitBaseZ_test2();
+	oss << ro_FitBaseZ_test3();
 
 	// check/report results
 	std::string const errMessages(oss.str());
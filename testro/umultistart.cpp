@@ -0,0 +1,226 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+
+/*! \file
+\brief  This file contains unit test for ro::multistart
+*/
+
+
+#include "libro/multistart.h"
+
+#include "libdat/info.h"
+#include "libdat/validity.h"
+#include "libga/groups.h"
+#include "libio/stream.h"
+#include "libro/PairBaseZ.h"
+
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+
+
+namespace
+{
+
+//! Check for common functions
+std::string
+ro_multistart_test0
+	()
+{
+	std::ostringstream oss;
+
+	// one nominal for each spread spinor
+	std::vector<ro::OriPair> const roNoms{ ro::multistart::spreadOfNominals() };
+	size_t const expSize{ ga::groups::spreadOfSpinors().size() };
+	if (! (expSize == roNoms.size()))
+	{
+		oss << "Failure of spreadOfNominals size test" << std::endl;
+		oss << dat::infoString(expSize, "expSize") << std::endl;
+		oss << dat::infoString(roNoms.size(), "gotSize") << std::endl;
+	}
+
+	// valid probability ranks first, gap only between invalid (or ties)
+	using ro::multistart::ranksAbove;
+	double const nan{ dat::nullValue<double>() };
+	if (! ( ranksAbove(.5, 1.e-3, nan, 1.e-9)
+	     && (! ranksAbove(nan, 1.e-9, .5, 1.e-3))
+	     && ranksAbove(.6, 1.e-3, .5, 1.e-9)
+	     && (! ranksAbove(.4, 1.e-9, .5, 1.e-3))
+	     && ranksAbove(.5, 1.e-6, .5, 1.e-3)
+	     && (! ranksAbove(.5, 1.e-3, .5, 1.e-6))
+	     && ranksAbove(nan, 1.e-6, nan, 1.e-3)
+	     && (! ranksAbove(nan, 1.e-3, nan, 1.e-6))
+	      )
+	   )
+	{
+		oss << "Failure of ranksAbove test" << std::endl;
+	}
+
+	// null input
+	std::vector<ro::PairUV> const uvNone;
+	ro::FiveOf<size_t> const fitNdxs{{ 0u, 1u, 2u, 3u, 4u }};
+	ro::QuintSoln const aNull{ ro::multistart::bestFor(uvNone, fitNdxs) };
+	if (aNull.isValid())
+	{
+		oss << "Failure of null bestFor test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+	//! Corresponding directions for ro to random points
+	std::vector<ro::PairUV>
+	simUVs
+		( ro::Pair const & ro
+		, size_t const & numMea
+		)
+	{
+		std::vector<ro::PairUV> uvs;
+		uvs.reserve(numMea);
+		std::mt19937 gen(47u);
+		std::uniform_real_distribution<double> distro(-5., 5.);
+		for (size_t nn{0u} ; nn < numMea ; ++nn)
+		{
+			ga::Vector const pnt(distro(gen), distro(gen), distro(gen));
+			uvs.emplace_back(ro.uvDirectionsFor(pnt));
+		}
+		return uvs;
+	}
+
+//! Check multiple start fitting without a nominal orientation
+std::string
+ro_multistart_test1
+	()
+{
+	std::ostringstream oss;
+
+	// configuration far from the (conventional) identity attitude
+	ga::Vector const base2w1{ ga::unit(ga::Vector(-.3, .4, .8)) };
+	ga::BiVector const angle2w1( .7, -.9, .5);
+	ro::PairBaseZ const roExp
+		( ga::Rigid::identity()
+		, ga::Rigid(base2w1, ga::Pose(angle2w1))
+		);
+	std::vector<ro::PairUV> const uvPairs{ simUVs(roExp, 12u) };
+	ro::FiveOf<size_t> const fitNdxs{{ 0u, 2u, 4u, 6u, 8u }};
+
+	// ExampleStart
+	// fit from all spread starting attitudes and keep most consistent
+	ro::QuintSoln const gotSoln
+		{ ro::multistart::bestFor(uvPairs, fitNdxs) };
+	// ExampleEnd
+
+	if (! gotSoln.isValid())
+	{
+		oss << "Failure of valid bestFor test" << std::endl;
+	}
+	else
+	{
+		ro::PairBaseZ const roGot(gotSoln.theSoln.pair());
+		if (! roGot.nearlyEquals(roExp))
+		{
+			oss << "Failure of bestFor solution test" << std::endl;
+			oss << roExp.infoString("roExp") << std::endl;
+			oss << roGot.infoString("roGot") << std::endl;
+		}
+	}
+
+	// distinct solutions should not depend on concurrency
+	ro::FiveOf<ro::PtrPairUV> const uvFitPtrs
+		{{ &(uvPairs[0]), &(uvPairs[2]), &(uvPairs[4])
+		 , &(uvPairs[6]), &(uvPairs[8])
+		}};
+	std::vector<ro::Solution> const solnOnes
+		{ ro::multistart::distinctSolutionsFor(uvFitPtrs, {}, 1.e-6, 1u) };
+	std::vector<ro::Solution> const solnMany
+		{ ro::multistart::distinctSolutionsFor(uvFitPtrs, {}, 1.e-6, 4u) };
+	if (! (solnOnes.size() == solnMany.size()))
+	{
+		oss << "Failure of distinct size test" << std::endl;
+		oss << dat::infoString(solnOnes.size(), "solnOnes") << std::endl;
+		oss << dat::infoString(solnMany.size(), "solnMany") << std::endl;
+	}
+	else
+	if (solnOnes.empty())
+	{
+		oss << "Failure of non-empty distinct test" << std::endl;
+	}
+	else
+	{
+		for (size_t nn{0u} ; nn < solnOnes.size() ; ++nn)
+		{
+			ro::PairBaseZ const roOne(solnOnes[nn].pair());
+			ro::PairBaseZ const roMany(solnMany[nn].pair());
+			if (! roOne.nearlyEquals(roMany))
+			{
+				oss << "Failure of distinct order test: nn = " << nn
+					<< std::endl;
+			}
+			// and all reported solutions should be different
+			for (size_t mm{0u} ; mm < nn ; ++mm)
+			{
+				ro::PairBaseZ const roPrev(solnOnes[mm].pair());
+				if (roPrev.nearlyEquals(roOne))
+				{
+					oss << "Failure of distinct duplicate test: "
+						<< mm << ", " << nn << std::endl;
+				}
+			}
+		}
+	}
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for ro::multistart
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << ro_multistart_test0();
+	oss << ro_multistart_test1();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
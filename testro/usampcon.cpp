@@ -46,6 +46,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -267,6 +268,30 @@ ro_sampcon_test1
 		oss << "Failure of fit test" << std::endl;
 	}
 
+	// caller's generator - same seed should draw same samples
+	std::mt19937_64 randGenA(17u);
+	std::mt19937_64 randGenB(17u);
+	std::vector<ro::QuintSoln> const solnsA
+		{ ro::sampcon::allBySample(&randGenA, uvPairs, roPairNom, 32u) };
+	std::vector<ro::QuintSoln> const solnsB
+		{ ro::sampcon::allBySample(&randGenB, uvPairs, roPairNom, 32u) };
+	bool sameDraws{ (! solnsA.empty()) && (solnsA.size() == solnsB.size()) };
+	for (size_t nn{0u} ; sameDraws && (nn < solnsA.size()) ; ++nn)
+	{
+		sameDraws = (solnsA[nn].theFitNdxs == solnsB[nn].theFitNdxs);
+	}
+	if (! sameDraws)
+	{
+		oss << "Failure of caller generator repeatability test" << std::endl;
+		oss << dat::infoString(solnsA.size(), "solnsA.size") << std::endl;
+		oss << dat::infoString(solnsB.size(), "solnsB.size") << std::endl;
+	}
+	std::mt19937_64 * const ptNullGen{ nullptr };
+	if (dat::isValid(ro::sampcon::bySample(ptNullGen, uvPairs, roPairNom)))
+	{
+		oss << "Failure of null generator test" << std::endl;
+	}
+
 	// saveModelRaysIn1(oriPairNom, uvPairs, "Nom");
 	// saveModelRaysIn1(roFit, uvPairs, "Fit");
 
@@ -402,6 +427,96 @@ ro_sampcon_test2
 	return oss.str();
 }
 
+//! Check streaming/concurrent exhaustive evaluation
+std::string
+ro_sampcon_test3
+	()
+{
+	std::ostringstream oss;
+
+	ga::Vector const expSta1( -1., 0., 0. );
+	ga::Vector const expSta2(  1., 0., 0. );
+	ga::Rigid const oriNom1(ga::Vector(-1., .1, .1), ga::Pose::identity());
+	ga::Rigid const oriNom2(ga::Vector( 1., .0, .0), ga::Pose::identity());
+
+	// a dozen points with (slightly) inconsistent directions
+	std::vector<ro::PairUV> uvPairs;
+	for (size_t nn{0u} ; nn < 12u ; ++nn)
+	{
+		double const xx{ -1.5 + double(nn % 4u) };
+		double const yy{ -1. + double(nn / 4u) };
+		double const zz{ -1. - .1 * double(nn % 3u) };
+		ga::Vector const pnt(xx, yy, zz);
+		ga::Vector const noise(0., 1.e-3 * double(nn % 5u), 0.);
+		uvPairs.emplace_back
+			( ro::PairUV
+				{ ga::unit(pnt - expSta1)
+				, ga::unit(pnt + noise - expSta2)
+				}
+			);
+	}
+	ro::PairBaseZ const nomBaseZ(oriNom1, oriNom2);
+	ro::OriPair const oriPairNom{ ro::unitOriPair(nomBaseZ.pair()) };
+	ro::FitConfig const fitConfig{ 1.e9 };
+
+	// ExampleStart
+	// best few solutions over all 12-choose-5 fits (without storing all)
+	constexpr size_t numBest{ 3u };
+	std::vector<ro::QuintSoln> const gotBests
+		{ ro::sampcon::bestByCombo(uvPairs, oriPairNom, numBest, fitConfig) };
+	// ExampleEnd
+
+	// compare with selection from all solutions
+	std::vector<ro::QuintSoln> const allOne
+		{ ro::sampcon::allByCombo(uvPairs, oriPairNom, fitConfig, 1u) };
+	std::vector<ro::QuintSoln> const allFour
+		{ ro::sampcon::allByCombo(uvPairs, oriPairNom, fitConfig, 4u) };
+	std::vector<ro::QuintSoln> const expBests
+		{ ro::sampcon::bestOf(allOne, uvPairs, numBest) };
+
+	size_t const maxNumCombos{ 792u }; // 12-choose-5
+	bool const sameSize{ allOne.size() == allFour.size() };
+	if (! (sameSize && (allOne.size() <= maxNumCombos)))
+	{
+		oss << "Failure of allByCombo size test" << std::endl;
+		oss << dat::infoString(allOne.size(), "allOne.size") << std::endl;
+		oss << dat::infoString(allFour.size(), "allFour.size") << std::endl;
+	}
+	else
+	{
+		for (size_t nn{0u} ; nn < allOne.size() ; ++nn)
+		{
+			if (! (allOne[nn].theFitNdxs == allFour[nn].theFitNdxs))
+			{
+				oss << "Failure of allByCombo order test" << std::endl;
+				break;
+			}
+		}
+	}
+
+	if (! ((numBest == gotBests.size()) && (numBest == expBests.size())))
+	{
+		oss << "Failure of bestByCombo size test" << std::endl;
+		oss << dat::infoString(gotBests.size(), "gotBests.size") << std::endl;
+		oss << dat::infoString(expBests.size(), "expBests.size") << std::endl;
+	}
+	else
+	{
+		for (size_t nn{0u} ; nn < numBest ; ++nn)
+		{
+			if (! (gotBests[nn].theFitNdxs == expBests[nn].theFitNdxs))
+			{
+				oss << "Failure of bestByCombo selection test" << std::endl;
+				oss << expBests[nn].infoString("exp") << std::endl;
+				oss << gotBests[nn].infoString("got") << std::endl;
+				break;
+			}
+		}
+	}
+
+	return oss.str();
+}
+
 
 }
 
@@ -422,6 +537,7 @@ if (useIt)
 	oss << ro_sampcon_test1();
 }
 	oss << ro_sampcon_test2();
+	oss << ro_sampcon_test3();
 
 	// check/report results
 	std::string const errMessages(oss.str());
@@ -0,0 +1,222 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for sen::render
+*/
+
+
+#include "libsen/render.h"
+
+#include "libdat/grid.h"
+#include "libdat/info.h"
+#include "libdat/validity.h"
+#include "libgeo/xform.h"
+#include "libio/stream.h"
+#include "libmodel/Part.h"
+#include "libsen/funcProjOp.h"
+#include "libsen/funcSenseOp.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+//! Simple world model: a (tilted) plane
+struct PlaneModel
+{
+	ga::Vector theOrig;
+	ga::Vector theNorm;
+
+	//! Intersection of ray with plane (null if parallel or behind)
+	ga::Vector
+	locationFor
+		( geo::Ray const & rayInRef
+		) const
+	{
+		ga::Vector loc;
+		double const den{ ga::dot(rayInRef.theDir, theNorm).theValue };
+		if (0. != den)
+		{
+			double const dist
+				{ ga::dot(theOrig - rayInRef.theStart, theNorm).theValue / den };
+			if (0. < dist)
+			{
+				loc = rayInRef.theStart + dist * rayInRef.theDir;
+			}
+		}
+		return loc;
+	}
+
+	//! Model component at (valid) location
+	model::Part
+	partFor
+		( ga::Vector const & locInRef
+		) const
+	{
+		return model::Part
+			{ locInRef
+			, model::traits::Radiometry()
+			, model::traits::Geometry(theNorm)
+			};
+	}
+};
+
+//! Per-element (serial) rendering for comparison
+dat::grid<model::atom::Range>
+serialRangeFrom
+	( PlaneModel const & modelInRef
+	, ga::Rigid const & xSenWrtRef
+	, sen::central::ProjOp const & projOp
+	, dat::Extents const & hwSize
+	)
+{
+	dat::grid<model::atom::Range> imprint(hwSize);
+	sen::range::SenseOp const senseOp;
+	ga::Rigid const xRefWrtSen(xSenWrtRef.inverse());
+	for (size_t row{0u} ; row < imprint.high() ; ++row)
+	{
+		for (size_t col{0u} ; col < imprint.wide() ; ++col)
+		{
+			dat::Spot const spot(dat::cast::Spot(dat::RowCol{{ row, col }}));
+			geo::Ray const rayInSen(projOp(spot));
+			geo::Ray const rayInRef(geo::xform::apply(xRefWrtSen, rayInSen));
+			ga::Vector const locInRef(modelInRef.locationFor(rayInRef));
+			model::Part const partInRef(modelInRef.partFor(locInRef));
+			model::Part const partInSen(partInRef.transformedBy(xSenWrtRef));
+			imprint(row, col) = senseOp(partInSen, rayInSen);
+		}
+	}
+	return imprint;
+}
+
+//! True if grids have same size and same (or both null) elements
+bool
+sameValues
+	( dat::grid<model::atom::Range> const & gridA
+	, dat::grid<model::atom::Range> const & gridB
+	)
+{
+	bool same{ (gridA.hwSize() == gridB.hwSize()) };
+	for (dat::grid<model::atom::Range>::const_iterator
+		itA{gridA.begin()}, itB{gridB.begin()}
+		; same && (gridA.end() != itA) ; ++itA, ++itB)
+	{
+		bool const okA{ dat::isValid(*itA) };
+		bool const okB{ dat::isValid(*itB) };
+		same = (okA == okB) && ((! okA) || (*itA == *itB));
+	}
+	return same;
+}
+
+//! Check tiled concurrent rendering against per-element evaluation
+std::string
+sen_render_test1
+	()
+{
+	std::ostringstream oss;
+
+	// size not a multiple of render tile size
+	dat::Extents const hwSize(70u, 150u);
+	sen::central::ProjOp const projOp(hwSize);
+
+	// plane in view of part of the sensor field
+	PlaneModel const model
+		{ ga::Vector(0., 0., -10.)
+		, ga::unit(ga::Vector(1., .1, .05))
+		};
+	ga::Rigid const xSenWrtRef
+		(ga::Vector(.5, -.25, 1.), ga::Pose(ga::BiVector(.2, -.3, .1)));
+
+	dat::grid<model::atom::Range> const expImprint
+		(serialRangeFrom(model, xSenWrtRef, projOp, hwSize));
+
+	// should include rays which both hit and miss the plane
+	size_t numHit{ 0u };
+	for (model::atom::Range const & range : expImprint)
+	{
+		if (dat::isValid(range))
+		{
+			++numHit;
+		}
+	}
+	if (! ((0u < numHit) && (numHit < expImprint.size())))
+	{
+		oss << "Failure of test setup hit/miss test" << std::endl;
+		oss << dat::infoString(numHit, "numHit") << std::endl;
+	}
+
+	// including single job and more jobs than rows
+	std::vector<size_t> const numJobses{ 1u, 2u, 5u, hwSize.high() + 3u };
+	for (size_t const & numJobs : numJobses)
+	{
+		// ExampleStart
+		// range imprint of model (tiles rendered over numJobs threads)
+		dat::grid<model::atom::Range> const gotImprint
+			( sen::render::imprintFrom
+				< dat::grid<model::atom::Range>, sen::range::SenseOp >
+				(model, xSenWrtRef, projOp, hwSize, numJobs)
+			);
+		// ExampleEnd
+		if (! sameValues(gotImprint, expImprint))
+		{
+			oss << "Failure of tiled imprint test" << std::endl;
+			oss << dat::infoString(numJobs, "numJobs") << std::endl;
+		}
+	}
+
+	return oss.str();
+}
+
+}
+
+//! Unit test for sen::render
+int
+main
+	( int const /*argc*/
+	, char const * const * const /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << sen_render_test1();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}
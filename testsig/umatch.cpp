@@ -34,12 +34,15 @@
 #include "libsig/match.h"
 
 #include "libdat/compare.h"
+#include "libdat/f16.h"
 #include "libdat/ExtentsIterator.h"
 #include "libdat/info.h"
 #include "libdat/validity.h"
 #include "libio/stream.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
@@ -220,6 +223,97 @@ sig_match_test0
 #	endif
 
 
+//! Check matching with half precision source data
+std::string
+sig_match_test2
+	()
+{
+	std::ostringstream oss;
+
+	// smooth texture (integer values exactly representable as half)
+	auto const valueAt
+		{ [] (double const & row, double const & col)
+			{
+				double const val
+					{ 128.
+					+ 60. * std::sin(row / 3.1 + col / 11.)
+					+ 60. * std::cos(col / 3.7 - row / 9.)
+					};
+				return static_cast<float>(std::floor(val));
+			}
+		};
+	dat::Extents const hwSize(64u, 72u);
+	dat::grid<float> fullA(hwSize);
+	dat::grid<float> fullB(hwSize);
+	for (dat::ExtentsIterator iter(hwSize) ; iter ; ++iter)
+	{
+		dat::RowCol const & rc = *iter;
+		double const row{ static_cast<double>(rc[0]) };
+		double const col{ static_cast<double>(rc[1]) };
+		fullA(rc) = valueAt(row, col);
+		fullB(rc) = valueAt(row + 4., col + 2.);
+	}
+	dat::grid<dat::f16_t> const halfA(dat::f16::halfGridFor(fullA));
+	dat::grid<dat::f16_t> const halfB(dat::f16::halfGridFor(fullB));
+	std::array<float, 3u> const rgbGains{{ 1.f, 1.f, 1.f }};
+
+	std::vector<sig::FilterContext> fcons;
+	dat::Extents const hunkSize(10u, 10u);
+	dat::Extents const moveSize(12u, 12u);
+	for (size_t mid : { 24u, 32u, 40u })
+	{
+		fcons.emplace_back
+			( sig::FilterContext::fromCenters
+				( dat::RowCol{{ mid, mid }}
+				, dat::RowCol{{ mid - 4u, mid - 2u }}
+				, hunkSize
+				, moveSize
+				)
+			);
+	}
+
+	// same results for float and half precision storage
+	constexpr size_t numJobs{ 2u };
+	sig::match::SourceRefs const floatRefs{ fullA, fullB, rgbGains };
+	std::vector<std::pair<dat::Spot, dat::Spot> > const expPairs
+		{ sig::match::spotPairsFor(fcons, floatRefs, numJobs) };
+	sig::match::SourceRefsHalf const halfRefs{ halfA, halfB, rgbGains };
+	std::vector<std::pair<dat::Spot, dat::Spot> > const gotPairs
+		{ sig::match::spotPairsFor(fcons, halfRefs, numJobs) };
+
+	if (! (fcons.size() == gotPairs.size()))
+	{
+		oss << "Failure of half precision match size test" << std::endl;
+	}
+	else
+	{
+		for (size_t nn{0u} ; nn < gotPairs.size() ; ++nn)
+		{
+			std::pair<dat::Spot, dat::Spot> const & expPair = expPairs[nn];
+			std::pair<dat::Spot, dat::Spot> const & gotPair = gotPairs[nn];
+			bool const sameA
+				{ (dat::isValid(expPair.first) == dat::isValid(gotPair.first))
+				&& ( (! dat::isValid(expPair.first))
+				  || dat::nearlyEquals(expPair.first, gotPair.first))
+				};
+			bool const sameB
+				{ (dat::isValid(expPair.second) == dat::isValid(gotPair.second))
+				&& ( (! dat::isValid(expPair.second))
+				  || dat::nearlyEquals(expPair.second, gotPair.second))
+				};
+			if (! (sameA && sameB))
+			{
+				oss << "Failure of half precision match test: nn = " << nn
+					<< std::endl;
+				oss << dat::infoString(expPair.second, "exp") << std::endl;
+				oss << dat::infoString(gotPair.second, "got") << std::endl;
+			}
+		}
+	}
+
+	return oss.str();
+}
+
 #	if defined HasBeenFixed
 //! Check check scoring grid computations
 std::string
@@ -351,6 +445,7 @@ main
 
 	// run tests
 	oss << sig_match_test0();
+	oss << sig_match_test2();
 #	if defined HasBeenFixed
 	oss << sig_match_test1();
 #	endif
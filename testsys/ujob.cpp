@@ -38,6 +38,7 @@
 #include "libio/sprintf.h"
 #include "libio/stream.h"
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -191,6 +192,52 @@ sys_job_test2
 }
 
 
+//! Check processing of index ranges
+std::string
+sys_job_test3
+	()
+{
+	std::ostringstream oss;
+
+	// each item should be visited exactly once regardless of job count
+	constexpr size_t numItems{ 100u };
+	std::vector<size_t> const jobCounts{ 0u, 1u, 3u, 7u, 150u };
+	for (size_t const & numJobs : jobCounts)
+	{
+		std::vector<size_t> visits(numItems, 0u);
+		sys::job::processRanges
+			( numItems
+			, [& visits]
+				(size_t const & ndxBeg, size_t const & ndxEnd)
+				{
+					for (size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+					{
+						++(visits[ndx]);
+					}
+				}
+			, numJobs
+			);
+
+		size_t const gotBad
+			{ static_cast<size_t>
+				(std::count_if
+					( visits.begin(), visits.end()
+					, [] (size_t const & count) { return (1u != count); }
+					)
+				)
+			};
+		if (! (0u == gotBad))
+		{
+			oss << "Failure of processRanges visit test" << std::endl;
+			oss << dat::infoString(numJobs, "numJobs") << std::endl;
+			oss << dat::infoString(gotBad, "gotBad") << std::endl;
+		}
+	}
+
+	return oss.str();
+}
+
+
 }
 
 //! Unit test for sys::job
@@ -206,6 +253,7 @@ main
 	oss << sys_job_test0();
 	oss << sys_job_test1();
 	oss << sys_job_test2();
+	oss << sys_job_test3();
 
 	// check/report results
 	std::string const errMessages(oss.str());
@@ -34,6 +34,8 @@
 #include "libtri/NodeIndex.h"
 
 #include "libtri/IsoTille.h"
+#include "libtri/NodeIterator.h"
+#include "libtri/shape.h"
 
 #include "libdat/info.h"
 #include "libdat/validity.h"
@@ -44,6 +46,7 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 
 namespace
@@ -153,6 +156,124 @@ tri_NodeIndex_test1
 }
 
 
+//! Check span rasterized index against per-node iteration
+std::string
+tri_NodeIndex_test2
+	()
+{
+	std::ostringstream oss;
+
+	// a tritille not aligned with domain edges
+	dat::Range<double> const xRange{ -2.5, 3.75 };
+	dat::Range<double> const yRange{ -1.25, 4.5 };
+	tri::Domain const xyDomain{ dat::Area<double>{ xRange, yRange } };
+	constexpr std::array<double, 2u> aDir{{ .125, 1. }};
+	tri::IsoGeo const trigeo(1./13., 1./11., aDir);
+	tri::IsoTille const trinet(trigeo, xyDomain);
+
+	tri::NodeIndex const index(trinet);
+
+	// expected keys (in order) from explicit iteration over all nodes
+	std::vector<tri::NodeKey> expKeys;
+	for (tri::NodeIterator iter(trinet.begin()) ; iter ; ++iter)
+	{
+		expKeys.emplace_back(iter.nodeKey());
+	}
+
+	if (! (index.size() == expKeys.size()))
+	{
+		oss << "Failure of index size test" << std::endl;
+		oss << dat::infoString(expKeys.size(), "exp") << std::endl;
+		oss << dat::infoString(index.size(), "got") << std::endl;
+	}
+	if (! (trinet.sizeValidNodes() == expKeys.size()))
+	{
+		oss << "Failure of sizeValidNodes test" << std::endl;
+	}
+
+	size_t errCount{ 0u };
+	for (size_t ndx{0u} ; ndx < expKeys.size() ; ++ndx)
+	{
+		tri::NodeKey const & expKey = expKeys[ndx];
+		tri::NodeIndex::index_type const gotNdx
+			{ index.indexForNodeKey(expKey) };
+		if (! (index.contains(expKey) && (gotNdx == ndx)))
+		{
+			++errCount;
+		}
+	}
+	if (! (0u == errCount))
+	{
+		oss << "Failure of index order test: errCount = "
+			<< errCount << std::endl;
+	}
+
+	return oss.str();
+}
+
+//! Check index of circular domain
+std::string
+tri_NodeIndex_test3
+	()
+{
+	std::ostringstream oss;
+
+	// ExampleStart
+
+	// tritille geometry
+	constexpr std::array<double, 2u> aDir{{ 1., .25 }};
+	tri::IsoGeo const trigeo(1./7., 1./9., aDir);
+
+	// index nodes inside a circular region
+	tri::shape::Circle const circle(dat::Spot{{ .5, -1.25 }}, 3.5);
+	tri::NodeIndex const index(trigeo, circle);
+
+	// check if nodes are inside circle (via lookup)
+	tri::NodeKey const keyIJ{ 3L, -7L };
+	bool const isIn{ index.contains(keyIJ) };
+
+	// ExampleEnd
+
+	// check all nodes in neighborhood explicitly
+	size_t expSize{ 0u };
+	size_t errCount{ 0u };
+	for (long ndxI{-100L} ; ndxI < 100L ; ++ndxI)
+	{
+		for (long ndxJ{-100L} ; ndxJ < 100L ; ++ndxJ)
+		{
+			tri::NodeKey const key{ ndxI, ndxJ };
+			bool const expIn
+				{ circle.contains(trigeo.refSpotForNodeKey(key)) };
+			if (expIn)
+			{
+				++expSize;
+			}
+			if (! (index.contains(key) == expIn))
+			{
+				++errCount;
+			}
+		}
+	}
+	if (! (index.size() == expSize))
+	{
+		oss << "Failure of circle size test" << std::endl;
+		oss << dat::infoString(expSize, "exp") << std::endl;
+		oss << dat::infoString(index.size(), "got") << std::endl;
+	}
+	if (! (0u == errCount))
+	{
+		oss << "Failure of circle contains test: errCount = "
+			<< errCount << std::endl;
+	}
+	bool const expIsIn{ circle.contains(trigeo.refSpotForNodeKey(keyIJ)) };
+	if (! (isIn == expIsIn))
+	{
+		oss << "Failure of example contains test" << std::endl;
+	}
+
+	return oss.str();
+}
+
 }
 
 //! Unit test for tri::NodeIndex
@@ -167,6 +288,8 @@ main
 	// run tests
 	oss << tri_NodeIndex_test0();
 	oss << tri_NodeIndex_test1();
+	oss << tri_NodeIndex_test2();
+	oss << tri_NodeIndex_test3();
 
 	// check/report results
 	std::string const errMessages(oss.str());
@@ -0,0 +1,214 @@
+//
+//
+// MIT License
+//
+// Copyright (c) 2017 Stellacore Corporation.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject
+// to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+// KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+// AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+// IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+
+/*! \file
+\brief  This file contains unit test for tri::NodeStore
+*/
+
+
+#include "libtri/NodeStore.h"
+
+#include "libdat/compare.h"
+#include "libdat/info.h"
+#include "libdat/validity.h"
+#include "libio/stream.h"
+#include "libtri/IsoTille.h"
+#include "libtri/NodeIterator.h"
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+//! Check for common functions
+std::string
+tri_NodeStore_test0
+	()
+{
+	std::ostringstream oss;
+	tri::NodeStore<float> const aNull{};
+	if (dat::isValid(aNull))
+	{
+		oss << "Failure of null value test" << std::endl;
+		oss << "infoString: " << dat::infoString(aNull) << std::endl;
+	}
+	return oss.str();
+}
+
+//! A (planar) property which is interpolated exactly
+double
+planeValueAt
+	( dat::Spot const & xySpot
+	)
+{
+	return (1.25 + .5 * xySpot[0] - .75 * xySpot[1]);
+}
+
+//! Check node access and batch interpolation
+std::string
+tri_NodeStore_test1
+	()
+{
+	std::ostringstream oss;
+
+	// ExampleStart
+
+	// create a generic tritille
+	dat::Range<double> const xRange{  -7.,  3. };
+	dat::Range<double> const yRange{ -15., 17. };
+	double const xDelta{ 1./7. };
+	double const yDelta{ 1./9. };
+	tri::IsoTille const trinet
+		{ tri::IsoTille::genericTille(xRange, yRange, xDelta, yDelta) };
+
+	// allocate dense storage for each node (initialized to null)
+	tri::NodeStore<double> store(trinet);
+
+	// assign property values to each node
+	tri::IsoGeo const & trigeo = trinet.theTileGeo;
+	for (tri::NodeIterator iter(trinet.begin()) ; iter ; ++iter)
+	{
+		tri::NodeKey const keyIJ{ iter.nodeKey() };
+		dat::Spot const xySpot(trigeo.refSpotForNodeKey(keyIJ));
+		store.setValue(keyIJ, planeValueAt(xySpot));
+	}
+
+	// interpolate at many locations at once (in parallel)
+	std::vector<dat::Spot> xySpots;
+	for (double yy{-16.} ; yy < 18. ; yy += .0625)
+	{
+		for (double xx{-8.} ; xx < 4. ; xx += .0625)
+		{
+			xySpots.emplace_back(dat::Spot{{ xx, yy }});
+		}
+	}
+	constexpr size_t numJobs{ 3u };
+	std::vector<double> const gotValues
+		{ trinet.linearInterpWithCheck(xySpots, store, numJobs) };
+
+	// ExampleEnd
+
+	if (! (store.size() == trinet.sizeValidNodes()))
+	{
+		oss << "Failure of store size test" << std::endl;
+		oss << dat::infoString(store.size(), "store.size") << std::endl;
+	}
+
+	tri::NodeKey const badKeyIJ{ 12345678L,  -654321L };
+	if (dat::isValid(store(badKeyIJ)) || store.setValue(badKeyIJ, 1.))
+	{
+		oss << "Failure of bad key access test" << std::endl;
+	}
+
+	// compare with individual interpolation
+	size_t numDiff{ 0u };
+	size_t numBad{ 0u };
+	dat::Range<double> const xIn{ xRange.min() + 1., xRange.max() - 1. };
+	dat::Range<double> const yIn{ yRange.min() + 1., yRange.max() - 1. };
+	if (! (gotValues.size() == xySpots.size()))
+	{
+		oss << "Failure of batch size test" << std::endl;
+	}
+	else
+	{
+		for (size_t nn{0u} ; nn < xySpots.size() ; ++nn)
+		{
+			dat::Spot const & xySpot = xySpots[nn];
+			double const & gotValue = gotValues[nn];
+			double const expValue
+				{ trinet.linearInterpWithCheck(xySpot, store) };
+			bool const same
+				{  (gotValue == expValue)
+				|| (std::isnan(gotValue) && std::isnan(expValue))
+				};
+			if (! same)
+			{
+				++numDiff;
+			}
+			if (xIn.contains(xySpot[0]) && yIn.contains(xySpot[1]))
+			{
+				double const planeValue{ planeValueAt(xySpot) };
+				if (! dat::nearlyEquals(gotValue, planeValue, 1.e-12))
+				{
+					++numBad;
+				}
+			}
+		}
+	}
+	if (! (0u == numDiff))
+	{
+		oss << "Failure of batch/single interpolation test" << std::endl;
+		oss << dat::infoString(numDiff, "numDiff") << std::endl;
+	}
+	if (! (0u == numBad))
+	{
+		oss << "Failure of planar interpolation test" << std::endl;
+		oss << dat::infoString(numBad, "numBad") << std::endl;
+	}
+
+	// check inverse distance interpolation via store
+	tri::NodeKey const keyIJ{ trinet.begin().nodeKey() };
+	double const gotIDW{ trinet.nodeValueViaInvDist(keyIJ, 1.5, store) };
+	if (! dat::isValid(gotIDW))
+	{
+		oss << "Failure of nodeValueViaInvDist test" << std::endl;
+	}
+
+	return oss.str();
+}
+
+
+}
+
+//! Unit test for tri::NodeStore
+int
+main
+	( int const /*argc*/
+	, char const * const * /*argv*/
+	)
+{
+	std::ostringstream oss;
+
+	// run tests
+	oss << tri_NodeStore_test0();
+	oss << tri_NodeStore_test1();
+
+	// check/report results
+	std::string const errMessages(oss.str());
+	if (! errMessages.empty())
+	{
+		io::err() << errMessages << std::endl;
+		return 1;
+	}
+	return 0;
+}